@@ -0,0 +1,104 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "audio_utils.hpp"
+#include "openvino/genai/whisper_pipeline.hpp"
+
+namespace {
+
+constexpr size_t SAMPLING_RATE = 16000;
+
+double get_percentile(std::vector<double> values, double percentile) {
+    if (values.empty()) {
+        return 0.0;
+    }
+    std::sort(values.begin(), values.end());
+    const size_t idx = static_cast<size_t>(percentile / 100.0 * (values.size() - 1) + 0.5);
+    return values[idx];
+}
+
+void print_stats(const std::string& name, const std::vector<double>& values) {
+    const double mean = values.empty() ? 0.0 : std::accumulate(values.begin(), values.end(), 0.0) / values.size();
+    std::cout << name << ": mean " << mean << " ms, p50 " << get_percentile(values, 50) << " ms, p90 "
+              << get_percentile(values, 90) << " ms\n";
+}
+
+}  // namespace
+
+// Pushes a wav file to a streaming session in frames paced in real time, as a microphone would, and reports the
+// latency between the end of a speech chunk in the audio and the moment its text becomes final.
+int main(int argc, char* argv[]) try {
+    if (argc < 3 || argc > 5) {
+        throw std::runtime_error(std::string{"Usage: "} + argv[0] +
+                                 " <MODEL_DIR> \"<WAV_FILE_PATH>\" <DEVICE> <FRAME_MS>");
+    }
+
+    std::filesystem::path models_path = argv[1];
+    std::string wav_file_path = argv[2];
+    std::string device = (argc >= 4) ? argv[3] : "CPU";  // Default to CPU if no device is provided
+    const size_t frame_ms = (argc == 5) ? std::stoul(argv[4]) : 100;
+    const size_t frame_size = SAMPLING_RATE * frame_ms / 1000;
+
+    ov::genai::WhisperPipeline pipeline(models_path, device);
+
+    ov::genai::WhisperGenerationConfig config = pipeline.get_generation_config();
+    config.return_timestamps = true;
+
+    // Pipeline expects normalized audio with Sample Rate of 16kHz
+    ov::genai::RawSpeechInput raw_speech = utils::audio::read_wav(wav_file_path);
+
+    std::vector<double> push_durations, finalization_latencies;
+    std::cout << std::fixed << std::setprecision(2);
+    auto report_update = [&](const ov::genai::WhisperStreamingUpdate& update,
+                             std::chrono::steady_clock::time_point stream_start) {
+        const double stream_time_ms =
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - stream_start).count();
+        for (const auto& chunk : update.final_chunks) {
+            finalization_latencies.push_back(stream_time_ms - chunk.end_ts * 1000);
+            std::cout << "final [" << chunk.start_ts << ", " << chunk.end_ts << "]:" << chunk.text << "\n";
+        }
+    };
+
+    pipeline.start_streaming(config);
+    const auto stream_start = std::chrono::steady_clock::now();
+    for (size_t offset = 0; offset < raw_speech.size(); offset += frame_size) {
+        // the frame is available once its last sample has been recorded
+        const size_t frame_end = std::min(offset + frame_size, raw_speech.size());
+        std::this_thread::sleep_until(stream_start + std::chrono::milliseconds(frame_end * 1000 / SAMPLING_RATE));
+
+        const auto push_start = std::chrono::steady_clock::now();
+        auto update = pipeline.push_audio({raw_speech.begin() + offset, raw_speech.begin() + frame_end});
+        push_durations.push_back(
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - push_start).count());
+        report_update(update, stream_start);
+    }
+    report_update(pipeline.finish_streaming(), stream_start);
+
+    const double audio_duration_ms = raw_speech.size() * 1000.0 / SAMPLING_RATE;
+    const double processing_ms = std::accumulate(push_durations.begin(), push_durations.end(), 0.0);
+    std::cout << "\n";
+    print_stats("push_audio duration", push_durations);
+    print_stats("finalization latency", finalization_latencies);
+    std::cout << "real time factor: " << processing_ms / audio_duration_ms << "\n";
+
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {
+    }
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {
+    }
+    return EXIT_FAILURE;
+}
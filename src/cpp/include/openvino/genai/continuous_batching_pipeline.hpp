@@ -4,6 +4,7 @@
 #pragma once
 
 #include <filesystem>
+#include <map>
 #include <memory>
 #include <string>
 #include <optional>
@@ -23,6 +24,41 @@
 
 namespace ov::genai {
 
+/**
+ * Latency statistics of the requests sharing the same `GenerationConfig::priority`, aggregated throughout the lifetime of the pipeline.
+ */
+struct PriorityClassMetrics {
+    /**
+     * Number of requests of the class to be processed by the pipeline.
+     */
+    size_t requests = 0;
+
+    /**
+     * Number of requests of the class which finished generation.
+     */
+    size_t finished_requests = 0;
+
+    /**
+     * Average time to first token of the finished requests in milliseconds.
+     */
+    float avg_ttft = 0.0;
+
+    /**
+     * Average time per output token of the finished requests in milliseconds.
+     */
+    float avg_tpot = 0.0;
+
+    /**
+     * Number of finished requests which produced the first token later than their `ttft_deadline_ms`.
+     */
+    size_t ttft_deadline_misses = 0;
+
+    /**
+     * Number of generation steps of the finished requests which produced tokens later than `tpot_deadline_ms` after the previous ones.
+     */
+    size_t tpot_deadline_misses = 0;
+};
+
 /**
  * @brief Contains general pipeline metrics, either aggregated throughout the lifetime of the generation pipeline
  * or measured at the previous generation step.
@@ -64,6 +100,11 @@ struct PipelineMetrics {
      * distinguish between used and unused portions in dynamic KV cache configurations.
      */
     size_t kv_cache_size_in_bytes = 0;
+
+    /**
+     * Latency statistics per priority class, keyed by `GenerationConfig::priority`.
+     */
+    std::map<size_t, PriorityClassMetrics> priority_classes;
 };
 
 class OPENVINO_GENAI_EXPORTS ContinuousBatchingPipeline {
@@ -622,6 +622,12 @@ operator|(const StructuredOutputConfig::StructuralTag& lhs,
  * @param max_ngram_size is maximum ngram to use when looking for matches in the prompt.
  *
  * @param structured_output_config if set, the output will be a string constrained by the specified json_schema, regex, or EBNF grammar.
+ *
+ * Scheduling parameters, used by continuous batching pipelines only:
+ * @param priority priority class of the request. Requests with higher values get their prompts scheduled first and are the last
+ *        to be preempted. Requests of the same class are ordered by their nearest deadline, then by arrival.
+ * @param ttft_deadline_ms time to first token target in milliseconds counted from the request arrival, 0 means no target.
+ * @param tpot_deadline_ms time per output token target in milliseconds, 0 means no target.
  * 
  * @param apply_chat_template whether or not to apply chat_template for non-chat scenarios
  */
@@ -683,6 +689,11 @@ public:
     // set to true if chat template should be applied for non-chat scenarios, set to false otherwise
     bool apply_chat_template = true;
 
+    // Scheduling parameters
+    size_t priority = 0;
+    size_t ttft_deadline_ms = 0;
+    size_t tpot_deadline_ms = 0;
+
 
     /** @brief sets eos_token_id to tokenizer_eos_token_id if eos_token_id is less than 0.
      * Otherwise verifies eos_token_id == tokenizer_eos_token_id.
@@ -758,5 +769,9 @@ static constexpr ov::Property<std::string> backend{"backend"};
 
 static constexpr ov::Property<bool> apply_chat_template{"apply_chat_template"};
 
+static constexpr ov::Property<size_t> priority{"priority"};
+static constexpr ov::Property<size_t> ttft_deadline_ms{"ttft_deadline_ms"};
+static constexpr ov::Property<size_t> tpot_deadline_ms{"tpot_deadline_ms"};
+
 }  // namespace genai
 }  // namespace ov
@@ -129,9 +129,19 @@ public:
         return compile(device, ov::AnyMap{std::forward<Properties>(properties)...});
     }
 
-    ov::Tensor decode(ov::Tensor latent);
+    /**
+     * @brief Decodes latent to an image.
+     * @param tiling_config If set, latent is decoded by overlapping tiles, which are blended in pixel space.
+     * Requires VAE decoder with dynamic spatial dimensions when the latent doesn't fit a single tile.
+     */
+    ov::Tensor decode(ov::Tensor latent, const std::optional<VAETilingConfig>& tiling_config = std::nullopt);
 
-    ov::Tensor encode(ov::Tensor image, std::shared_ptr<Generator> generator);
+    /**
+     * @brief Encodes an image to latent.
+     * @param tiling_config If set, image is encoded by overlapping tiles, which are blended in latent space.
+     * Requires VAE encoder with dynamic spatial dimensions when the image doesn't fit a single tile.
+     */
+    ov::Tensor encode(ov::Tensor image, std::shared_ptr<Generator> generator, const std::optional<VAETilingConfig>& tiling_config = std::nullopt);
 
     const Config& get_config() const;
 
@@ -147,6 +157,8 @@ public:
 
 private:
     void merge_vae_image_post_processing() const;
+    // returns raw encoder output for the whole image
+    ov::Tensor encode_tiled(ov::Tensor image, const std::optional<VAETilingConfig>& tiling_config);
     void import_model(const std::filesystem::path& blob_path, const std::string& device, const ov::AnyMap& properties = {});
 
     Config m_config;
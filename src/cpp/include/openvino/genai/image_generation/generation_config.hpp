@@ -13,6 +13,7 @@
 #include "openvino/genai/lora_adapter.hpp"
 #include "openvino/genai/visibility.hpp"
 #include "openvino/genai/taylorseer_config.hpp"
+#include "openvino/genai/vae_tiling_config.hpp"
 
 namespace ov {
 namespace genai {
@@ -128,6 +129,11 @@ struct OPENVINO_GENAI_EXPORTS ImageGenerationConfig {
      */
     std::optional<TaylorSeerCacheConfig> taylorseer_config;
 
+    /**
+     * Enables tiled VAE encoding and decoding, which reduces memory consumption of high resolution generation
+     */
+    std::optional<VAETilingConfig> vae_tiling_config;
+
     /**
      * Checks whether image generation config is valid, otherwise throws an exception.
      */
@@ -242,6 +248,12 @@ extern OPENVINO_GENAI_EXPORTS ov::Property<size_t> rng_seed;
  */
 static constexpr ov::Property<int> max_sequence_length{"max_sequence_length"};
 
+/**
+ * Configuration of tiled VAE encoding and decoding. Images larger than a tile are processed by VAE tile by tile
+ * and blended over the tile overlaps, which bounds VAE memory consumption at high resolutions.
+ */
+static constexpr ov::Property<VAETilingConfig> vae_tiling_config{"vae_tiling_config"};
+
 /**
  * User callback for image generation pipelines, which is called within a pipeline with the following arguments:
  * - Current inference step
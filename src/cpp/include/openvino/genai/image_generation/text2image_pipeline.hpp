@@ -9,6 +9,15 @@
 namespace ov {
 namespace genai {
 
+/**
+ * Image(s) generated for a prompt of a batched 'generate()' call together with performance metrics of this prompt
+ */
+struct ImageGenerationResult {
+    // a tensor of [num_images_per_prompt, height, width, 3] dimensions, empty if generation was stopped by callback
+    ov::Tensor image;
+    ImageGenerationPerfMetrics performance_stat;
+};
+
 /**
  * Text to image pipelines which provides unified API to all supported models types.
  * Models specific aspects are hidden in image generation config, which includes multiple prompts support or
@@ -245,6 +254,21 @@ public:
         return generate(positive_prompt, ov::AnyMap{std::forward<Properties>(properties)...});
     }
 
+    /**
+     * Generates images for several prompts, e.g. for requests of concurrent users.
+     * For Stable Diffusion and Latent Consistency models, requests of the same image size and guidance mode are denoised
+     * together: a single UNet inference per denoising step for all requests at the same timestep. Requests are admitted
+     * between steps, up to 8 images at once, and leave the batch once denoised or stopped by their callbacks.
+     * Each request keeps its own generation parameters, random generator and callback. Prompts are generated one after
+     * another by other models, by a reshaped pipeline, on NPU or if 'adapters' are passed to requests.
+     * @param positive_prompts Prompts to generate images from
+     * @param properties Image generation parameters of each prompt, which override the pipeline generation config.
+     * If empty, the pipeline generation config is used for all prompts.
+     * @returns Images and performance metrics of each prompt
+     */
+    std::vector<ImageGenerationResult> generate(const std::vector<std::string>& positive_prompts,
+                                                const std::vector<ov::AnyMap>& properties = {});
+
     /**
      * Performs latent image decoding. It can be useful to use within 'callback' which accepts current latent image
      * @param latent A latent image
@@ -17,6 +17,7 @@
 #include "openvino/genai/scheduler_config.hpp"
 #include "openvino/genai/common_types.hpp"
 #include "openvino/genai/json_container.hpp"
+#include "openvino/genai/session_state.hpp"
 
 namespace ov {
 namespace genai {
@@ -349,6 +350,25 @@ public:
         "Please, use generate() with ChatHistory argument.")
     void finish_chat();
 
+    /**
+    * @brief Saves the current chat session: the chat history and a copy of the KV cache.
+    * The session can be restored later to continue the chat without processing its history again,
+    * which allows a single pipeline to serve several conversations in turn.
+    * Supported by the stateful pipeline only.
+    *
+    * @return SessionState snapshot, which can be compressed or spilled to disk while the session is inactive.
+    */
+    SessionState save_session();
+
+    /**
+    * @brief Restores a chat session saved by save_session() of this pipeline, replacing the current one.
+    * Restoring an empty SessionState starts a new chat.
+    * Supported by the stateful pipeline only.
+    *
+    * @param session SessionState to restore, it can be restored several times.
+    */
+    void restore_session(const SessionState& session);
+
 private:
     std::string m_device;
     std::unique_ptr<LLMPipelineImplBase> m_pimpl;
@@ -181,6 +181,12 @@ public:
 
 static constexpr AdaptersProperty adapters;
 
+// ContinuousBatchingPipeline property that enables selection of LoRA adapters per request in the dynamic modes: requests with different
+// `GenerationConfig::adapters` are inferred in a single batch, and requests without adapters use the ones the pipeline was created with.
+// It adds `lora_adapter_ids` input to the model, and the pipeline adapters are applied per request as the fallback for requests without
+// their own adapters rather than globally. Disabled by default, in which case all the requests processed together must use the same adapters.
+static constexpr ov::Property<bool> per_request_adapters{"per_request_adapters"};
+
 
 class OPENVINO_GENAI_EXPORTS AdapterController {
 
@@ -191,11 +197,20 @@ public:
 
     AdapterController() = default;
 
-    AdapterController(std::shared_ptr<ov::Model> model, const AdapterConfig& config, std::string device);
+    // If `per_request_adapters` is true and one of the dynamic modes is used, the model gets `lora_adapter_ids` input
+    // that selects an adapter slot for each token. It allows to infer tokens of requests with different adapters in a single batch.
+    AdapterController(std::shared_ptr<ov::Model> model, const AdapterConfig& config, std::string device, bool per_request_adapters = false);
 
     // Apply adapters configured in the current config set last time, or set and use new config given as optional `config` argument
     void apply(ov::InferRequest request, const std::optional<AdapterConfig>& config = std::nullopt);
 
+    // Apply a separate adapter config to each slot, tokens with `lora_adapter_ids` value i use adapters from `slot_configs[i]`.
+    // Adapters of all slots are applied together, so the cost of a LoRA layer grows with the total rank of the distinct adapters.
+    void apply_per_request(ov::InferRequest request, const std::vector<AdapterConfig>& slot_configs);
+
+    // Returns true if the model has `lora_adapter_ids` input and `apply_per_request` can be used
+    bool has_per_request_adapters() const;
+
     // Returns true if a given name is one of the state names created by this adapter controller for dynamic LoRA
     // Helps to distinguish LoRA states from other states (e.g. KV cache state) in the model for a partial state reset.
     bool has_state_name(const std::string& name);
@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <sstream>
+#include <string>
 
 #include "openvino/genai/cache_eviction.hpp"
 #include "openvino/genai/sparse_attention.hpp"
@@ -30,6 +31,21 @@ struct SchedulerConfig {
     // If dynamic_split_fuse is turned off any prompt that is longer than batch size will lead to error.
     bool dynamic_split_fuse = true;
 
+    // Chunked prefill policy, has effect only if dynamic_split_fuse is turned on.
+    // Maximum number of prompt tokens scheduled for a single sequence group per step. Zero means unlimited.
+    // Smaller chunks let other prompts and generating sequences share the step with a long prompt.
+    std::size_t max_prompt_chunk_size = 0;
+
+    // Whether to share the prompt tokens budget of a step equally between all waiting prompts instead of
+    // filling it greedily in scheduling order. Budget left by short prompts is redistributed among longer ones,
+    // so a long prompt does not delay the first token of the prompts queued after it.
+    bool fair_prompt_chunking = false;
+
+    // Number of batched tokens per step prompts cannot take while there are sequences in the generation phase.
+    // Prompt chunks are then limited to max_num_batched_tokens - num_reserved_decode_tokens tokens even if the generating
+    // sequences need fewer, which bounds the step duration and hence the time per output token.
+    std::size_t num_reserved_decode_tokens = 0;
+
 
     /**
      * Whether to use cache eviction for all sequences processed by this pipeline. When cache eviction is enabled,
@@ -61,6 +77,33 @@ struct SchedulerConfig {
     // When ContinuousBatching is invoked from LLMPipeline (client scenario) by default prefix caching is turned on.
     bool enable_prefix_caching = false;
 
+    // Number of KV blocks in host memory available for swapping out preempted sequences.
+    // When greater than zero, a sequence group preempted due to KV cache shortage has its blocks copied to host memory
+    // and restored back on resume instead of being recomputed from scratch.
+    // Swapping is not applied when prefix caching or cache eviction is enabled.
+    std::size_t num_swap_kv_blocks = 0;
+
+    // Minimal number of processed tokens for a preempted sequence group to be swapped out instead of recomputed.
+    // Recompute cost grows faster than the cost of copying blocks to host memory and back, so long sequences
+    // benefit from swapping, while short ones are cheaper to recompute.
+    std::size_t swap_min_num_tokens = 512;
+
+    // Path to a file used as a second, persistent tier of the prefix cache. Has effect only if enable_prefix_caching is turned on.
+    // When set, full KV blocks of computed prompts are written to the file, and prompts starting with a prefix found in the file
+    // restore the corresponding KV blocks instead of recomputing them, including after a pipeline restart.
+    // The file is tied to the model weights it was written for: a file written for a different model is reset on pipeline creation.
+    // Not applied when cache eviction is enabled.
+    std::string persistent_prefix_cache_path;
+
+    // Size budget of the persistent prefix cache file in GB. Once exceeded, the least recently used blocks are overwritten.
+    // Changing the budget invalidates the existing file contents.
+    std::size_t persistent_prefix_cache_size = 1;
+
+    // Starvation protection for requests with `GenerationConfig::priority` set. Every `priority_aging_interval_ms`
+    // milliseconds a request waits without being scheduled, its effective priority grows by one, so low priority
+    // requests are eventually served even under a constant flow of high priority ones. Zero disables aging.
+    std::size_t priority_aging_interval_ms = 1000;
+
     /** Whether to apply block-wise sparse attention to the prefill stage.
      */
     bool use_sparse_attention = false;
@@ -71,8 +114,14 @@ struct SchedulerConfig {
     bool operator==(const SchedulerConfig& other) const {
         return max_num_batched_tokens == other.max_num_batched_tokens && num_kv_blocks == other.num_kv_blocks &&
                cache_size == other.cache_size &&
-               dynamic_split_fuse == other.dynamic_split_fuse && use_cache_eviction == other.use_cache_eviction &&
-               max_num_seqs == other.max_num_seqs && enable_prefix_caching == other.enable_prefix_caching;
+               dynamic_split_fuse == other.dynamic_split_fuse && max_prompt_chunk_size == other.max_prompt_chunk_size &&
+               fair_prompt_chunking == other.fair_prompt_chunking &&
+               num_reserved_decode_tokens == other.num_reserved_decode_tokens && use_cache_eviction == other.use_cache_eviction &&
+               max_num_seqs == other.max_num_seqs && enable_prefix_caching == other.enable_prefix_caching &&
+               num_swap_kv_blocks == other.num_swap_kv_blocks && swap_min_num_tokens == other.swap_min_num_tokens &&
+               persistent_prefix_cache_path == other.persistent_prefix_cache_path &&
+               persistent_prefix_cache_size == other.persistent_prefix_cache_size &&
+               priority_aging_interval_ms == other.priority_aging_interval_ms;
     }
 
     /**
@@ -89,12 +138,22 @@ struct SchedulerConfig {
         oss << "  num_kv_blocks: " << num_kv_blocks << "\n";
         oss << "  cache_size: " << cache_size << "\n";
         oss << "  dynamic_split_fuse: " << std::boolalpha << dynamic_split_fuse << "\n";
+        oss << "  max_prompt_chunk_size: " << max_prompt_chunk_size << "\n";
+        oss << "  fair_prompt_chunking: " << std::boolalpha << fair_prompt_chunking << "\n";
+        oss << "  num_reserved_decode_tokens: " << num_reserved_decode_tokens << "\n";
         oss << "  use_cache_eviction: " << std::boolalpha << use_cache_eviction << "\n";
         if (use_cache_eviction) {
             oss << cache_eviction_config.to_string() << "\n";
         }
         oss << "  max_num_seqs: " << max_num_seqs << "\n";
         oss << "  enable_prefix_caching: " << std::boolalpha << enable_prefix_caching << "\n";
+        oss << "  num_swap_kv_blocks: " << num_swap_kv_blocks << "\n";
+        oss << "  swap_min_num_tokens: " << swap_min_num_tokens << "\n";
+        if (!persistent_prefix_cache_path.empty()) {
+            oss << "  persistent_prefix_cache_path: " << persistent_prefix_cache_path << "\n";
+            oss << "  persistent_prefix_cache_size: " << persistent_prefix_cache_size << "\n";
+        }
+        oss << "  priority_aging_interval_ms: " << priority_aging_interval_ms << "\n";
         oss << "  use_sparse_attention: " << std::boolalpha << use_sparse_attention << "\n";
         if (use_sparse_attention) {
             oss << sparse_attention_config.to_string() << "\n";
@@ -0,0 +1,67 @@
+// Copyright (C) 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <filesystem>
+#include <memory>
+
+#include "openvino/genai/visibility.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * @brief Snapshot of a chat session of LLMPipeline: the chat history and the KV cache of the model.
+ * It is created by LLMPipeline::save_session() and restored by LLMPipeline::restore_session(), which allows
+ * a single pipeline to serve several conversations without prefilling their history again on every switch.
+ * Copies of a SessionState share the same snapshot.
+ */
+class OPENVINO_GENAI_EXPORTS SessionState {
+public:
+    /**
+     * @brief Creates an empty session. Restoring it starts a new chat.
+     */
+    SessionState();
+
+    /**
+     * @brief Stores f32 KV cache tensors in f16, halving the memory of the snapshot at a small accuracy cost.
+     * Tensors are converted back to their original precision on restore.
+     */
+    void compress();
+
+    /**
+     * @brief Writes the KV cache tensors to a file and releases their memory.
+     * The tensors are read from the file on every restore, the file must exist while the session is used.
+     * @param path Path of the file to write.
+     */
+    void spill(const std::filesystem::path& path);
+
+    /**
+     * @return Whether the KV cache tensors are stored in a file.
+     */
+    bool is_spilled() const;
+
+    /**
+     * @return The number of bytes of the KV cache tensors of the snapshot, either in memory or in the file.
+     */
+    size_t get_size_in_bytes() const;
+
+    /**
+     * @return Duration of the snapshot creation in milliseconds.
+     */
+    float get_save_duration() const;
+
+    /**
+     * @return Duration of the last restore of the session in milliseconds, 0 if it was not restored yet.
+     */
+    float get_restore_duration() const;
+
+    class SessionStateImpl;
+private:
+    friend class StatefulLLMPipeline;
+    std::shared_ptr<SessionStateImpl> m_pimpl;
+};
+
+}  // namespace genai
+}  // namespace ov
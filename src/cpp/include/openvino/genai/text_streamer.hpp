@@ -36,6 +36,16 @@ protected:
     size_t m_printed_len = 0;
     ov::AnyMap m_additional_detokenization_params;
 
+    // Incremental detokenization state: m_text is the text of m_tokens_cache[0, m_read_offset) and
+    // m_prefix_text is the text of the short window m_tokens_cache[m_prefix_offset, m_read_offset).
+    // m_window_text is the text of m_tokens_cache[m_prefix_offset, m_window_end) decoded by the last write.
+    std::string m_text;
+    std::string m_prefix_text;
+    std::string m_window_text;
+    size_t m_prefix_offset = 0;
+    size_t m_read_offset = 0;
+    size_t m_window_end = 0;
+
     StreamingStatus set_streaming_status(CallbackTypeVariant callback_status);
 
     std::function<CallbackTypeVariant(std::string)> m_subword_callback = [](std::string words) -> bool {
@@ -45,6 +55,10 @@ protected:
     StreamingStatus run_callback_if_needed(const std::string& text);
 
     void compute_decoded_length_for_position(size_t cache_position);
+
+    std::string decode_cache(size_t cache_end);
+    void update_decoded_prefix(const std::string& text);
+    void reset_cache();
 };
 
 class OPENVINO_GENAI_EXPORTS TextParserStreamer : public TextStreamer {
@@ -136,6 +136,15 @@ public:
     */
     TokenizedInputs encode(const std::vector<std::string>& prompt, const ov::AnyMap& tokenization_params = {});
     TokenizedInputs encode(const std::initializer_list<std::string>& prompts, const ov::AnyMap& tokenization_params = {});
+
+    /**
+    * @brief encode every prompt separately, running the prompts on all the tokenizer infer requests asynchronously.
+    * Unlike batch encode, the results are not padded to the longest prompt.
+    * @param prompts vector storing prompts
+    * @param tokenization_params AnyMap with tokenization parameters, e.g. {{"add_special_tokens", false}, {"max_length", 128}}
+    * @return vector of [input_ids, attention_mask] pairs in the order of prompts
+    */
+    std::vector<TokenizedInputs> encode_parallel(const std::vector<std::string>& prompts, const ov::AnyMap& tokenization_params = {});
    
     /**
     * @brief encode paired prompts.
@@ -334,6 +343,11 @@ static constexpr ov::Property<bool> add_special_tokens{"add_special_tokens"};
 static constexpr ov::Property<bool> skip_special_tokens{"skip_special_tokens"};
 static constexpr ov::Property<bool> pad_to_max_length{"pad_to_max_length"};
 static constexpr ov::Property<std::string> padding_side{"padding_side"};
+/**
+ * @brief Size in bytes of the cache of encoded single prompts, e.g. repeated system prompts or chat template headers.
+ * The least recently used prompts are evicted first. The cache is disabled by default.
+ */
+static constexpr ov::Property<size_t> encode_cache_size{"encode_cache_size"};
 
 }  // namespace genai
 }  // namespace ov
@@ -0,0 +1,55 @@
+// Copyright (C) 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <sstream>
+
+#include "openvino/core/except.hpp"
+
+namespace ov::genai {
+
+/**
+ * Configuration of tiled VAE encoding and decoding. Images (and video frames) are split into overlapping tiles
+ * which are processed by VAE one by one and linearly blended over the overlaps, so peak memory of VAE inference
+ * depends on the tile size rather than on the image resolution.
+ * @note Tiling requires VAE models with dynamic spatial (and temporal) dimensions.
+ */
+class VAETilingConfig {
+public:
+    std::string to_string() const {
+        std::ostringstream oss;
+        oss << "VAETilingConfig {\n"
+            << "  tile_size: " << tile_size << "\n"
+            << "  tile_overlap: " << tile_overlap << "\n"
+            << "  temporal_tile_size: " << temporal_tile_size << "\n"
+            << "  temporal_tile_overlap: " << temporal_tile_overlap << "\n"
+            << "}";
+        return oss.str();
+    }
+
+    void validate() const {
+        OPENVINO_ASSERT(tile_size > 0, "VAE tile_size must be positive");
+        OPENVINO_ASSERT(tile_overlap < tile_size,
+                        "VAE tile_overlap (", tile_overlap, ") must be less than tile_size (", tile_size, ")");
+        OPENVINO_ASSERT(temporal_tile_size == 0 || temporal_tile_overlap < temporal_tile_size,
+                        "VAE temporal_tile_overlap (", temporal_tile_overlap,
+                        ") must be less than temporal_tile_size (", temporal_tile_size, ")");
+    }
+
+    /** Height and width of a tile in pixels. Images which fit a single tile are processed without tiling. */
+    std::size_t tile_size = 512;
+
+    /** The number of pixels shared by neighboring tiles, which are blended over them. Must be less than tile_size. */
+    std::size_t tile_overlap = 64;
+
+    /** The number of video frames in a temporal tile. 0 disables temporal tiling. */
+    std::size_t temporal_tile_size = 0;
+
+    /** The number of video frames shared by neighboring temporal tiles. Must be less than temporal_tile_size. */
+    std::size_t temporal_tile_overlap = 8;
+};
+
+} // namespace ov::genai
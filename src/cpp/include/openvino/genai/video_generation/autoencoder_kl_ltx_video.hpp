@@ -50,7 +50,12 @@ public:
 
     AutoencoderKLLTXVideo& compile(const std::string& device, const ov::AnyMap& properties = {});
 
-    ov::Tensor decode(const ov::Tensor& latent);
+    /**
+     * @brief Decodes latent to a video.
+     * @param tiling_config If set, latent is decoded by overlapping spatial (and temporal) tiles, which are blended
+     * in pixel space. Requires VAE decoder with dynamic shapes when the latent doesn't fit a single tile.
+     */
+    ov::Tensor decode(const ov::Tensor& latent, const std::optional<VAETilingConfig>& tiling_config = std::nullopt);
 
     const Config& get_config() const;
 
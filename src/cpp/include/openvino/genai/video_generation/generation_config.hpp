@@ -64,6 +64,12 @@ struct VideoGenerationConfig {
      */
     std::optional<TaylorSeerCacheConfig> taylorseer_config = std::nullopt;
 
+    /**
+     * Enables tiled VAE decoding. Besides spatial tiles, a video can be split into overlapping temporal tiles
+     * of VAETilingConfig::temporal_tile_size frames.
+     */
+    std::optional<VAETilingConfig> vae_tiling_config = std::nullopt;
+
     /// LoRA adapters applied during generation.
     std::optional<AdapterConfig> adapters = std::nullopt;
 };
@@ -98,6 +98,17 @@ struct WhisperDecodedResults {
     }
 };
 
+/**
+ * @brief Transcription of the audio pushed to a streaming session since the previous update.
+ */
+struct WhisperStreamingUpdate {
+    // chunks which won't change anymore, in order of the audio
+    std::vector<WhisperDecodedResultChunk> final_chunks;
+
+    // current hypothesis for the audio after the final chunks, it may change with the next updates
+    std::optional<WhisperDecodedResultChunk> partial_chunk = std::nullopt;
+};
+
 /**
  * @brief Automatic speech recognition pipeline
  */
@@ -138,6 +149,8 @@ public:
 
     /**
      * @brief High level generate that receives raw speech as a vector of floats and returns decoded output.
+     * Long-form audio is transcribed by 30 seconds chunks. If the pipeline is constructed with the
+     * WHISPER_ENCODER_LOOKAHEAD property set to true, the chunk following the one being decoded is encoded meanwhile.
      *
      * @param raw_speech_input raw speech input. Required to be normalized to near [-1, 1] range and have 16k Hz
      * sampling rate.
@@ -164,6 +177,49 @@ public:
     }
     WhisperDecodedResults generate(const RawSpeechInput& raw_speech_input, const ov::AnyMap& config_map);
 
+    /**
+     * @brief Transcribes several audio inputs at once. Encoder and decoder inferences of 30 seconds chunks of
+     * different inputs are batched, up to WHISPER_MAX_BATCH_SIZE chunks passed as a pipeline property, 8 by default.
+     * Inputs are transcribed one after another for beam search, word level timestamps or NPU.
+     *
+     * @param raw_speech_inputs raw speech inputs. Required to be normalized to near [-1, 1] range and have 16k Hz
+     * sampling rate.
+     * @param generation_configs generation configs of the inputs, the pipeline generation config is used if empty
+     * @param streamers optional streamers of the inputs
+     * @return std::vector<WhisperDecodedResults> decoded transcriptions of the inputs
+     */
+    std::vector<WhisperDecodedResults> generate(const std::vector<RawSpeechInput>& raw_speech_inputs,
+                                                const std::vector<WhisperGenerationConfig>& generation_configs = {},
+                                                const std::vector<StreamerVariant>& streamers = {});
+
+    /**
+     * @brief Starts a streaming session, the audio is pushed to it piece by piece as it arrives, e.g. from a
+     * microphone. The pushed audio is transcribed by windows of up to 30 seconds, which are decoded again as new audio
+     * arrives. A chunk becomes final once the same text has been decoded for it by two consecutive updates or once
+     * the window it belongs to is full. A previous session is discarded. Not supported by the static NPU pipeline.
+     *
+     * @param generation_config optional GenerationConfig, beam search and word level timestamps are not supported
+     * @param min_update_interval the minimal duration of new audio in seconds, which triggers decoding of the window
+     */
+    void start_streaming(OptionalWhisperGenerationConfig generation_config = std::nullopt,
+                         float min_update_interval = 1.0f);
+
+    /**
+     * @brief Pushes the next piece of audio to the streaming session.
+     *
+     * @param raw_speech_input raw speech input. Required to be normalized to near [-1, 1] range and have 16k Hz
+     * sampling rate.
+     * @return WhisperStreamingUpdate the chunks which have become final and the current partial chunk
+     */
+    WhisperStreamingUpdate push_audio(const RawSpeechInput& raw_speech_input);
+
+    /**
+     * @brief Transcribes the rest of the pushed audio and closes the streaming session.
+     *
+     * @return WhisperStreamingUpdate the remaining final chunks
+     */
+    WhisperStreamingUpdate finish_streaming();
+
     ov::genai::Tokenizer get_tokenizer();
     WhisperGenerationConfig get_generation_config() const;
     void set_generation_config(const WhisperGenerationConfig& config);
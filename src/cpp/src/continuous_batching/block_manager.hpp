@@ -6,6 +6,7 @@
 #include <memory>
 #include <list>
 #include <map>
+#include <unordered_map>
 #include <algorithm>
 #include <fstream>
 #include <chrono>
@@ -78,10 +79,51 @@ using BlocksPerLayer = std::vector<KVCacheBlock::Ptr>;
  * Blocks with the same prefix in the generated sequence will have the same hash. Blocks within this store
  * are not owned by any sequence (but had been once) and may be either selected for overwriting, if the allocator
  * runs out of fresh blocks, or reused if their contents match to the prefix-based requested hash.
+ * The store entries are linked into an intrusive recency list ordered from the least to the most recently
+ * added (or touched) entry, so that all operations take constant time regardless of the store size.
  */
 class OverwritableBlocksHashStore {
-    std::map<size_t, BlocksPerLayer> m_blocks;
+    struct Entry {
+        BlocksPerLayer blocks;
+        Entry* prev = nullptr;
+        Entry* next = nullptr;
+    };
+
+    // node-based container, so that the entry addresses used as list links stay valid on rehashing
+    std::unordered_map<size_t, Entry> m_blocks;
+    Entry* m_lru_head = nullptr;
+    Entry* m_lru_tail = nullptr;
     size_t m_num_layers;
+
+    void _link_back(Entry& entry) {
+        entry.prev = m_lru_tail;
+        entry.next = nullptr;
+        if (m_lru_tail) {
+            m_lru_tail->next = &entry;
+        } else {
+            m_lru_head = &entry;
+        }
+        m_lru_tail = &entry;
+    }
+
+    void _unlink(Entry& entry) {
+        (entry.prev ? entry.prev->next : m_lru_head) = entry.next;
+        (entry.next ? entry.next->prev : m_lru_tail) = entry.prev;
+        entry.prev = entry.next = nullptr;
+    }
+
+    BlocksPerLayer _pop(std::unordered_map<size_t, Entry>::iterator it) {
+        _unlink(it->second);
+        BlocksPerLayer blocks_for_all_layers = std::move(it->second.blocks);
+        m_blocks.erase(it);
+        auto timestamp = std::chrono::steady_clock::now();
+        for (auto& block_ptr : blocks_for_all_layers) {
+            block_ptr->set_timestamp(timestamp);
+            block_ptr->increment();
+        }
+        return blocks_for_all_layers;
+    }
+
     public:
     /**
      * Constructs the BlockHashStore.
@@ -89,12 +131,16 @@ class OverwritableBlocksHashStore {
      */
     explicit OverwritableBlocksHashStore(size_t num_layers = 1) : m_num_layers(num_layers) { OPENVINO_ASSERT(num_layers != 0, "num_layers must be non-zero"); }
 
+    OverwritableBlocksHashStore(const OverwritableBlocksHashStore&) = delete;
+    OverwritableBlocksHashStore& operator=(const OverwritableBlocksHashStore&) = delete;
+
     /**
      * Registers allocated KV cache blocks as overwritable. The blocks must not be owned by any sequence.
+     * The blocks become the most recently used entry of the store.
      * @param blocks_for_all_layers A vector of KV cache blocks (one for each decoder layer) to be added to the store.
      * The hash of each block across the vector must be identical.
      */
-    void add(const BlocksPerLayer& blocks_for_all_layers) {
+    void add(BlocksPerLayer blocks_for_all_layers) {
         OPENVINO_ASSERT(blocks_for_all_layers.size() == m_num_layers);
         bool is_all_free = std::all_of(blocks_for_all_layers.begin(), blocks_for_all_layers.end(), [](const KVCacheBlock::Ptr& block_ptr) { return block_ptr->is_free(); });
         OPENVINO_ASSERT(is_all_free);
@@ -104,10 +150,26 @@ class OverwritableBlocksHashStore {
                 OPENVINO_THROW("internal error - block hashes for all layers must be equal");
             }
         }
-        OPENVINO_ASSERT(m_blocks.count(hash) == 0);
-        m_blocks[hash] = blocks_for_all_layers;
+        auto [it, is_inserted] = m_blocks.try_emplace(hash);
+        OPENVINO_ASSERT(is_inserted);
+        it->second.blocks = std::move(blocks_for_all_layers);
+        _link_back(it->second);
     }
 
+    /**
+     * Marks the blocks stored under the hash as the most recently used ones, postponing their overwriting.
+     * @param hash The hash value to look up in the store.
+     * @return Whether the hash is present in the store.
+     */
+    bool touch(size_t hash) {
+        auto it = m_blocks.find(hash);
+        if (it == m_blocks.end()) {
+            return false;
+        }
+        _unlink(it->second);
+        _link_back(it->second);
+        return true;
+    }
 
     /**
       * Retrieves KV cache blocks from storage by their hash (expected to be identical for all layers) for their contents
@@ -121,35 +183,20 @@ class OverwritableBlocksHashStore {
         {
             return {};
         }
-        BlocksPerLayer blocks_for_all_layers = it->second;
-        for (auto& block_ptr : blocks_for_all_layers) {
-
-            block_ptr->set_timestamp(std::chrono::steady_clock::now());
-            block_ptr->increment();
-        }
-        m_blocks.erase(it);
-        return blocks_for_all_layers;
+        return _pop(it);
     }
 
     /**
      * Pops the least recently used blocks from the store to be used and overwritten by another sequence.
      * Returned blocks will have reference counters equal to 1.
-     * @return A vector of KV cache blocks (one for each decoder layer) that has least recently been added to the store
-     * based on the timestamp.
+     * @return A vector of KV cache blocks (one for each decoder layer) that has least recently been added to
+     * (or touched in) the store.
      */
     BlocksPerLayer get_lru_block_to_overwrite() {
-        if (m_blocks.empty()) {
+        if (m_lru_head == nullptr) {
             return {};
         }
-        auto hash_and_blocks_for_all_layers = std::min_element(std::begin(m_blocks), std::end(m_blocks), [](const auto& lhs, const auto& rhs) -> bool { return lhs.second[0]->get_timestamp() < rhs.second[0]->get_timestamp(); });
-        auto blocks_for_all_layers = hash_and_blocks_for_all_layers->second;
-        auto timestamp = std::chrono::steady_clock::now();
-        for (auto& block_ptr : blocks_for_all_layers) {
-            block_ptr->set_timestamp(timestamp);
-            block_ptr->increment();
-        }
-        m_blocks.erase(hash_and_blocks_for_all_layers->first);
-        return blocks_for_all_layers;
+        return _pop(m_blocks.find(m_lru_head->blocks[0]->get_hash()));
     }
 
     /**
@@ -172,7 +219,8 @@ class OverwritableBlocksHashStore {
         for (uint64_t hash : hashes_to_discard) {
             auto it = m_blocks.find(hash);
             if (it != m_blocks.end()) {
-                retval.push_back(it->second);
+                _unlink(it->second);
+                retval.push_back(std::move(it->second.blocks));
                 m_blocks.erase(it);
             }
         }
@@ -181,6 +229,7 @@ class OverwritableBlocksHashStore {
 
     void clear() {
         m_blocks.clear();
+        m_lru_head = m_lru_tail = nullptr;
     }
 };
 
@@ -539,6 +588,14 @@ class BlockManager {
     // the same block can be seen in multiple block_tables for different sequences
     std::map<uint64_t, std::vector<BlocksPerLayer>> m_block_table;
 
+    // host-side pool of KV cache blocks used to swap out preempted sequences
+    size_t m_num_swap_blocks = 0;
+    std::list<size_t> m_free_swap_blocks;
+    // reference counters for each host block, since swapped out sequences (e.g. beams) can share blocks
+    std::vector<size_t> m_swap_block_ref_counts;
+    // stores host blocks for each swapped out sequence; a single host block hosts a logical block for all layers
+    std::map<uint64_t, std::vector<size_t>> m_swapped_block_table;
+
     std::mutex m_cached_blocks_map_mutex;
 public:
     /**
@@ -549,16 +606,21 @@ public:
      * @param block_size The size of an individual KV cache block in tokens.
      * @param num_layers The number of separate attention layers with KV caches in the LLM associated with the pipeline.
      * In current implementation each layer must have the same number of logical blocks allocated at all times.
+     * @param num_swap_blocks The number of host-side KV cache blocks available for swapping out preempted sequences.
      */
-    BlockManager(int num_blocks, bool enable_prefix_caching, size_t block_size, size_t num_layers = 1)
+    BlockManager(int num_blocks, bool enable_prefix_caching, size_t block_size, size_t num_layers = 1, size_t num_swap_blocks = 0)
         : m_allocator(num_blocks, enable_prefix_caching, num_layers), m_enable_prefix_caching(enable_prefix_caching), m_block_size(block_size),
-        m_num_layers(num_layers) {
+        m_num_layers(num_layers), m_num_swap_blocks(num_swap_blocks), m_swap_block_ref_counts(num_swap_blocks, 0) {
         OPENVINO_ASSERT(num_layers != 0, "num_layers must be non-zero");
+        for (size_t swap_block_id = 0; swap_block_id < m_num_swap_blocks; ++swap_block_id) {
+            m_free_swap_blocks.push_back(swap_block_id);
+        }
     }
 
     ~BlockManager() {
         // sanity check that all sequences are freed
         OPENVINO_ASSERT(m_block_table.empty());
+        OPENVINO_ASSERT(m_swapped_block_table.empty());
     }
 
     /**
@@ -681,11 +743,11 @@ public:
 
     /**
      * @param seq_id The identifier of an ov::genai::Sequence
-     * @return Whether or not this BlockManager is managing this sequence group.
+     * @return Whether or not this BlockManager is managing this sequence group, either in device or in swap memory.
      */
     const bool has_block_table(uint64_t seq_id) {
         std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
-        return m_block_table.count(seq_id) > 0;
+        return m_block_table.count(seq_id) > 0 || m_swapped_block_table.count(seq_id) > 0;
     }
 
     /**
@@ -817,6 +879,14 @@ public:
      */
     void free_sequence(size_t seq_id) {
         std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        auto swapped_it = m_swapped_block_table.find(seq_id);
+        if (swapped_it != m_swapped_block_table.end()) {
+            for (size_t swap_block_id : swapped_it->second) {
+                _release_swap_block(swap_block_id);
+            }
+            m_swapped_block_table.erase(swapped_it);
+            return;
+        }
         OPENVINO_ASSERT(m_block_table.find(seq_id) != m_block_table.end(), "sequence with id ", seq_id,
                         " not found in BlockManager, but requested to free");
         auto& block_table = m_block_table[seq_id];
@@ -1017,6 +1087,10 @@ public:
         }
         for (const auto& sequence : seq_group->get_running_sequences()) {
             auto seq_id = sequence->get_id();
+            if (m_swapped_block_table.count(seq_id) > 0) {
+                // swapped out sequences do not occupy any physical blocks
+                continue;
+            }
             auto& block_table = m_block_table[seq_id];
             size_t num_physical_blocks = block_table[0].size();
             if (num_physical_blocks > num_logical_blocks) {
@@ -1108,6 +1182,197 @@ public:
         return copy_blocks_map;
     }
 
+    /**
+     * @return The number of host-side KV cache blocks available for swapping out sequences.
+     */
+    size_t num_free_swap_blocks() const {
+        return m_free_swap_blocks.size();
+    }
+
+    /**
+     * @param seq_group Pointer to a sequence group.
+     * @return Whether the sequences of the group are currently swapped out to the host-side blocks.
+     */
+    bool is_swapped_out(SequenceGroup::CPtr seq_group) {
+        std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        for (const auto& sequence : seq_group->get_sequences()) {
+            if (m_swapped_block_table.count(sequence->get_id()) > 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @param seq_group Pointer to a sequence group.
+     * @return Whether there are enough host-side blocks to swap out all of the physical blocks occupied by the group.
+     */
+    bool can_swap_out(SequenceGroup::Ptr seq_group) {
+        if (m_enable_prefix_caching || m_num_swap_blocks == 0) {
+            return false;
+        }
+        size_t num_occupied_blocks = get_number_of_blocks_occupied_by_sequence(seq_group);
+        return num_occupied_blocks > 0 && num_occupied_blocks <= num_free_swap_blocks();
+    }
+
+    /**
+     * Moves all sequences of a group to the host-side blocks and frees their physical KV cache blocks.
+     * Blocks shared between sequences of the group are swapped out only once.
+     * @param seq_group Pointer to a sequence group.
+     * @return Per-layer maps of *physical* block indices to the host block indices into which the block contents
+     * should be copied by the CacheManager. Contains a single map if all layers share the block layout.
+     */
+    std::vector<std::map<size_t, size_t>> swap_out(SequenceGroup::Ptr seq_group) {
+        std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        OPENVINO_ASSERT(!m_enable_prefix_caching, "Swapping is not supported together with prefix caching");
+
+        std::vector<std::map<size_t, size_t>> swap_out_map(m_num_layers);
+        // shared physical blocks are detected by the block index of the first layer
+        std::map<size_t, size_t> physical_to_swap_block;
+        for (const auto& sequence : seq_group->get_not_finished_sequences()) {
+            auto seq_id = sequence->get_id();
+            auto block_table_it = m_block_table.find(seq_id);
+            if (block_table_it == m_block_table.end()) {
+                continue;
+            }
+            auto& block_table = block_table_it->second;
+            size_t num_blocks = block_table[0].size();
+            std::vector<size_t> swapped_blocks;
+            swapped_blocks.reserve(num_blocks);
+            for (size_t block_idx = 0; block_idx < num_blocks; ++block_idx) {
+                size_t physical_block_id = block_table[0][block_idx]->get_index();
+                auto it = physical_to_swap_block.find(physical_block_id);
+                size_t swap_block_id;
+                if (it == physical_to_swap_block.end()) {
+                    OPENVINO_ASSERT(!m_free_swap_blocks.empty(), "Not enough swap blocks to swap out sequence ", seq_id);
+                    swap_block_id = m_free_swap_blocks.front();
+                    m_free_swap_blocks.pop_front();
+                    physical_to_swap_block[physical_block_id] = swap_block_id;
+                    for (size_t layer_idx = 0; layer_idx < m_num_layers; ++layer_idx) {
+                        swap_out_map[layer_idx][block_table[layer_idx][block_idx]->get_index()] = swap_block_id;
+                    }
+                } else {
+                    swap_block_id = it->second;
+                }
+                ++m_swap_block_ref_counts[swap_block_id];
+                swapped_blocks.push_back(swap_block_id);
+
+                BlocksPerLayer blocks_to_free;
+                blocks_to_free.reserve(m_num_layers);
+                for (size_t layer_idx = 0; layer_idx < m_num_layers; ++layer_idx) {
+                    blocks_to_free.push_back(block_table[layer_idx][block_idx]);
+                }
+                m_allocator.free(blocks_to_free, m_prefix_hash_to_occupied_block_map);
+            }
+            m_block_table.erase(block_table_it);
+            m_swapped_block_table[seq_id] = std::move(swapped_blocks);
+        }
+        return swap_out_map;
+    }
+
+    /**
+     * @param seq_group Pointer to a swapped out sequence group.
+     * @return The number of physical blocks required to swap the group back in.
+     */
+    size_t required_blocks_to_swap_in(SequenceGroup::CPtr seq_group) {
+        std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        std::set<size_t> swap_blocks;
+        for (const auto& sequence : seq_group->get_sequences()) {
+            auto it = m_swapped_block_table.find(sequence->get_id());
+            if (it != m_swapped_block_table.end()) {
+                swap_blocks.insert(it->second.begin(), it->second.end());
+            }
+        }
+        return swap_blocks.size();
+    }
+
+    /**
+     * Allocates physical KV cache blocks for a swapped out sequence group and releases its host-side blocks.
+     * Host blocks shared between sequences of the group are restored to shared physical blocks.
+     * @param seq_group Pointer to a swapped out sequence group.
+     * @return Per-layer maps of host block indices to the *physical* block indices into which the block contents
+     * should be copied by the CacheManager.
+     */
+    std::vector<std::map<size_t, size_t>> swap_in(SequenceGroup::Ptr seq_group) {
+        OPENVINO_ASSERT(can_allocate_blocks(required_blocks_to_swap_in(seq_group)));
+        std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+
+        std::vector<std::map<size_t, size_t>> swap_in_map(m_num_layers);
+        std::map<size_t, BlocksPerLayer> swap_to_physical_blocks;
+        for (const auto& sequence : seq_group->get_not_finished_sequences()) {
+            auto seq_id = sequence->get_id();
+            auto swapped_it = m_swapped_block_table.find(seq_id);
+            if (swapped_it == m_swapped_block_table.end()) {
+                continue;
+            }
+            auto& block_table = m_block_table[seq_id];
+            block_table.resize(m_num_layers);
+            for (size_t swap_block_id : swapped_it->second) {
+                auto it = swap_to_physical_blocks.find(swap_block_id);
+                if (it == swap_to_physical_blocks.end()) {
+                    BlocksPerLayer blocks_for_all_layers = m_allocator.allocate_block();
+                    for (size_t layer_idx = 0; layer_idx < m_num_layers; ++layer_idx) {
+                        swap_in_map[layer_idx][swap_block_id] = blocks_for_all_layers[layer_idx]->get_index();
+                    }
+                    it = swap_to_physical_blocks.emplace(swap_block_id, std::move(blocks_for_all_layers)).first;
+                } else {
+                    for (auto& block : it->second) {
+                        block->increment();
+                    }
+                }
+                for (size_t layer_idx = 0; layer_idx < m_num_layers; ++layer_idx) {
+                    block_table[layer_idx].push_back(it->second[layer_idx]);
+                }
+                _release_swap_block(swap_block_id);
+            }
+            m_swapped_block_table.erase(swapped_it);
+        }
+        return swap_in_map;
+    }
+
+    /**
+     * Appends a block with the given prefix hash to the block table of the sequence if such a block is present among the cached blocks.
+     * @param sequence The sequence whose block table is extended.
+     * @param hash The prefix hash of the block.
+     * @return Whether the block was found and appended.
+     */
+    bool append_cached_block(Sequence::Ptr sequence, size_t hash) {
+        const std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        auto blocks = m_allocator.get_cached_block(hash, m_prefix_hash_to_occupied_block_map);
+        if (blocks.empty()) {
+            return false;
+        }
+        auto& block_table = m_block_table[sequence->get_id()];
+        block_table.resize(m_num_layers);
+        auto timestamp = std::chrono::steady_clock::now();
+        for (size_t layer_idx = 0; layer_idx < m_num_layers; layer_idx++) {
+            blocks[layer_idx]->set_timestamp(timestamp);
+            block_table[layer_idx].push_back(blocks[layer_idx]);
+        }
+        return true;
+    }
+
+    /**
+     * Allocates a block under the given prefix hash and appends it to the block table of the sequence. The contents of the block
+     * are expected to be filled by the caller from an external store (e.g. the persistent prefix cache) before the next inference.
+     * @param sequence The sequence whose block table is extended.
+     * @param hash The prefix hash of the block.
+     * @return The allocated blocks (one for each layer).
+     */
+    BlocksPerLayer append_block_to_restore(Sequence::Ptr sequence, size_t hash) {
+        const std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        OPENVINO_ASSERT(m_enable_prefix_caching);
+        auto blocks = m_allocator.allocate_block(hash, m_prefix_hash_to_occupied_block_map);
+        auto& block_table = m_block_table[sequence->get_id()];
+        block_table.resize(m_num_layers);
+        auto timestamp = std::chrono::steady_clock::now();
+        for (size_t layer_idx = 0; layer_idx < m_num_layers; layer_idx++) {
+            blocks[layer_idx]->set_timestamp(timestamp);
+            block_table[layer_idx].push_back(blocks[layer_idx]);
+        }
+        return blocks;
+    }
+
     void restore_cached_blocks(SequenceGroup::Ptr group) {
         // When add_request() is executed in multiple threads accessing to cached_blocks causes segfault.
         // The mutex is needed to prevent such segfaults.
@@ -1176,6 +1441,15 @@ public:
 
         // Block tables should be cleared when generation is finished
         OPENVINO_ASSERT(m_block_table.empty());
+        OPENVINO_ASSERT(m_swapped_block_table.empty());
+    }
+
+private:
+    void _release_swap_block(size_t swap_block_id) {
+        OPENVINO_ASSERT(m_swap_block_ref_counts[swap_block_id] > 0);
+        if (--m_swap_block_ref_counts[swap_block_id] == 0) {
+            m_free_swap_blocks.push_back(swap_block_id);
+        }
     }
 };
 
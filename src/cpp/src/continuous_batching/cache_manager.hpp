@@ -5,6 +5,7 @@
 
 #include <vector>
 #include <list>
+#include <sstream>
 
 #include "openvino/runtime/tensor.hpp"
 #include "utils.hpp"
@@ -17,7 +18,9 @@ class CacheManager {
     std::vector<ov::element::Type> m_key_precisions, m_value_precisions;
     std::vector<ov::PartialShape> m_key_shapes, m_value_shapes;
     std::vector<ov::Tensor> m_key_cache, m_value_cache;
-    size_t m_num_allocated_kv_blocks = 0, m_block_size_in_bytes = 0;
+    // host-side copies of KV cache blocks for swapped out sequences
+    std::vector<ov::Tensor> m_swap_key_cache, m_swap_value_cache;
+    size_t m_num_allocated_kv_blocks = 0, m_num_allocated_swap_blocks = 0, m_block_size_in_bytes = 0;
     ov::InferRequest m_request;
     ov::RemoteContext m_context;
 
@@ -26,6 +29,74 @@ class CacheManager {
         return pshape.get_shape();
     }
 
+    static void copy_block_between_tensors(ov::Tensor& dst, size_t dst_block_id, const ov::Tensor& src, size_t src_block_id) {
+        if (dst.is<ov::RemoteTensor>() || src.is<ov::RemoteTensor>()) {
+            ov::Coordinate src_start_roi(src.get_shape().size(), 0), src_end_roi = src.get_shape();
+            ov::Coordinate dst_start_roi(dst.get_shape().size(), 0), dst_end_roi = dst.get_shape();
+            src_end_roi[0] = (src_start_roi[0] = src_block_id) + 1;
+            dst_end_roi[0] = (dst_start_roi[0] = dst_block_id) + 1;
+            if (dst.is<ov::RemoteTensor>()) {
+                ov::RemoteTensor dst_roi(dst, dst_start_roi, dst_end_roi);
+                dst_roi.copy_from(ov::Tensor(src, src_start_roi, src_end_roi));
+            } else {
+                ov::RemoteTensor src_roi(src, src_start_roi, src_end_roi);
+                ov::Tensor dst_roi(dst, dst_start_roi, dst_end_roi);
+                src_roi.copy_to(dst_roi);
+            }
+            return;
+        }
+        // works for sub-byte precisions as well, since a single block always occupies a whole number of bytes
+        const size_t block_byte_size = src.get_byte_size() / src.get_shape()[0];
+        OPENVINO_ASSERT(block_byte_size == dst.get_byte_size() / dst.get_shape()[0], "Copied KV cache blocks must have the same size");
+        OPENVINO_SUPPRESS_DEPRECATED_START
+        const uint8_t* src_ptr = reinterpret_cast<const uint8_t*>(src.data()) + src_block_id * block_byte_size;
+        uint8_t* dst_ptr = reinterpret_cast<uint8_t*>(dst.data()) + dst_block_id * block_byte_size;
+        OPENVINO_SUPPRESS_DEPRECATED_END
+        std::memcpy(dst_ptr, src_ptr, block_byte_size);
+    }
+
+    void swap_blocks(const std::vector<std::map<size_t, size_t>>& block_maps, bool to_host) {
+        if (block_maps.empty()) {
+            return;
+        }
+        OPENVINO_ASSERT(block_maps.size() == 1 || block_maps.size() == m_num_decoder_layers,
+                        "Swap block maps must be provided either for a single layer or for each decoder layer");
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            const auto& block_map = block_maps.size() == 1 ? block_maps[0] : block_maps[decoder_layer_id];
+            for (const auto& [src_block_id, dst_block_id] : block_map) {
+                if (to_host) {
+                    OPENVINO_ASSERT(src_block_id < m_num_allocated_kv_blocks && dst_block_id < m_num_allocated_swap_blocks);
+                    copy_block_between_tensors(m_swap_key_cache[decoder_layer_id], dst_block_id, m_key_cache[decoder_layer_id], src_block_id);
+                    copy_block_between_tensors(m_swap_value_cache[decoder_layer_id], dst_block_id, m_value_cache[decoder_layer_id], src_block_id);
+                } else {
+                    OPENVINO_ASSERT(src_block_id < m_num_allocated_swap_blocks && dst_block_id < m_num_allocated_kv_blocks);
+                    copy_block_between_tensors(m_key_cache[decoder_layer_id], dst_block_id, m_swap_key_cache[decoder_layer_id], src_block_id);
+                    copy_block_between_tensors(m_value_cache[decoder_layer_id], dst_block_id, m_swap_value_cache[decoder_layer_id], src_block_id);
+                }
+            }
+        }
+    }
+
+    void transfer_block_data(const std::vector<size_t>& block_ids, uint8_t* data, bool to_buffer) {
+        OPENVINO_ASSERT(block_ids.size() == 1 || block_ids.size() == m_num_decoder_layers,
+                        "Block indices must be provided either for a single layer or for each decoder layer");
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            size_t block_id = block_ids.size() == 1 ? block_ids[0] : block_ids[decoder_layer_id];
+            OPENVINO_ASSERT(block_id < m_num_allocated_kv_blocks);
+            ov::Tensor key_block(get_key_cache_precision(decoder_layer_id), set_kv_blocks(m_key_shapes[decoder_layer_id], 1), data);
+            data += key_block.get_byte_size();
+            ov::Tensor value_block(get_value_cache_precision(decoder_layer_id), set_kv_blocks(m_value_shapes[decoder_layer_id], 1), data);
+            data += value_block.get_byte_size();
+            if (to_buffer) {
+                copy_block_between_tensors(key_block, 0, m_key_cache[decoder_layer_id], block_id);
+                copy_block_between_tensors(value_block, 0, m_value_cache[decoder_layer_id], block_id);
+            } else {
+                copy_block_between_tensors(m_key_cache[decoder_layer_id], block_id, key_block, 0);
+                copy_block_between_tensors(m_value_cache[decoder_layer_id], block_id, value_block, 0);
+            }
+        }
+    }
+
     void update_request_tensor(size_t decoder_layer_id) {
         m_request.set_tensor(std::string("key_cache.") + std::to_string(decoder_layer_id), m_key_cache[decoder_layer_id]);
         m_request.set_tensor(std::string("value_cache.") + std::to_string(decoder_layer_id), m_value_cache[decoder_layer_id]);
@@ -301,12 +372,103 @@ public:
         }
     }
 
+    /**
+     * Allocates host memory for the swapped out KV cache blocks. The swap cache is allocated once in full, since
+     * its contents are owned by preempted sequences and cannot be moved.
+     * @param num_swap_blocks The number of host-side KV cache blocks.
+     */
+    void allocate_swap_cache_if_needed(size_t num_swap_blocks) {
+        if (m_num_allocated_swap_blocks >= num_swap_blocks) {
+            return;
+        }
+        OPENVINO_ASSERT(m_num_allocated_swap_blocks == 0, "Swap cache cannot be resized after allocation");
+        m_swap_key_cache.clear();
+        m_swap_value_cache.clear();
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            m_swap_key_cache.emplace_back(get_key_cache_precision(decoder_layer_id), set_kv_blocks(m_key_shapes[decoder_layer_id], num_swap_blocks));
+            m_swap_value_cache.emplace_back(get_value_cache_precision(decoder_layer_id), set_kv_blocks(m_value_shapes[decoder_layer_id], num_swap_blocks));
+        }
+        m_num_allocated_swap_blocks = num_swap_blocks;
+    }
+
+    /**
+     * Copies KV cache blocks of preempted sequences to host memory.
+     * @param swap_out_map Per-layer (or a single, shared by all layers) maps of physical block indices to host block indices.
+     */
+    void swap_out_blocks(const std::vector<std::map<size_t, size_t>>& swap_out_map) {
+        swap_blocks(swap_out_map, /* to_host = */ true);
+    }
+
+    /**
+     * Copies KV cache blocks of resumed sequences from host memory back to the inference device.
+     * @param swap_in_map Per-layer (or a single, shared by all layers) maps of host block indices to physical block indices.
+     */
+    void swap_in_blocks(const std::vector<std::map<size_t, size_t>>& swap_in_map) {
+        swap_blocks(swap_in_map, /* to_host = */ false);
+    }
+
+    /**
+     * @return Size in bytes of the contents of a single KV cache block over all decoder layers, as produced by `export_block`.
+     */
+    size_t get_block_data_byte_size() const {
+        size_t byte_size = 0;
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            byte_size += (ov::shape_size(set_kv_blocks(m_key_shapes[decoder_layer_id], 1)) * m_key_precisions[decoder_layer_id].bitwidth() + 7) / 8;
+            byte_size += (ov::shape_size(set_kv_blocks(m_value_shapes[decoder_layer_id], 1)) * m_value_precisions[decoder_layer_id].bitwidth() + 7) / 8;
+        }
+        return byte_size;
+    }
+
+    /**
+     * @return A fingerprint of the KV cache layout (block size, per-layer precisions and shapes). Block contents exported
+     * from a cache with a different fingerprint cannot be imported.
+     */
+    uint64_t get_layout_hash() const {
+        std::stringstream layout;
+        layout << m_block_size;
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            layout << ';' << m_key_precisions[decoder_layer_id] << m_key_shapes[decoder_layer_id]
+                   << ';' << m_value_precisions[decoder_layer_id] << m_value_shapes[decoder_layer_id];
+        }
+        return std::hash<std::string>{}(layout.str());
+    }
+
+    /**
+     * Copies the contents of a KV cache block into a contiguous host buffer, K and V interleaved layer by layer.
+     * @param block_ids Per-layer (or a single, shared by all layers) physical block indices.
+     * @param data Buffer to receive the contents, resized to `get_block_data_byte_size()`.
+     */
+    void export_block(const std::vector<size_t>& block_ids, std::vector<uint8_t>& data) {
+        data.resize(get_block_data_byte_size());
+        export_block(block_ids, data.data());
+    }
+
+    /**
+     * Same as above, but writes the contents to a caller-provided buffer of at least `get_block_data_byte_size()` bytes.
+     */
+    void export_block(const std::vector<size_t>& block_ids, uint8_t* data) {
+        transfer_block_data(block_ids, data, /* to_buffer = */ true);
+    }
+
+    /**
+     * Fills a KV cache block with the contents previously produced by `export_block`.
+     * @param block_ids Per-layer (or a single, shared by all layers) physical block indices.
+     * @param data Block contents.
+     */
+    void import_block(const std::vector<size_t>& block_ids, std::vector<uint8_t>& data) {
+        OPENVINO_ASSERT(data.size() == get_block_data_byte_size(), "Unexpected size of the KV cache block contents");
+        transfer_block_data(block_ids, data.data(), /* to_buffer = */ false);
+    }
+
     void clear() {
         for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
             m_key_cache[decoder_layer_id] = ov::Tensor();
             m_value_cache[decoder_layer_id] = ov::Tensor();
         }
         m_num_allocated_kv_blocks = 0;
+        m_swap_key_cache.clear();
+        m_swap_value_cache.clear();
+        m_num_allocated_swap_blocks = 0;
     }
 };
 
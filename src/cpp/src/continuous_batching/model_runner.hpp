@@ -230,6 +230,9 @@ class ModelRunner {
 
     std::shared_ptr<InputsEmbedder> m_inputs_embedder;
 
+    // LoRA adapter slot of each scheduled request, empty if adapters are not selected per request
+    std::map<uint64_t, size_t> m_adapter_slots;
+
     // Cached pre-allocated tensors to avoid CPU->GPU copy
     ov::Tensor m_cached_input_ids;
     ov::Tensor m_cached_inputs_embeds;
@@ -242,6 +245,7 @@ class ModelRunner {
     ov::Tensor m_cached_token_type_ids;
     ov::Tensor m_cached_deepstack_visual_embeds;
     ov::Tensor m_cached_visual_pos_masks;
+    ov::Tensor m_cached_lora_adapter_ids;
 public:
     /**
      * Constructs the ModelRunner.
@@ -328,6 +332,15 @@ public:
         m_initial_hidden_states[request_id] = hidden_state;
     }
 
+    /**
+     * Sets LoRA adapter slots to be passed to the model via `lora_adapter_ids` input during the next `forward` calls.
+     * @param adapter_slots A map of request IDs to adapter slots configured by AdapterController::apply_per_request. Requests
+     * missing in the map use slot 0.
+     */
+    void set_adapter_slots(std::map<uint64_t, size_t>&& adapter_slots) {
+        m_adapter_slots = std::move(adapter_slots);
+    }
+
     /**
      * Runs the forward inference call on the underlying LLM's ov::InferRequest, scheduling for inferencing tokens for given sequences
      * taking into account the supplied scheduler output struct.
@@ -336,6 +349,46 @@ public:
      * @return An ov::Tensor with next-token logit scores for each sequence processed during this `forward` call.
      */
     ov::Tensor forward(const std::vector<SequenceGroup::Ptr> & sequence_groups, const Scheduler::Output& scheduler_output) {
+        _fill_inputs(sequence_groups, scheduler_output);
+        {
+            static thread_local ManualTimer timer("pure generate inference");
+            timer.start();
+            m_request.infer();
+            timer.end();
+        }
+        return _process_outputs(sequence_groups, scheduler_output);
+    }
+
+    /**
+     * Fills the model inputs in the same way as `forward` does and starts the inference asynchronously, so that the caller may perform
+     * host-side work independent of this inference's results in the meantime. Must be followed by a `wait_forward` call with the same arguments
+     * before the sequence groups or the KV cache are modified.
+     * @param sequence_groups A vector of pointers to sequence groups to be processed during this inference
+     * @param scheduler_output The scheduler output struct with information on the specifics of the token scheduling during this inference
+     */
+    void start_forward(const std::vector<SequenceGroup::Ptr> & sequence_groups, const Scheduler::Output& scheduler_output) {
+        _fill_inputs(sequence_groups, scheduler_output);
+        m_request.start_async();
+    }
+
+    /**
+     * Waits for the inference started by `start_forward` to finish.
+     * @param sequence_groups The sequence groups passed to `start_forward`; new groups may only be appended to the vector in between
+     * @param scheduler_output The scheduler output struct passed to `start_forward`
+     * @return An ov::Tensor with next-token logit scores for each sequence processed during this inference.
+     */
+    ov::Tensor wait_forward(const std::vector<SequenceGroup::Ptr> & sequence_groups, const Scheduler::Output& scheduler_output) {
+        {
+            static thread_local ManualTimer timer("pure generate inference wait");
+            timer.start();
+            m_request.wait();
+            timer.end();
+        }
+        return _process_outputs(sequence_groups, scheduler_output);
+    }
+
+private:
+    void _fill_inputs(const std::vector<SequenceGroup::Ptr> & sequence_groups, const Scheduler::Output& scheduler_output) {
         m_sequence_hidden_state_mapping.clear();
         size_t num_sequence_groups = scheduler_output.m_scheduled_sequence_groups_ids.size();
 
@@ -388,6 +441,13 @@ public:
         ov::Tensor score_aggregation_window = _get_or_resize_tensor(m_cached_score_aggregation_window, "score_aggregation_window",
             {batch_size_in_sequences}, ov::element::i32);
 
+        ov::Tensor lora_adapter_ids;
+        int32_t* lora_adapter_ids_data = nullptr;
+        if (!m_adapter_slots.empty()) {
+            lora_adapter_ids = _get_or_resize_tensor(m_cached_lora_adapter_ids, "lora_adapter_ids", {total_num_tokens}, ov::element::i32);
+            lora_adapter_ids_data = lora_adapter_ids.data<int32_t>();
+        }
+
         ov::Tensor hidden_state_input = _prepare_hidden_state_input(total_num_tokens, hidden_size);
         float* hidden_state_data = nullptr;
         if (hidden_state_input) {
@@ -484,6 +544,14 @@ public:
             const bool sampling_is_required = sequence_group->requires_sampling();
             const size_t tokens_to_sample_per_sequence = 1 + sequence_group->get_num_tokens_to_validate();
 
+            int32_t adapter_slot = 0;
+            if (lora_adapter_ids_data) {
+                auto adapter_slot_it = m_adapter_slots.find(sequence_group->get_request_id());
+                if (adapter_slot_it != m_adapter_slots.end()) {
+                    adapter_slot = static_cast<int32_t>(adapter_slot_it->second);
+                }
+            }
+
             if (sequence_group_type == SequenceGroupType::EMBEDDINGS 
                 && deepstack_context.have_deepstack_visual_inputs
             ) {
@@ -634,6 +702,10 @@ public:
                     }
                 }
 
+                if (lora_adapter_ids_data) {
+                    std::fill_n(lora_adapter_ids_data + current_token_idx, num_scheduled_tokens, adapter_slot);
+                }
+
                 if (m_is_aggregate_attention_scores) {
                     size_t seq_id = sequence->get_id();
                     auto it = scheduler_output.m_score_aggregation_windows.find(seq_id);
@@ -684,6 +756,9 @@ public:
         if (hidden_state_input && hidden_state_input.get_size() > 0) {
             m_request.set_tensor("hidden_states", hidden_state_input);
         }
+        if (lora_adapter_ids && !m_cached_lora_adapter_ids) {
+            m_request.set_tensor("lora_adapter_ids", lora_adapter_ids);
+        }
         if (position_ids.get_shape().size() == 3 && position_ids.get_shape()[0] == 3 &&
             position_ids.get_shape()[1] == 1) {
             // M-RoPE: squeeze pseudo-batch dim [3, 1, total_token_num] -> [3, total_token_num]
@@ -733,13 +808,10 @@ public:
         if (m_is_aggregate_attention_scores && !m_cached_score_aggregation_window) {
             m_request.set_tensor("score_aggregation_window", score_aggregation_window);
         }
+    }
 
-        {
-            static ManualTimer timer("pure generate inference");
-            timer.start();
-            m_request.infer();
-            timer.end();
-        }
+    ov::Tensor _process_outputs(const std::vector<SequenceGroup::Ptr> & sequence_groups, const Scheduler::Output& scheduler_output) {
+        size_t num_sequence_groups = scheduler_output.m_scheduled_sequence_groups_ids.size();
 
         if (m_collect_attention_scores) {
             _collect_attention_scores(sequence_groups, scheduler_output);
@@ -768,6 +840,7 @@ public:
         return m_request.get_tensor("logits");
     }
 
+public:
     void append_embeddings(const std::vector<SequenceGroup::Ptr> & sequence_groups, const Scheduler::Output& scheduler_output) {
         size_t num_sequence_groups = scheduler_output.m_scheduled_sequence_groups_ids.size();
         size_t num_generated_ids_without_embeddings = 0;
@@ -0,0 +1,203 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "continuous_batching/persistent_block_store.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "openvino/core/except.hpp"
+
+namespace ov::genai {
+
+namespace {
+constexpr char STORE_MAGIC[8] = {'O', 'V', 'G', 'A', 'I', 'K', 'V', 'S'};
+constexpr uint64_t STORE_VERSION = 2;
+}
+
+PersistentBlockStore::PersistentBlockStore(const std::filesystem::path& path, size_t max_size_in_bytes, size_t block_byte_size, uint64_t layout_hash, uint64_t model_hash) :
+    m_path(path), m_block_byte_size(block_byte_size), m_layout_hash(layout_hash), m_model_hash(model_hash) {
+    OPENVINO_ASSERT(m_block_byte_size > 0, "Block byte size for the persistent prefix cache must be positive");
+    m_slots.resize(max_size_in_bytes / m_block_byte_size);
+
+    if (!_load()) {
+        _initialize();
+    }
+}
+
+PersistentBlockStore::~PersistentBlockStore() {
+    if (m_file.is_open()) {
+        m_file.flush();
+    }
+}
+
+uint64_t PersistentBlockStore::checksum(const uint8_t* data, size_t size) {
+    // FNV-1a
+    uint64_t result = 14695981039346656037ULL;
+    for (size_t i = 0; i < size; ++i) {
+        result ^= data[i];
+        result *= 1099511628211ULL;
+    }
+    return result;
+}
+
+bool PersistentBlockStore::_load() {
+    if (!std::filesystem::exists(m_path)) {
+        return false;
+    }
+    m_file.open(m_path, std::ios::in | std::ios::out | std::ios::binary);
+    if (!m_file.is_open()) {
+        return false;
+    }
+
+    Header header;
+    if (!m_file.read(reinterpret_cast<char*>(&header), sizeof(Header)) ||
+        std::memcmp(header.magic, STORE_MAGIC, sizeof(STORE_MAGIC)) != 0 ||
+        header.version != STORE_VERSION ||
+        header.layout_hash != m_layout_hash ||
+        header.model_hash != m_model_hash ||
+        header.block_byte_size != m_block_byte_size ||
+        header.num_slots != m_slots.size()) {
+        m_file.close();
+        return false;
+    }
+
+    if (!m_slots.empty() && !m_file.read(reinterpret_cast<char*>(m_slots.data()), m_slots.size() * sizeof(SlotEntry))) {
+        m_file.close();
+        return false;
+    }
+
+    std::vector<size_t> valid_slots;
+    for (size_t slot = 0; slot < m_slots.size(); ++slot) {
+        if (m_slots[slot].is_valid && m_hash_to_slot.find(m_slots[slot].hash) == m_hash_to_slot.end()) {
+            valid_slots.push_back(slot);
+            m_hash_to_slot[m_slots[slot].hash] = IndexEntry{slot, {}};
+        } else {
+            m_slots[slot].is_valid = 0;
+        }
+    }
+
+    std::sort(valid_slots.begin(), valid_slots.end(), [this](size_t lhs, size_t rhs) {
+        return m_slots[lhs].last_access < m_slots[rhs].last_access;
+    });
+    for (size_t slot : valid_slots) {
+        m_lru_slots.push_back(slot);
+        m_hash_to_slot[m_slots[slot].hash].lru_it = std::prev(m_lru_slots.end());
+        m_access_counter = std::max(m_access_counter, m_slots[slot].last_access + 1);
+    }
+
+    for (size_t slot = m_slots.size(); slot > 0; --slot) {
+        if (!m_slots[slot - 1].is_valid) {
+            m_free_slots.push_back(slot - 1);
+        }
+    }
+    return true;
+}
+
+void PersistentBlockStore::_initialize() {
+    m_file.open(m_path, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+    OPENVINO_ASSERT(m_file.is_open(), "Failed to open the persistent prefix cache file ", m_path.string());
+
+    Header header;
+    std::memcpy(header.magic, STORE_MAGIC, sizeof(STORE_MAGIC));
+    header.version = STORE_VERSION;
+    header.layout_hash = m_layout_hash;
+    header.model_hash = m_model_hash;
+    header.block_byte_size = m_block_byte_size;
+    header.num_slots = m_slots.size();
+    m_file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+
+    std::fill(m_slots.begin(), m_slots.end(), SlotEntry{0, 0, 0, 0});
+    m_file.write(reinterpret_cast<const char*>(m_slots.data()), m_slots.size() * sizeof(SlotEntry));
+    m_file.flush();
+    OPENVINO_ASSERT(m_file.good(), "Failed to initialize the persistent prefix cache file ", m_path.string());
+
+    m_hash_to_slot.clear();
+    m_lru_slots.clear();
+    m_free_slots.clear();
+    for (size_t slot = m_slots.size(); slot > 0; --slot) {
+        m_free_slots.push_back(slot - 1);
+    }
+}
+
+void PersistentBlockStore::_write_slot_entry(size_t slot) {
+    m_file.seekp(_slot_entry_offset(slot));
+    m_file.write(reinterpret_cast<const char*>(&m_slots[slot]), sizeof(SlotEntry));
+}
+
+void PersistentBlockStore::_invalidate(size_t hash) {
+    auto it = m_hash_to_slot.find(hash);
+    if (it == m_hash_to_slot.end()) {
+        return;
+    }
+    size_t slot = it->second.slot;
+    m_lru_slots.erase(it->second.lru_it);
+    m_hash_to_slot.erase(it);
+    m_slots[slot].is_valid = 0;
+    _write_slot_entry(slot);
+    m_free_slots.push_back(slot);
+}
+
+void PersistentBlockStore::_touch(IndexEntry& entry) {
+    m_lru_slots.splice(m_lru_slots.end(), m_lru_slots, entry.lru_it);
+    m_slots[entry.slot].last_access = m_access_counter++;
+    _write_slot_entry(entry.slot);
+}
+
+void PersistentBlockStore::put(const std::vector<size_t>& hashes, const std::vector<uint8_t>& data) {
+    OPENVINO_ASSERT(data.size() == hashes.size() * m_block_byte_size, "Unexpected size of the blocks for the persistent prefix cache: ",
+                    data.size(), ", expected ", hashes.size() * m_block_byte_size);
+    if (m_slots.empty() || hashes.empty()) {
+        return;
+    }
+
+    for (size_t i = 0; i < hashes.size(); ++i) {
+        auto it = m_hash_to_slot.find(hashes[i]);
+        if (it != m_hash_to_slot.end()) {
+            _touch(it->second);
+            continue;
+        }
+
+        if (m_free_slots.empty()) {
+            _invalidate(m_slots[m_lru_slots.front()].hash);
+        }
+        size_t slot = m_free_slots.back();
+        m_free_slots.pop_back();
+
+        // the file is flushed once per batch, so the slot entry may reach the disk before the payload;
+        // such a partially written block fails the checksum validation on read
+        const uint8_t* block_data = data.data() + i * m_block_byte_size;
+        m_file.seekp(_payload_offset(slot));
+        m_file.write(reinterpret_cast<const char*>(block_data), m_block_byte_size);
+
+        m_slots[slot] = SlotEntry{hashes[i], checksum(block_data, m_block_byte_size), m_access_counter++, 1};
+        _write_slot_entry(slot);
+
+        m_lru_slots.push_back(slot);
+        m_hash_to_slot[hashes[i]] = IndexEntry{slot, std::prev(m_lru_slots.end())};
+    }
+    m_file.flush();
+    OPENVINO_ASSERT(m_file.good(), "Failed to write to the persistent prefix cache file ", m_path.string());
+}
+
+bool PersistentBlockStore::get(size_t hash, std::vector<uint8_t>& data) {
+    auto it = m_hash_to_slot.find(hash);
+    if (it == m_hash_to_slot.end()) {
+        return false;
+    }
+
+    size_t slot = it->second.slot;
+    data.resize(m_block_byte_size);
+    m_file.seekg(_payload_offset(slot));
+    if (!m_file.read(reinterpret_cast<char*>(data.data()), data.size()) ||
+        checksum(data.data(), data.size()) != m_slots[slot].checksum) {
+        m_file.clear();
+        _invalidate(hash);
+        return false;
+    }
+
+    _touch(it->second);
+    return true;
+}
+
+}
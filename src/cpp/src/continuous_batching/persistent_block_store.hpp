@@ -0,0 +1,144 @@
+// Copyright (C) 2023-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+namespace ov::genai {
+
+/**
+ * @brief A file-backed second tier of the prefix cache. Stores the contents of full KV cache blocks (for all decoder layers at once)
+ * keyed by the prefix hash of the block, so that the computed prompt prefixes survive pipeline restarts. The file consists of a header,
+ * a fixed-size slot table and fixed-size block payloads; the payloads are read lazily one block at a time, only when a prompt prefix
+ * hash matches. Once the size budget is exhausted, the least recently used slot is overwritten. Each payload is protected by a checksum,
+ * and a block that fails the check (e.g. a payload not fully written before the process exited) is dropped from the store instead of
+ * being restored. The header records the fingerprints of both the KV cache layout and the model weights, so that blocks computed by
+ * a different model are never restored, even if the model shares the architecture.
+ */
+class PersistentBlockStore {
+public:
+    /**
+     * Opens the store file, or (re)initializes it if the file does not exist or was created for a different cache layout or model.
+     * @param path Path to the store file.
+     * @param max_size_in_bytes Size budget for the block payloads in the file. The number of slots is derived from it.
+     * @param block_byte_size Size of a single block payload in bytes, i.e. the size of a block over all decoder layers for both K and V.
+     * @param layout_hash Fingerprint of the KV cache layout (precisions, shapes, block size). Files with a different fingerprint are
+     * discarded on open.
+     * @param model_hash Fingerprint of the model weights. Files with a different fingerprint are discarded on open.
+     */
+    PersistentBlockStore(const std::filesystem::path& path, size_t max_size_in_bytes, size_t block_byte_size, uint64_t layout_hash, uint64_t model_hash);
+
+    ~PersistentBlockStore();
+
+    PersistentBlockStore(const PersistentBlockStore&) = delete;
+    PersistentBlockStore& operator=(const PersistentBlockStore&) = delete;
+
+    /**
+     * @return Whether the block with the given prefix hash is present in the store.
+     */
+    bool contains(size_t hash) const {
+        return m_hash_to_slot.find(hash) != m_hash_to_slot.end();
+    }
+
+    /**
+     * Writes the block contents into the store, evicting the least recently used block if the store is full. If the block is already
+     * present, only its recency is updated.
+     * @param hash Prefix hash of the block.
+     * @param data Block contents, must be exactly `get_block_byte_size()` bytes.
+     */
+    void put(size_t hash, const std::vector<uint8_t>& data) {
+        put(std::vector<size_t>{hash}, data);
+    }
+
+    /**
+     * Writes the contents of several blocks into the store, same as `put` for a single block, but flushes the file only once.
+     * @param hashes Prefix hashes of the blocks.
+     * @param data Contents of the blocks one after another, must be exactly `hashes.size() * get_block_byte_size()` bytes.
+     */
+    void put(const std::vector<size_t>& hashes, const std::vector<uint8_t>& data);
+
+    /**
+     * Reads the block contents from the store.
+     * @param hash Prefix hash of the block.
+     * @param data Buffer to receive the block contents, resized to `get_block_byte_size()`.
+     * @return true if the block was found and passed the checksum validation, false otherwise. A block that fails the validation
+     * is removed from the store.
+     */
+    bool get(size_t hash, std::vector<uint8_t>& data);
+
+    /**
+     * @return Number of blocks currently stored.
+     */
+    size_t num_blocks() const {
+        return m_hash_to_slot.size();
+    }
+
+    /**
+     * @return Maximum number of blocks that fit into the size budget.
+     */
+    size_t num_slots() const {
+        return m_slots.size();
+    }
+
+    size_t get_block_byte_size() const {
+        return m_block_byte_size;
+    }
+
+    static uint64_t checksum(const uint8_t* data, size_t size);
+
+private:
+    struct Header {
+        char magic[8];
+        uint64_t version;
+        uint64_t layout_hash;
+        uint64_t model_hash;
+        uint64_t block_byte_size;
+        uint64_t num_slots;
+    };
+
+    struct SlotEntry {
+        uint64_t hash;
+        uint64_t checksum;
+        uint64_t last_access;
+        uint64_t is_valid;
+    };
+
+    struct IndexEntry {
+        size_t slot;
+        std::list<size_t>::iterator lru_it;
+    };
+
+    bool _load();
+    void _initialize();
+    void _write_slot_entry(size_t slot);
+    void _invalidate(size_t hash);
+    void _touch(IndexEntry& entry);
+
+    std::streamoff _slot_entry_offset(size_t slot) const {
+        return static_cast<std::streamoff>(sizeof(Header) + slot * sizeof(SlotEntry));
+    }
+
+    std::streamoff _payload_offset(size_t slot) const {
+        return static_cast<std::streamoff>(sizeof(Header) + m_slots.size() * sizeof(SlotEntry) + slot * m_block_byte_size);
+    }
+
+    std::filesystem::path m_path;
+    std::fstream m_file;
+    size_t m_block_byte_size;
+    uint64_t m_layout_hash;
+    uint64_t m_model_hash;
+    uint64_t m_access_counter = 0;
+    std::vector<SlotEntry> m_slots;
+    std::vector<size_t> m_free_slots;
+    // slots ordered from the least to the most recently used
+    std::list<size_t> m_lru_slots;
+    std::unordered_map<size_t, IndexEntry> m_hash_to_slot;
+};
+
+}
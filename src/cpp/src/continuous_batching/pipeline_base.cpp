@@ -53,6 +53,7 @@ void ContinuousBatchingPipeline::IContinuousBatchingPipeline::start_chat(const s
 void ContinuousBatchingPipeline::IContinuousBatchingPipeline::finish_chat() {
     m_is_chat_conversation = false;
     m_history.clear();
+    m_chat_history_encoder.reset();
     m_history_images.clear();
     m_history_videos.clear();
     m_history_image_ids.clear();
@@ -95,11 +96,10 @@ ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
         OPENVINO_ASSERT(1 == prompts.size(), "Can't chat with multiple prompts");
         m_history.push_back({{"role", "user"}, {"content", prompts.at(0)}});
         constexpr bool add_generation_prompt = true;
-        std::string history = m_tokenizer.apply_chat_template(m_history, add_generation_prompt);
         timer.start();
         const auto encode_start = std::chrono::steady_clock::now();
-        // ov::genai::add_special_tokens(false) is aligned with stateful pipeline
-        input_ids.push_back(m_tokenizer.encode(history, ov::genai::add_special_tokens(false)).input_ids);
+        // special tokens are not added, which is aligned with stateful pipeline
+        input_ids.push_back(m_chat_history_encoder.encode(m_tokenizer, m_history, add_generation_prompt).input_ids);
         tokenization_durations.emplace_back(PerfMetrics::get_microsec(std::chrono::steady_clock::now() - encode_start));
         timer.end();
     } else {
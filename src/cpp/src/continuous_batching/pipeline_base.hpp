@@ -12,6 +12,7 @@
 #include "continuous_batching/model_runner.hpp"
 #include "continuous_batching/scheduler.hpp"
 #include "continuous_batching/threaded_streamer.hpp"
+#include "tokenizer/chat_history_encoder.hpp"
 
 namespace ov::genai {
 
@@ -53,6 +54,8 @@ protected:
 
     bool m_is_chat_conversation = false;
     ChatHistory m_history;
+    // tokenizes the templated chat history, reusing the tokens of the previous turns if "incremental_chat_encoding" is set
+    ChatHistoryEncoder m_chat_history_encoder;
     std::vector<ov::genai::EncodedImage> m_history_images;
     std::vector<size_t> m_history_image_ids;
     std::vector<ov::genai::EncodedVideo> m_history_videos;
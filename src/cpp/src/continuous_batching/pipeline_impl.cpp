@@ -116,10 +116,21 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::~ContinuousBatchingImpl() {
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::generate_candidates_for_prompt_lookup() {}
 
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::_pull_awaiting_requests() {
-    std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
-    m_requests.insert(m_requests.end(), m_awaiting_requests.begin(), m_awaiting_requests.end());
-    m_awaiting_requests.clear();
+    std::vector<SequenceGroup::Ptr> awaiting_requests;
+    {
+        std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
+        awaiting_requests.swap(m_awaiting_requests);
+    }
+    m_requests.insert(m_requests.end(), awaiting_requests.begin(), awaiting_requests.end());
     m_pipeline_metrics.requests = m_requests.size();
+
+    // grammars are compiled in background while the prompts are processed; it's done here rather than in add_request()
+    // to keep structured output controller accessed from the step thread only
+    if (m_logits_vocab_size > 0) {
+        for (const auto& request : awaiting_requests) {
+            m_sampler->start_structured_output_compilation(request->get_sampling_parameters(), m_logits_vocab_size);
+        }
+    }
 }
 
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
@@ -128,11 +139,20 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
     const std::string& device,
     const ov::AnyMap& properties) {
     m_device = device;
+    // blocks of the persistent prefix cache are only valid for the original weights, so the fingerprint is taken before LoRA is applied
+    const uint64_t model_fingerprint = scheduler_config.persistent_prefix_cache_path.empty() ? 0 : utils::get_model_weights_fingerprint(model);
     // apply LoRA
     auto filtered_properties = extract_adapters_from_properties(properties, &m_generation_config.adapters);
+    // Extract per_request_adapters property if exists and remove it from properties
+    bool per_request_adapters = false;
+    auto per_request_adapters_it = filtered_properties->find(ov::genai::per_request_adapters.name());
+    if (per_request_adapters_it != filtered_properties->end()) {
+        per_request_adapters = per_request_adapters_it->second.as<bool>();
+        filtered_properties.fork().erase(ov::genai::per_request_adapters.name());
+    }
     if (m_generation_config.adapters) {
-        m_generation_config.adapters->set_tensor_name_prefix("base_model.model.");
-        m_adapter_controller = AdapterController(model, *m_generation_config.adapters, device);   // TODO: Make the prefix name configurable
+        m_generation_config.adapters->set_tensor_name_prefix("base_model.model.");   // TODO: Make the prefix name configurable
+        m_adapter_controller = AdapterController(model, *m_generation_config.adapters, device, per_request_adapters);
     }
     // Extract sampler_num_threads property if exists and remove it from properties
     size_t sampler_num_threads = std::thread::hardware_concurrency();
@@ -141,6 +161,18 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
         sampler_num_threads = sampler_num_threads_it->second.as<size_t>();
         filtered_properties.fork().erase("sampler_num_threads");   // do not use iterator sampler_num_threads_it because a forked container may not be the same container
     }
+    // Extract pipelined_step property if exists and remove it from properties
+    auto pipelined_step_it = filtered_properties->find("pipelined_step");
+    if (pipelined_step_it != filtered_properties->end()) {
+        m_is_pipelined_step_enabled = pipelined_step_it->second.as<bool>();
+        filtered_properties.fork().erase("pipelined_step");
+    }
+    // Extract incremental_chat_encoding property if exists and remove it from properties
+    auto incremental_chat_encoding_it = filtered_properties->find("incremental_chat_encoding");
+    if (incremental_chat_encoding_it != filtered_properties->end()) {
+        m_chat_history_encoder.set_incremental(incremental_chat_encoding_it->second.as<bool>());
+        filtered_properties.fork().erase("incremental_chat_encoding");
+    }
 
     ov::CompiledModel compiled_model = utils::singleton_core().compile_model(model, device, *filtered_properties);
     std::vector<std::string> execution_devices = compiled_model.get_property(ov::execution_devices);
@@ -155,6 +187,15 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
     ov::genai::utils::print_compiled_model_properties(compiled_model, "LLM with Paged Attention");
     ov::InferRequest infer_request = compiled_model.create_infer_request();
 
+    // vocab size of static logits is known before the first step, so its requests can start compiling grammars too
+    for (const auto& output : compiled_model.outputs()) {
+        const ov::PartialShape& logits_shape = output.get_partial_shape();
+        if (output.get_names().count("logits") && logits_shape.rank().is_static() && logits_shape.rank().get_length() > 0 &&
+            logits_shape[logits_shape.rank().get_length() - 1].is_static()) {
+            m_logits_vocab_size = logits_shape[logits_shape.rank().get_length() - 1].get_length();
+        }
+    }
+
     // Cache manager
     std::shared_ptr<CacheManager> cache_manager = std::make_shared<CacheManager>(infer_request);
     m_num_decoder_layers = cache_manager->get_num_decoder_layers();
@@ -178,6 +219,11 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
         size_t size_in_bytes = cache_manager->get_block_size_in_bytes() * normalized_config.num_kv_blocks;
         OPENVINO_ASSERT(size_in_bytes <= total_mem_size, "Requested number of KV-blocks require more memory than available on the system.");
     }
+    if (normalized_config.num_swap_kv_blocks > 0) {
+        // swapped out blocks are always kept in host memory
+        size_t size_in_bytes = cache_manager->get_block_size_in_bytes() * normalized_config.num_swap_kv_blocks;
+        OPENVINO_ASSERT(size_in_bytes <= get_available_cpu_memory(), "Requested number of swap KV-blocks require more memory than available on the system.");
+    }
 
     bool can_use_partial_preemption = true;
     if (execution_device.find("GPU") != std::string::npos && !normalized_config.dynamic_split_fuse) {
@@ -218,6 +264,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
                                                        is_use_xattention,
                                                        /* is_use_adaptive_rkv = */ false);
     }
+    m_scheduler->open_persistent_prefix_cache(model_fingerprint);
 
     m_sampler = std::make_shared<Sampler>(m_tokenizer, sampler_num_threads);
 
@@ -324,7 +371,7 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::add_request(uint64_t request
     ov::Tensor inputs;
     ov::genai::VLMPerfMetrics metrics;
     if (m_model_input_type == ModelInputType::TOKENS) {
-        static ManualTimer timer("tokenize");
+        static thread_local ManualTimer timer("tokenize");
         timer.start();
         inputs = m_tokenizer.encode(prompt).input_ids;
         timer.end();
@@ -344,7 +391,7 @@ bool ContinuousBatchingPipeline::ContinuousBatchingImpl::has_non_finished_reques
 }
 
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
-    static ManualTimer step_timer("step()");
+    static thread_local ManualTimer step_timer("step()");
     step_timer.start();
 
     _pull_awaiting_requests();
@@ -352,7 +399,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
     Scheduler::Output scheduler_output;
 
     {
-        static ManualTimer scheduling_timer("scheduling");
+        static thread_local ManualTimer scheduling_timer("scheduling");
         scheduling_timer.start();
         scheduler_output = m_scheduler->schedule(m_requests);
         scheduling_timer.end();
@@ -363,6 +410,11 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
         m_pipeline_metrics.max_cache_usage = std::max(m_pipeline_metrics.max_cache_usage, scheduler_output.m_cache_usage);
         _register_step_cache_usage(scheduler_output.m_cache_usage);
         m_pipeline_metrics.avg_cache_usage = _get_current_running_average_cache_usage();
+        _update_priority_class_requests();
+
+        if (m_adapter_controller && m_adapter_controller->has_per_request_adapters()) {
+            _apply_per_request_adapters(scheduler_output);
+        }
 
         const auto& sched_config = m_scheduler->get_config();
         if (sched_config.use_cache_eviction) {
@@ -390,10 +442,27 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
     ov::Tensor logits;
 
     {
-        static ManualTimer timer("forward");
+        static thread_local ManualTimer timer("forward");
         const auto infer_start = std::chrono::steady_clock::now();
         timer.start();
-        logits = m_model_runner->forward(m_requests, scheduler_output);
+        if (m_is_pipelined_step_enabled) {
+            m_model_runner->start_forward(m_requests, scheduler_output);
+            {
+                // host-side work which does not depend on the logits of this step
+                static thread_local ManualTimer overlap_timer("overlapped with forward");
+                overlap_timer.start();
+                if (m_logits_vocab_size > 0) {
+                    m_sampler->prepare(m_requests, m_logits_vocab_size);
+                }
+                // requests added during the step are scheduled in the next one; appending keeps scheduled indices valid
+                _pull_awaiting_requests();
+                overlap_timer.end();
+            }
+            logits = m_model_runner->wait_forward(m_requests, scheduler_output);
+        } else {
+            logits = m_model_runner->forward(m_requests, scheduler_output);
+        }
+        m_logits_vocab_size = logits.get_shape().back();
         const auto infer_end = std::chrono::steady_clock::now();
         m_pipeline_metrics.inference_duration = PerfMetrics::get_microsec(infer_end - infer_start);
         timer.end();
@@ -421,16 +490,24 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
 
     SamplerOutput sampler_output;
     {
-        static ManualTimer timer("sample");
+        static thread_local ManualTimer timer("sample");
         timer.start();
         sampler_output = m_sampler->sample(m_requests, logits, m_is_validation_mode_enabled);
         m_batch_size = sampler_output.num_generated_tokens;
         timer.end();
     }
 
+    // persist newly computed prompt blocks before finished and dropped sequences release them
+    {
+        static thread_local ManualTimer persist_timer("persist computed blocks");
+        persist_timer.start();
+        m_scheduler->persist_computed_blocks(m_requests);
+        persist_timer.end();
+    }
+
     // process sampler_output (e.g. fork or drop sequences from BlockScheduler)
     {
-        static ManualTimer free_fork_timer("fork / free sequence");
+        static thread_local ManualTimer free_fork_timer("fork / free sequence");
         free_fork_timer.start();
 
         for (const auto& pair : sampler_output.m_forked_sequences) {
@@ -447,7 +524,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
     }
 
     {
-        static ManualTimer candidates_timer("generate_candidates_for_prompt_lookup()");
+        static thread_local ManualTimer candidates_timer("generate_candidates_for_prompt_lookup()");
         candidates_timer.start();
         generate_candidates_for_prompt_lookup();
         candidates_timer.end();
@@ -459,7 +536,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
 
     // notify requests dropped by handle
     {
-        static ManualTimer report_tokens_timer("notify requests dropped by handle");
+        static thread_local ManualTimer report_tokens_timer("notify requests dropped by handle");
         report_tokens_timer.start();
         _notify_requests_dropped_by_handle();
         report_tokens_timer.end();
@@ -468,7 +545,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
     // free non running requests for current step
 
     {
-        static ManualTimer clean_up_requests_timer("free non running requests");
+        static thread_local ManualTimer clean_up_requests_timer("free non running requests");
         clean_up_requests_timer.start();
         _free_non_running_requests();
         clean_up_requests_timer.end();
@@ -478,11 +555,45 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
 }
 
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::set_adapters(const std::optional<AdapterConfig>& adapters) {
-    if (m_adapter_controller) {
+    // otherwise adapters of each request are applied by step()
+    if (m_adapter_controller && !m_adapter_controller->has_per_request_adapters()) {
         m_adapter_controller->apply(m_model_runner->get_infer_request(), adapters);
     }
 }
 
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_apply_per_request_adapters(const Scheduler::Output& scheduler_output) {
+    auto same_adapters = [](const AdapterConfig& lhs, const AdapterConfig& rhs) {
+        return lhs.get_adapters_and_alphas() == rhs.get_adapters_and_alphas();
+    };
+
+    std::vector<AdapterConfig> adapter_slots;
+    std::map<uint64_t, size_t> request_slots;
+    for (size_t seq_group_id : scheduler_output.m_scheduled_sequence_groups_ids) {
+        const SequenceGroup::Ptr& sequence_group = m_requests[seq_group_id];
+        // requests without adapters property use the adapters the pipeline was created with
+        const auto& request_adapters = sequence_group->get_sampling_parameters().adapters;
+        const AdapterConfig adapters = request_adapters ? *request_adapters : m_generation_config.adapters.value_or(AdapterConfig());
+        auto slot_it = std::find_if(adapter_slots.begin(), adapter_slots.end(), [&](const AdapterConfig& slot) {
+            return same_adapters(slot, adapters);
+        });
+        if (slot_it == adapter_slots.end()) {
+            slot_it = adapter_slots.insert(adapter_slots.end(), adapters);
+        }
+        request_slots[sequence_group->get_request_id()] = std::distance(adapter_slots.begin(), slot_it);
+    }
+
+    // LoRA states are updated only when the set of adapter slots is changed, which is rare in the generation phase
+    bool slots_changed = adapter_slots.size() != m_adapter_slots.size();
+    for (size_t i = 0; i < adapter_slots.size() && !slots_changed; ++i) {
+        slots_changed = !same_adapters(adapter_slots[i], m_adapter_slots[i]);
+    }
+    if (slots_changed) {
+        m_adapter_controller->apply_per_request(m_model_runner->get_infer_request(), adapter_slots);
+        m_adapter_slots = std::move(adapter_slots);
+    }
+    m_model_runner->set_adapter_slots(std::move(request_slots));
+}
+
 std::vector<EncodedGenerationResult>
 ContinuousBatchingPipeline::ContinuousBatchingImpl::generate(const std::vector<ov::Tensor>& input_ids,
                                                              const std::vector<GenerationConfig>& sampling_params,
@@ -511,10 +622,12 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::generate(const std::vector<o
     auto& raw_perf_counters = perf_metrics.raw_metrics;
     raw_perf_counters.m_inference_durations = {{ MicroSeconds(0.0f) }};
 
-    // checks that all requests has the same LoRA adapters property value
-    for (size_t i = 1; i < sampling_params.size(); ++i) {
-        OPENVINO_ASSERT(sampling_params[i - 1].adapters == sampling_params[i].adapters,
-            "LoRA adapters value must be the same for all requests");
+    // checks that all requests has the same LoRA adapters property value, unless adapters are selected per request
+    if (!m_adapter_controller || !m_adapter_controller->has_per_request_adapters()) {
+        for (size_t i = 1; i < sampling_params.size(); ++i) {
+            OPENVINO_ASSERT(sampling_params[i - 1].adapters == sampling_params[i].adapters,
+                "LoRA adapters value must be the same for all requests");
+        }
     }
     set_adapters(sampling_params[0].adapters);
 
@@ -650,6 +763,9 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::_free_non_running_reque
     while (requests_iterator != m_requests.end()) {
         const auto& request = *requests_iterator;
         if(request->has_finished() || request->handle_stopped() || request->handle_cancelled()) {
+            if (request->has_finished()) {
+                _register_finished_request_latency(request);
+            }
             for (const auto& sequence: request->get_sequences()) {
                 if (m_scheduler->has_block_table(sequence->get_id())) {
                     m_scheduler->free_sequence(sequence->get_id());
@@ -683,6 +799,44 @@ float ContinuousBatchingPipeline::ContinuousBatchingImpl::_get_current_running_a
     return std::accumulate(m_previous_step_cache_usages.begin(), m_previous_step_cache_usages.end(), 0.0) / m_previous_step_cache_usages.size();
 }
 
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_update_priority_class_requests() {
+    for (auto& [priority, class_metrics] : m_pipeline_metrics.priority_classes) {
+        class_metrics.requests = 0;
+    }
+    for (const auto& request : m_requests) {
+        ++m_pipeline_metrics.priority_classes[request->get_sampling_parameters().priority].requests;
+    }
+}
+
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_register_finished_request_latency(const SequenceGroup::CPtr& sequence_group) {
+    const auto& first_token_time = sequence_group->get_first_token_time();
+    if (!first_token_time.has_value()) {
+        return;
+    }
+
+    const auto& sampling_params = sequence_group->get_sampling_parameters();
+    PriorityClassMetrics& class_metrics = m_pipeline_metrics.priority_classes[sampling_params.priority];
+    auto to_ms = [](std::chrono::steady_clock::duration duration) {
+        return std::chrono::duration<float, std::milli>(duration).count();
+    };
+
+    const float ttft = to_ms(*first_token_time - sequence_group->get_arrival_time());
+    ++class_metrics.finished_requests;
+    class_metrics.avg_ttft += (ttft - class_metrics.avg_ttft) / class_metrics.finished_requests;
+    if (sampling_params.ttft_deadline_ms > 0 && ttft > sampling_params.ttft_deadline_ms) {
+        ++class_metrics.ttft_deadline_misses;
+    }
+
+    const size_t num_token_iterations = sequence_group->get_num_token_iterations();
+    if (num_token_iterations > 1) {
+        const float tpot = to_ms(sequence_group->get_last_token_time() - *first_token_time) / (num_token_iterations - 1);
+        size_t& num_tpot_samples = m_num_tpot_samples_per_priority[sampling_params.priority];
+        ++num_tpot_samples;
+        class_metrics.avg_tpot += (tpot - class_metrics.avg_tpot) / num_tpot_samples;
+    }
+    class_metrics.tpot_deadline_misses += sequence_group->get_num_late_token_iterations();
+}
+
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::_reset_cache_usage_statistics() {
     m_previous_step_cache_usages.clear();
     m_pipeline_metrics.max_cache_usage = 0.0;
@@ -16,6 +16,8 @@ protected:
     std::shared_ptr<Scheduler> m_scheduler;
     std::shared_ptr<ModelRunner> m_model_runner;
     std::optional<AdapterController> m_adapter_controller;
+    // adapters of each slot applied by m_adapter_controller, if adapters are selected per request
+    std::vector<AdapterConfig> m_adapter_slots;
     std::shared_ptr<Sampler> m_sampler;
 
     // current requests to process
@@ -29,6 +31,8 @@ protected:
 
     static const size_t AVG_CACHE_USAGE_WINDOW_SIZE_IN_STEPS = 1000;
     std::deque<float> m_previous_step_cache_usages;
+    // number of finished requests per priority class contributing to the average TPOT
+    std::map<size_t, size_t> m_num_tpot_samples_per_priority;
 
     // for perf metrics
     float m_load_time_ms = 0.0f;
@@ -37,6 +41,11 @@ protected:
     // flag to enable validation mode for sampler
     bool m_is_validation_mode_enabled = false;
 
+    // flag to overlap the host-side work which does not depend on the current step results with the inference
+    bool m_is_pipelined_step_enabled = false;
+    // vocabulary size of the logits produced by the last step
+    size_t m_logits_vocab_size = 0;
+
     size_t m_num_decoder_layers = 0;
     size_t m_block_size = 0;
 
@@ -94,10 +103,18 @@ protected:
     void _register_step_cache_usage(float step_cache_usage);
     void _reset_cache_usage_statistics();
     float _get_current_running_average_cache_usage() const;
+    void _update_priority_class_requests();
+    void _register_finished_request_latency(const SequenceGroup::CPtr& sequence_group);
     void _compute_cache_rotation_data(const std::vector<SequenceGroup::Ptr>& sequence_groups, const Scheduler::Output& scheduler_output);
     void _prepare_rotation_data_storage(const SchedulerConfig& normalized_config, size_t embedding_size);
     void _set_adaptive_rkv_diversity_blocks(const SchedulerConfig& sched_config, const Scheduler::Output& scheduler_output);
 
+    /**
+     * Groups scheduled requests by their LoRA adapters into adapter slots and applies them, so that requests with
+     * different adapters are inferred in the same batch
+     */
+    void _apply_per_request_adapters(const Scheduler::Output& scheduler_output);
+
     virtual void drop_requests();
 
 public:
@@ -152,7 +169,7 @@ public:
              const std::optional<std::vector<std::unordered_map<std::string, ov::Tensor>>>& lm_extra_inputs_list = std::nullopt) override;
 
     /**
-     * Updates LoRA adapters for current generation call
+     * Updates LoRA adapters for current generation call. Does nothing if adapters are selected per request.
      */
     void set_adapters(const std::optional<AdapterConfig>& adapters);
 
@@ -4,7 +4,11 @@
 
 #pragma once
 
+#include <algorithm>
+#include <chrono>
 #include <cstdlib>
+#include <limits>
+#include <numeric>
 #include <vector>
 
 #include "openvino/runtime/intel_gpu/properties.hpp"
@@ -16,6 +20,7 @@
 #include "continuous_batching/sparse_attention.hpp"
 #include "utils.hpp"
 #include "continuous_batching/cache_eviction.hpp"
+#include "continuous_batching/persistent_block_store.hpp"
 
 namespace ov::genai {
 class Scheduler {
@@ -34,6 +39,12 @@ class Scheduler {
     std::shared_ptr<CacheManager> m_cache_manager;
 
     size_t m_snapkv_window_size = 1;
+
+    // second, file-backed tier of the prefix cache
+    std::unique_ptr<PersistentBlockStore> m_persistent_block_store;
+    // number of leading prompt blocks already written to the persistent store, per sequence
+    std::map<uint64_t, size_t> m_num_persisted_blocks;
+    std::vector<uint8_t> m_block_data_buffer;
 public:
     struct Output {
         // IDs of scheduled groups
@@ -74,27 +85,70 @@ public:
         m_config(config),
         m_cache_manager(cache_manager),
         m_snapkv_window_size(snapkv_window_size) {
-        m_block_manager = std::make_shared<BlockManager>(m_config.num_kv_blocks, m_config.enable_prefix_caching, block_size, num_layers);
+        m_block_manager = std::make_shared<BlockManager>(m_config.num_kv_blocks, m_config.enable_prefix_caching, block_size, num_layers,
+                                                         _is_swap_enabled() ? m_config.num_swap_kv_blocks : 0);
         OPENVINO_ASSERT(num_layers != 0, "num_layers must be non-zero");
+        OPENVINO_ASSERT(m_config.num_reserved_decode_tokens == 0 || m_config.num_reserved_decode_tokens < m_config.max_num_batched_tokens,
+                        "num_reserved_decode_tokens (", m_config.num_reserved_decode_tokens, ") must be less than max_num_batched_tokens (",
+                        m_config.max_num_batched_tokens, ")");
+    }
+
+    /**
+     * Opens the persistent prefix cache, if it is enabled by the config. The blocks persisted for a different model are discarded.
+     * @param model_fingerprint Fingerprint of the model weights, see `utils::get_model_weights_fingerprint`.
+     */
+    void open_persistent_prefix_cache(uint64_t model_fingerprint) {
+        if (_is_persistent_prefix_cache_enabled()) {
+            m_persistent_block_store = std::make_unique<PersistentBlockStore>(m_config.persistent_prefix_cache_path,
+                                                                              m_config.persistent_prefix_cache_size * 1024 * 1024 * 1024,
+                                                                              m_cache_manager->get_block_data_byte_size(),
+                                                                              m_cache_manager->get_layout_hash(),
+                                                                              model_fingerprint);
+        }
     }
 
     void release() {
+        m_persistent_block_store.reset();
         m_cache_manager.reset();
         m_block_manager.reset();
     }
 
-    Output schedule(std::vector<SequenceGroup::Ptr>& sequence_groups) {
+    Output schedule(std::vector<SequenceGroup::Ptr>& pipeline_sequence_groups) {
         Output scheduler_output;
         // map of src -> dst blocks copies, which need to be performed by CacheManager
         std::map<size_t, std::list<size_t>> block_copy_map;
 
         // free some blocks taken by non-confirmed candidates in SD / prompt look-up
-        clean_empty_blocks(sequence_groups);
+        clean_empty_blocks(pipeline_sequence_groups);
+
+        // all the scheduling phases below serve groups in the order of the vector and preempt from its end,
+        // so running them over a view ordered by priority is enough to prefer high priority groups everywhere;
+        // the pipeline's vector itself is not reordered, since the pipeline keeps indices into it
+        std::vector<size_t> priority_order;
+        std::vector<SequenceGroup::Ptr> prioritized_sequence_groups;
+        if (_is_priority_scheduling_enabled(pipeline_sequence_groups)) {
+            priority_order = _get_priority_order(pipeline_sequence_groups);
+            prioritized_sequence_groups.reserve(priority_order.size());
+            for (size_t group_idx : priority_order) {
+                prioritized_sequence_groups.push_back(pipeline_sequence_groups[group_idx]);
+            }
+        }
+        std::vector<SequenceGroup::Ptr>& sequence_groups = priority_order.empty() ? pipeline_sequence_groups : prioritized_sequence_groups;
 
         if (m_block_manager->get_total_number_of_kv_blocks() == 0) {
             _initialize_cache(sequence_groups);
         }
 
+        if (m_persistent_block_store) {
+            _restore_persisted_blocks(sequence_groups);
+        }
+
+        // map of host -> physical blocks copies for sequence groups resumed from swap
+        std::vector<std::map<size_t, size_t>> swap_in_map;
+        if (_is_swap_enabled()) {
+            _schedule_swap_in(sequence_groups, swap_in_map);
+        }
+
         if (m_config.dynamic_split_fuse) {
             // deepspeed-mii case
             // generation phase is always scheduled first
@@ -113,13 +167,24 @@ public:
             }
         }
 
+        if (!priority_order.empty()) {
+            // ModelRunner and Sampler expect the IDs of scheduled groups to follow the order of the pipeline's vector
+            auto& scheduled_ids = scheduler_output.m_scheduled_sequence_groups_ids;
+            for (auto& seq_group_id : scheduled_ids) {
+                seq_group_id = priority_order[seq_group_id];
+            }
+            std::sort(scheduled_ids.begin(), scheduled_ids.end());
+        }
+
         m_cache_manager->allocate_cache_if_needed(m_block_manager->get_total_number_of_kv_blocks());
         _clear_waiting_sequences(sequence_groups);
         scheduler_output.m_cache_usage = m_block_manager->get_used_percentage();
         scheduler_output.m_cache_size_in_bytes = m_block_manager->get_total_number_of_kv_blocks() * m_cache_manager->get_block_size_in_bytes();
 
-        static ManualTimer copy_blocks_timer("copy block");
+        static thread_local ManualTimer copy_blocks_timer("copy block");
         copy_blocks_timer.start();
+        // swapped in blocks may be sources of copy-on-write copies, so they are restored first
+        m_cache_manager->swap_in_blocks(swap_in_map);
         m_cache_manager->copy_blocks(block_copy_map);
         copy_blocks_timer.end();
 
@@ -152,6 +217,7 @@ public:
     }
 
     void free_sequence(uint64_t seq_id) {
+        m_num_persisted_blocks.erase(seq_id);
         m_block_manager->free_sequence(seq_id);
     }
 
@@ -163,6 +229,50 @@ public:
         m_block_manager->restore_cached_blocks(sequence_group);
     }
 
+    /**
+     * Writes the full prompt blocks computed so far to the persistent prefix cache, if it is enabled. Should be called
+     * after the KV cache has been filled by the model inference, but before the finished sequences are freed.
+     * The blocks of all the sequence groups are written as a single batch.
+     */
+    void persist_computed_blocks(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
+        if (!m_persistent_block_store) {
+            return;
+        }
+        const size_t block_size = get_block_size();
+        const size_t block_byte_size = m_persistent_block_store->get_block_byte_size();
+        std::vector<size_t> hashes;
+        for (const auto& sequence_group : sequence_groups) {
+            const auto& sequences = sequence_group->get_sequences();
+            if (!_can_use_persistent_prefix_cache(sequence_group) || sequences.empty() ||
+                !m_block_manager->has_block_table(sequences[0]->get_id())) {
+                continue;
+            }
+            // prompt blocks are shared by all sequences of the group
+            Sequence::Ptr sequence = sequences[0];
+            const auto& block_tables = m_block_manager->get_block_tables(sequence->get_id());
+            size_t num_computed_blocks = std::min(sequence_group->get_num_processed_tokens(), sequence_group->get_prompt_len()) / block_size;
+            num_computed_blocks = std::min(num_computed_blocks, block_tables[0].size());
+
+            size_t& num_persisted_blocks = m_num_persisted_blocks[sequence->get_id()];
+            for (; num_persisted_blocks < num_computed_blocks; ++num_persisted_blocks) {
+                size_t hash = sequence->get_hash((num_persisted_blocks + 1) * block_size);
+                if (m_persistent_block_store->contains(hash)) {
+                    continue;
+                }
+                std::vector<size_t> block_ids;
+                for (const auto& block_table : block_tables) {
+                    block_ids.push_back(block_table[num_persisted_blocks]->get_index());
+                }
+                m_block_data_buffer.resize((hashes.size() + 1) * block_byte_size);
+                m_cache_manager->export_block(block_ids, m_block_data_buffer.data() + hashes.size() * block_byte_size);
+                hashes.push_back(hash);
+            }
+        }
+        if (!hashes.empty()) {
+            m_persistent_block_store->put(hashes, m_block_data_buffer);
+        }
+    }
+
     const SchedulerConfig& get_config() const {
         return m_config;
     }
@@ -189,6 +299,52 @@ private:
     }
 
 
+    static bool _is_priority_scheduling_enabled(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
+        // requests without priorities and deadlines keep the arrival order
+        return std::any_of(sequence_groups.begin(), sequence_groups.end(), [](const SequenceGroup::CPtr& sequence_group) {
+            const auto& sampling_params = sequence_group->get_sampling_parameters();
+            return sampling_params.priority > 0 || sampling_params.ttft_deadline_ms > 0 || sampling_params.tpot_deadline_ms > 0;
+        });
+    }
+
+    size_t _get_effective_priority(const SequenceGroup::CPtr& sequence_group, std::chrono::steady_clock::time_point now) const {
+        size_t priority = sequence_group->get_sampling_parameters().priority;
+        if (m_config.priority_aging_interval_ms > 0) {
+            auto waiting_time = std::chrono::duration_cast<std::chrono::milliseconds>(now - sequence_group->get_last_scheduled_time());
+            priority += static_cast<size_t>(std::max<int64_t>(waiting_time.count(), 0)) / m_config.priority_aging_interval_ms;
+        }
+        return priority;
+    }
+
+    std::vector<size_t> _get_priority_order(const std::vector<SequenceGroup::Ptr>& sequence_groups) const {
+        // higher effective priority first, then earliest deadline first, then arrival order
+        struct PriorityKey {
+            size_t priority;
+            std::chrono::steady_clock::time_point deadline;
+            std::chrono::steady_clock::time_point arrival_time;
+        };
+        const auto now = std::chrono::steady_clock::now();
+        std::vector<PriorityKey> keys;
+        keys.reserve(sequence_groups.size());
+        for (const auto& sequence_group : sequence_groups) {
+            keys.push_back(PriorityKey{_get_effective_priority(sequence_group, now),
+                                       sequence_group->get_next_token_deadline(),
+                                       sequence_group->get_arrival_time()});
+        }
+        std::vector<size_t> priority_order(sequence_groups.size());
+        std::iota(priority_order.begin(), priority_order.end(), 0);
+        std::stable_sort(priority_order.begin(), priority_order.end(), [&keys](size_t lhs_idx, size_t rhs_idx) {
+            const PriorityKey& lhs = keys[lhs_idx];
+            const PriorityKey& rhs = keys[rhs_idx];
+            if (lhs.priority != rhs.priority)
+                return lhs.priority > rhs.priority;
+            if (lhs.deadline != rhs.deadline)
+                return lhs.deadline < rhs.deadline;
+            return lhs.arrival_time < rhs.arrival_time;
+        });
+        return priority_order;
+    }
+
     bool _preempt_by_recompute(SequenceGroup::Ptr sequence_group, size_t blocks_needed) {
         size_t processed_tokens = sequence_group->get_num_processed_tokens();
         size_t prev_blocks_count = m_block_manager->num_free_blocks();
@@ -242,11 +398,135 @@ private:
         return m_block_manager->num_free_blocks() > prev_blocks_count;
     }
 
-    static size_t _get_low_priority_sequence_group_id(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
+    bool _is_swap_enabled() const {
+        // swapped out blocks cannot be shared via prefix cache or have per-sequence evicted contents
+        return m_config.num_swap_kv_blocks > 0 && !m_config.enable_prefix_caching && !m_config.use_cache_eviction;
+    }
+
+    bool _is_persistent_prefix_cache_enabled() const {
+        // evicted blocks do not correspond to the prefix hashes anymore
+        return !m_config.persistent_prefix_cache_path.empty() && m_config.enable_prefix_caching && !m_config.use_cache_eviction;
+    }
+
+    static bool _can_use_persistent_prefix_cache(const SequenceGroup::CPtr& sequence_group) {
+        // blocks of the persistent store are keyed by content hashes only, which are exact for tokens, but are computed from
+        // reduced embeddings for EMBEDDINGS groups, so different prompts could restore each other's blocks across processes
+        return sequence_group->get_sequence_group_type() == SequenceGroupType::TOKENS;
+    }
+
+    void _restore_persisted_blocks(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
+        // extends the prefixes restored from the in-memory prefix cache on request addition with the blocks from the persistent
+        // store; done here rather than in add_request, since the KV cache tensors are only touched by the scheduling thread
+        const size_t block_size = get_block_size();
+        for (const auto& sequence_group : sequence_groups) {
+            if (!_can_use_persistent_prefix_cache(sequence_group) || sequence_group->can_generate_tokens() || sequence_group->is_waiting() ||
+                sequence_group->handle_stopped() || sequence_group->handle_cancelled()) {
+                continue;
+            }
+            auto sequences = sequence_group->get_not_finished_sequences();
+            if (sequences.size() != 1) {
+                continue;
+            }
+            Sequence::Ptr sequence = sequences[0];
+            const size_t prompt_len = sequence_group->get_prompt_len();
+            size_t num_processed_tokens = sequence_group->get_num_processed_tokens();
+            // only the full blocks are persisted, so a prefix ending with a partially filled block cannot be extended
+            while (num_processed_tokens % block_size == 0 && num_processed_tokens + block_size <= prompt_len) {
+                size_t num_blocks = m_block_manager->has_block_table(sequence->get_id()) ?
+                    m_block_manager->get_block_tables(sequence->get_id())[0].size() : 0;
+                if (num_blocks != num_processed_tokens / block_size) {
+                    break;
+                }
+
+                size_t hash = sequence->get_hash(num_processed_tokens + block_size);
+                if (!m_block_manager->append_cached_block(sequence, hash)) {
+                    if (!m_persistent_block_store->get(hash, m_block_data_buffer) ||
+                        !(m_block_manager->can_allocate_blocks(1) || _try_increase_cache())) {
+                        break;
+                    }
+                    std::vector<size_t> block_ids;
+                    for (const auto& block : m_block_manager->append_block_to_restore(sequence, hash)) {
+                        block_ids.push_back(block->get_index());
+                    }
+                    m_cache_manager->allocate_cache_if_needed(m_block_manager->get_total_number_of_kv_blocks());
+                    m_cache_manager->import_block(block_ids, m_block_data_buffer);
+                }
+
+                num_processed_tokens += block_size;
+                // the last prompt token is always recomputed to get the logits
+                sequence_group->update_processed_tokens_num(num_processed_tokens == prompt_len ? prompt_len - 1 : num_processed_tokens);
+            }
+        }
+    }
+
+    bool _can_preempt_by_swap(SequenceGroup::Ptr sequence_group) {
+        // swap cost is linear in the number of blocks, while recompute cost grows faster than linearly with the
+        // context length, so only long enough sequences are worth swapping
+        return _is_swap_enabled() &&
+               sequence_group->get_num_scheduled_tokens() == 0 &&
+               sequence_group->get_num_processed_tokens() >= m_config.swap_min_num_tokens &&
+               m_block_manager->can_swap_out(sequence_group);
+    }
+
+    bool _preempt_by_swap(SequenceGroup::Ptr sequence_group) {
+        size_t prev_blocks_count = m_block_manager->num_free_blocks();
+        m_cache_manager->allocate_swap_cache_if_needed(m_config.num_swap_kv_blocks);
+        // copy out right away, since freed physical blocks may be overwritten by copy-on-write copies of this step
+        m_cache_manager->swap_out_blocks(m_block_manager->swap_out(sequence_group));
+        sequence_group->set_waiting();
+        return m_block_manager->num_free_blocks() > prev_blocks_count;
+    }
+
+    bool _preempt(SequenceGroup::Ptr sequence_group, size_t blocks_needed) {
+        if (_can_preempt_by_swap(sequence_group)) {
+            return _preempt_by_swap(sequence_group);
+        }
+        return _preempt_by_recompute(sequence_group, blocks_needed);
+    }
+
+    void _schedule_swap_in(const std::vector<SequenceGroup::Ptr>& sequence_groups, std::vector<std::map<size_t, size_t>>& swap_in_map) {
+        // swapped out groups are resumed in arrival order; once a group does not fit, all the following ones stay swapped out
+        bool can_swap_in = true;
+        for (const auto& sequence_group : sequence_groups) {
+            if (!m_block_manager->is_swapped_out(sequence_group)) {
+                continue;
+            }
+            if (sequence_group->handle_stopped() || sequence_group->handle_cancelled()) {
+                // host blocks will be released together with the request
+                continue;
+            }
+            if (can_swap_in) {
+                // reserve a slot for the next token of each sequence (if the cache is large enough) to avoid preempting
+                // the group right after resume
+                size_t num_swapped_blocks = m_block_manager->required_blocks_to_swap_in(sequence_group);
+                size_t num_required_blocks = std::min(num_swapped_blocks + sequence_group->num_running_seqs(),
+                                                      std::max(num_swapped_blocks, m_block_manager->get_total_number_of_kv_blocks()));
+                while (!m_block_manager->can_allocate_blocks(num_required_blocks)) {
+                    if (!_try_increase_cache()) {
+                        break;
+                    }
+                }
+                can_swap_in = m_block_manager->can_allocate_blocks(num_required_blocks);
+            }
+            if (can_swap_in) {
+                auto group_swap_in_map = m_block_manager->swap_in(sequence_group);
+                swap_in_map.resize(group_swap_in_map.size());
+                for (size_t layer_idx = 0; layer_idx < group_swap_in_map.size(); ++layer_idx) {
+                    swap_in_map[layer_idx].insert(group_swap_in_map[layer_idx].begin(), group_swap_in_map[layer_idx].end());
+                }
+            } else {
+                // keep the group away from scheduling in this step
+                sequence_group->set_waiting();
+            }
+        }
+    }
+
+    static size_t _get_low_priority_sequence_group_id(const std::vector<SequenceGroup::Ptr>& sequence_groups, BlockManager& block_manager) {
         for (size_t seq_group_id = 0, num_groups = sequence_groups.size(); seq_group_id < num_groups; ++seq_group_id) {
             size_t group_idx = num_groups - seq_group_id - 1;
             SequenceGroup::CPtr sequence_group = sequence_groups[group_idx];
-            if (sequence_group->get_num_processed_tokens() > 0) {
+            // swapped out groups keep their processed tokens, but have no physical blocks to free
+            if (sequence_group->get_num_processed_tokens() > 0 && !block_manager.is_swapped_out(sequence_group)) {
                 // we are here, because current sequence group has some reserved KV blocks in block manager
                 // which can be freed
                 return group_idx;
@@ -262,14 +542,14 @@ private:
         // check whether current sequence requires a new slot / block
         while (!m_block_manager->can_append_slots(sequence_group)) {
             // let's run a sequence for eviction
-            size_t evicted_sequence_group_id = _get_low_priority_sequence_group_id(sequence_groups);
+            size_t evicted_sequence_group_id = _get_low_priority_sequence_group_id(sequence_groups, *m_block_manager);
 
             if (evicted_sequence_group_id <= sequence_group_id) {
                 // we have a cycle when current group need to evict itself to be in a running state
                 break;
             }
             size_t blocks_needed = m_block_manager->required_blocks_count(sequence_group);
-            if (!_preempt_by_recompute(sequence_groups[evicted_sequence_group_id], blocks_needed)){
+            if (!_preempt(sequence_groups[evicted_sequence_group_id], blocks_needed)){
                 break;
             }
         }
@@ -282,19 +562,24 @@ private:
         // 1. To reduce discrepancy between ragged dimensions (context lengths) in Attention module
         //    we can slice prompt on chunks and schedule only portion of each prompt instead of
         //    greedy scheduling of prompt with higher priority
-        // 2. The mechanism below performs greedy scheduling of high priority prompts
+        // 2. The mechanism below performs greedy scheduling of high priority prompts, unless the chunked prefill
+        //    policy of SchedulerConfig limits the chunk of every prompt
+
+        const size_t prompt_tokens_budget = _get_prompt_tokens_budget(sequence_groups, scheduler_output);
+        const std::vector<size_t> prompt_chunk_limits = _get_prompt_chunk_limits(sequence_groups, prompt_tokens_budget);
+        size_t num_scheduled_prompt_tokens = 0;
 
         for (size_t sequence_group_id = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
             SequenceGroup::Ptr sequence_group = sequence_groups[sequence_group_id];
-            if (!sequence_group->can_generate_tokens() && !sequence_group->is_waiting() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled()) {
+            if (_is_prompt_phase_candidate(sequence_group)) {
                 size_t num_running_seqs = sequence_group->num_running_seqs();
                 // prompt phases can have a single running sequence
                 OPENVINO_ASSERT(num_running_seqs == 1);
                 Sequence::Ptr sequence = (*sequence_group)[0];
                 uint64_t seq_id = sequence->get_id();
 
-                size_t num_tokens_in_megabatch = m_config.max_num_batched_tokens - scheduler_output.m_total_num_scheduled_tokens;
-                size_t num_available_tokens = sequence_group->get_num_available_tokens_for_batching();
+                size_t num_tokens_in_megabatch = prompt_tokens_budget - num_scheduled_prompt_tokens;
+                size_t num_available_tokens = std::min(sequence_group->get_num_available_tokens_for_batching(), prompt_chunk_limits[sequence_group_id]);
 
                 // apply megabatch limitations
                 size_t num_scheduled_tokens = std::min(num_tokens_in_megabatch, num_available_tokens);
@@ -329,7 +614,7 @@ private:
                         scheduler_output.m_scheduled_sequence_groups_ids.push_back(sequence_group_id);
                         scheduler_output.m_block_tables[seq_id] = m_block_manager->get_block_tables(seq_id);
                         scheduler_output.m_total_num_scheduled_tokens += num_scheduled_tokens * num_running_seqs;
-
+                        num_scheduled_prompt_tokens += num_scheduled_tokens;
 
                         scheduler_output.m_score_aggregation_windows[seq_id] = _schedule_scores_to_aggregate(sequence_group);
                         scheduler_output.m_apply_sparse_attention_mask = m_config.use_sparse_attention && m_config.sparse_attention_config.mode == SparseAttentionMode::TRISHAPE;
@@ -350,12 +635,85 @@ private:
                 }
 
                 // if we added maximum amount of tokens to compute
-                if (scheduler_output.m_total_num_scheduled_tokens == m_config.max_num_batched_tokens)
+                if (num_scheduled_prompt_tokens == prompt_tokens_budget)
                     break;
             }
         }
     }
 
+    static bool _is_prompt_phase_candidate(const SequenceGroup::CPtr& sequence_group) {
+        return !sequence_group->can_generate_tokens() && !sequence_group->is_waiting() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled();
+    }
+
+    size_t _get_prompt_tokens_budget(const std::vector<SequenceGroup::Ptr>& sequence_groups, const Output& scheduler_output) const {
+        size_t budget = m_config.max_num_batched_tokens - scheduler_output.m_total_num_scheduled_tokens;
+        if (m_config.num_reserved_decode_tokens > 0) {
+            bool has_generating_groups = std::any_of(sequence_groups.begin(), sequence_groups.end(), [](const SequenceGroup::CPtr& sequence_group) {
+                return sequence_group->can_generate_tokens() && !sequence_group->is_waiting();
+            });
+            // without generating sequences there is nobody to reserve the tokens for
+            if (has_generating_groups)
+                budget = std::min(budget, m_config.max_num_batched_tokens - m_config.num_reserved_decode_tokens);
+        }
+        return budget;
+    }
+
+    /**
+     * Computes the maximum number of prompt tokens every sequence group can get in the current step.
+     * With fair_prompt_chunking the budget is split by max-min fairness: prompts needing less than an equal share
+     * get all their tokens, and the rest of the budget is shared equally between the longer ones.
+     */
+    std::vector<size_t> _get_prompt_chunk_limits(const std::vector<SequenceGroup::Ptr>& sequence_groups, size_t prompt_tokens_budget) const {
+        std::vector<size_t> limits(sequence_groups.size(), std::numeric_limits<size_t>::max());
+        if (m_config.max_prompt_chunk_size == 0 && !m_config.fair_prompt_chunking)
+            return limits;
+
+        // ids of prompt phase groups with the number of tokens they request
+        std::vector<std::pair<size_t, size_t>> demands;
+        for (size_t sequence_group_id = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
+            const SequenceGroup::Ptr& sequence_group = sequence_groups[sequence_group_id];
+            if (!_is_prompt_phase_candidate(sequence_group))
+                continue;
+            size_t num_tokens = sequence_group->get_num_available_tokens_for_batching();
+            if (m_config.max_prompt_chunk_size > 0)
+                num_tokens = std::min(num_tokens, m_config.max_prompt_chunk_size);
+            limits[sequence_group_id] = num_tokens;
+            demands.emplace_back(sequence_group_id, num_tokens);
+        }
+
+        if (!m_config.fair_prompt_chunking || demands.empty())
+            return limits;
+
+        // water-filling from the smallest demand up
+        std::stable_sort(demands.begin(), demands.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.second < rhs.second;
+        });
+        size_t remaining_budget = prompt_tokens_budget;
+        for (size_t demand_idx = 0; demand_idx < demands.size(); ++demand_idx) {
+            const size_t num_remaining_groups = demands.size() - demand_idx;
+            const size_t share = remaining_budget / num_remaining_groups;
+            const size_t num_tokens = demands[demand_idx].second;
+            if (num_tokens <= share) {
+                remaining_budget -= num_tokens;
+                continue;
+            }
+            // all the remaining groups request more than an equal share, so each of them gets the share
+            // and the groups coming first in scheduling order get the remainder of the division
+            std::vector<size_t> remaining_ids;
+            for (size_t idx = demand_idx; idx < demands.size(); ++idx)
+                remaining_ids.push_back(demands[idx].first);
+            std::sort(remaining_ids.begin(), remaining_ids.end());
+            size_t remainder = remaining_budget % num_remaining_groups;
+            for (size_t id : remaining_ids) {
+                limits[id] = share + (remainder > 0 ? 1 : 0);
+                if (remainder > 0)
+                    --remainder;
+            }
+            break;
+        }
+        return limits;
+    }
+
     void _schedule_generate_phase_dynamic_split_fuse(const std::vector<SequenceGroup::Ptr>& sequence_groups,
                                                      Output& scheduler_output,
                                                      std::map<size_t, std::list<size_t>>& block_copy_map) {
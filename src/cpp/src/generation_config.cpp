@@ -158,6 +158,11 @@ void GenerationConfig::update_generation_config(const ov::AnyMap& properties) {
     // CDPruner
     read_anymap_param(properties, "pruning_ratio", pruning_ratio);
     read_anymap_param(properties, "relevance_weight", relevance_weight);
+
+    // scheduling
+    read_anymap_param(properties, "priority", priority);
+    read_anymap_param(properties, "ttft_deadline_ms", ttft_deadline_ms);
+    read_anymap_param(properties, "tpot_deadline_ms", tpot_deadline_ms);
 }
 
 
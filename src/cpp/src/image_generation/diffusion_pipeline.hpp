@@ -14,6 +14,7 @@
 
 #include "openvino/genai/image_generation/generation_config.hpp"
 #include "openvino/genai/image_generation/autoencoder_kl.hpp"
+#include "openvino/genai/image_generation/text2image_pipeline.hpp"
 
 #include "lora/helper.hpp"
 #include "lora/names_mapping.hpp"
@@ -122,6 +123,20 @@ public:
 
     virtual ov::Tensor generate(const std::string& positive_prompt, ov::Tensor initial_image, ov::Tensor mask_image, const ov::AnyMap& properties) = 0;
 
+    /**
+     * Generates images for several prompts. By default, prompts are generated one after another.
+     */
+    virtual std::vector<ImageGenerationResult> generate_batch(const std::vector<std::string>& positive_prompts,
+                                                              const std::vector<ov::AnyMap>& properties) {
+        OPENVINO_ASSERT(positive_prompts.size() == properties.size(), "Each prompt must have its own properties");
+        std::vector<ImageGenerationResult> results(positive_prompts.size());
+        for (size_t idx = 0; idx < positive_prompts.size(); ++idx) {
+            results[idx].image = generate(positive_prompts[idx], {}, {}, properties[idx]);
+            results[idx].performance_stat = get_performance_metrics();
+        }
+        return results;
+    }
+
     virtual ov::Tensor decode(const ov::Tensor latent) = 0;
 
     virtual ImageGenerationPerfMetrics get_performance_metrics() = 0;
@@ -222,7 +237,7 @@ protected:
 
             // encode masked image to latent scape
             auto encode_start = std::chrono::steady_clock::now();
-            masked_image_latent = m_vae->encode(masked_image, generation_config.generator);
+            masked_image_latent = m_vae->encode(masked_image, generation_config.generator, generation_config.vae_tiling_config);
             m_perf_metrics.vae_encoder_inference_duration += std::chrono::duration_cast<std::chrono::milliseconds>(
                                                              std::chrono::steady_clock::now() - encode_start).count();
             masked_image_latent = numpy_utils::repeat(masked_image_latent, generation_config.num_images_per_prompt * batch_size_multiplier);
@@ -102,7 +102,7 @@ public:
 
         // Encode the masked image
         auto encode_start = std::chrono::steady_clock::now();
-        ov::Tensor masked_image_latent = m_vae->encode(processed_image, generation_config.generator);
+        ov::Tensor masked_image_latent = m_vae->encode(processed_image, generation_config.generator, generation_config.vae_tiling_config);
         m_perf_metrics.vae_encoder_inference_duration =
             std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - encode_start).count();
 
@@ -200,7 +200,7 @@ public:
 
         latents = unpack_latents(latents, m_custom_generation_config.height, m_custom_generation_config.width, vae_scale_factor);
         const auto decode_start = std::chrono::steady_clock::now();
-        auto image = m_vae->decode(latents);
+        auto image = m_vae->decode(latents, m_custom_generation_config.vae_tiling_config);
         m_perf_metrics.vae_decoder_inference_duration =
             std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - decode_start)
                 .count();
@@ -356,7 +356,7 @@ public:
             proccesed_image = m_image_resizer->execute(initial_image, generation_config.height, generation_config.width);
             proccesed_image = m_image_processor->execute(proccesed_image);
             auto encode_start = std::chrono::steady_clock::now();
-            image_latents = m_vae->encode(proccesed_image, generation_config.generator);
+            image_latents = m_vae->encode(proccesed_image, generation_config.generator, generation_config.vae_tiling_config);
             m_perf_metrics.vae_encoder_inference_duration =
                 std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - encode_start)
                     .count();
@@ -561,7 +561,7 @@ public:
 
         latents = unpack_latents(latents, m_custom_generation_config.height, m_custom_generation_config.width, vae_scale_factor);
         const auto decode_start = std::chrono::steady_clock::now();
-        auto image = m_vae->decode(latents);
+        auto image = m_vae->decode(latents, m_custom_generation_config.vae_tiling_config);
         m_perf_metrics.vae_decoder_inference_duration =
             std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - decode_start)
                 .count();
@@ -575,7 +575,7 @@ public:
                                      m_custom_generation_config.height,
                                      m_custom_generation_config.width,
                                      m_vae->get_vae_scale_factor());
-        return m_vae->decode(unpacked_latent);
+        return m_vae->decode(unpacked_latent, m_custom_generation_config.vae_tiling_config);
     }
 
     ImageGenerationPerfMetrics get_performance_metrics() override {
@@ -16,6 +16,7 @@
 
 #include "utils.hpp"
 
+#include "image_generation/vae_tiling.hpp"
 #include "json_utils.hpp"
 #include "lora/helper.hpp"
 
@@ -269,22 +270,57 @@ AutoencoderKL& AutoencoderKL::compile(const std::string& device, const ov::AnyMa
     return *this;
 }
 
-ov::Tensor AutoencoderKL::decode(ov::Tensor latent) {
+ov::Tensor AutoencoderKL::decode(ov::Tensor latent, const std::optional<VAETilingConfig>& tiling_config) {
     OPENVINO_ASSERT(m_decoder_request, "VAE decoder model must be compiled first. Cannot infer non-compiled model");
 
-    m_decoder_request.set_input_tensor(latent);
-    m_decoder_request.infer();
-    return m_decoder_request.get_output_tensor();
+    const ov::Shape latent_shape = latent.get_shape();
+    const size_t vae_scale_factor = get_vae_scale_factor();
+    std::vector<vae_tiling::TileRange> h_tiles, w_tiles;
+    if (tiling_config) {
+        tiling_config->validate();
+        const size_t tile_size = tiling_config->tile_size / vae_scale_factor, tile_overlap = tiling_config->tile_overlap / vae_scale_factor;
+        h_tiles = vae_tiling::split_spatial(latent_shape[2], tile_size, tile_overlap, vae_scale_factor);
+        w_tiles = vae_tiling::split_spatial(latent_shape[3], tile_size, tile_overlap, vae_scale_factor);
+    }
+
+    if (h_tiles.size() <= 1 && w_tiles.size() <= 1) {
+        m_decoder_request.set_input_tensor(latent);
+        m_decoder_request.infer();
+        return m_decoder_request.get_output_tensor();
+    }
+
+    OPENVINO_ASSERT(m_decoder_request.get_compiled_model().input(0).get_partial_shape().is_dynamic(),
+                    "Tiled VAE decoding requires VAE decoder with dynamic shapes, while it's reshaped to static shape");
+
+    // decoded tiles are [N, H, W, C] u8 images, which are blended in pixel space
+    const size_t height = latent_shape[2] * vae_scale_factor, width = latent_shape[3] * vae_scale_factor;
+    std::optional<vae_tiling::TileBlender> blender;
+    ov::Shape image_shape;
+    for (const auto& h_tile : h_tiles) {
+        for (const auto& w_tile : w_tiles) {
+            m_decoder_request.set_input_tensor(vae_tiling::crop(latent,
+                {0, 0, h_tile.latent_begin, w_tile.latent_begin},
+                {latent_shape[0], latent_shape[1], h_tile.latent_end, w_tile.latent_end}));
+            m_decoder_request.infer();
+            ov::Tensor image_tile = m_decoder_request.get_output_tensor();
+
+            if (!blender) {
+                image_shape = {latent_shape[0], height, width, image_tile.get_shape()[3]};
+                const size_t blend = tiling_config->tile_overlap / vae_scale_factor * vae_scale_factor;
+                blender.emplace(std::array<size_t, 5>{latent_shape[0], image_shape[3], 1, height, width}, true, std::array<size_t, 3>{0, blend, blend});
+            }
+            blender->add_tile(image_tile, 0, 1, h_tile.sample_begin, h_tile.sample_end, w_tile.sample_begin, w_tile.sample_end);
+        }
+    }
+
+    return blender->get_output(ov::element::u8, image_shape);
 }
 
-ov::Tensor AutoencoderKL::encode(ov::Tensor image, std::shared_ptr<Generator> generator) {
+ov::Tensor AutoencoderKL::encode(ov::Tensor image, std::shared_ptr<Generator> generator, const std::optional<VAETilingConfig>& tiling_config) {
     OPENVINO_ASSERT(m_encoder_request || m_encoder_model, "AutoencoderKL is created without 'VAE encoder' capability. Please, pass extra argument to constructor to create 'VAE encoder'");
     OPENVINO_ASSERT(m_encoder_request, "VAE encoder model must be compiled first. Cannot infer non-compiled model");
 
-    m_encoder_request.set_input_tensor(image);
-    m_encoder_request.infer();
-
-    ov::Tensor output = m_encoder_request.get_output_tensor(), latent;
+    ov::Tensor output = encode_tiled(image, tiling_config), latent;
 
     ov::CompiledModel compiled_model = m_encoder_request.get_compiled_model();
     auto outputs = compiled_model.outputs();
@@ -308,6 +344,50 @@ ov::Tensor AutoencoderKL::encode(ov::Tensor image, std::shared_ptr<Generator> ge
     return latent;
 }
 
+ov::Tensor AutoencoderKL::encode_tiled(ov::Tensor image, const std::optional<VAETilingConfig>& tiling_config) {
+    const ov::Shape image_shape = image.get_shape();
+    const size_t vae_scale_factor = get_vae_scale_factor();
+    std::vector<vae_tiling::TileRange> h_tiles, w_tiles;
+    if (tiling_config) {
+        tiling_config->validate();
+        const size_t tile_size = tiling_config->tile_size / vae_scale_factor, tile_overlap = tiling_config->tile_overlap / vae_scale_factor;
+        h_tiles = vae_tiling::split_spatial(image_shape[2] / vae_scale_factor, tile_size, tile_overlap, vae_scale_factor);
+        w_tiles = vae_tiling::split_spatial(image_shape[3] / vae_scale_factor, tile_size, tile_overlap, vae_scale_factor);
+    }
+
+    if (h_tiles.size() <= 1 && w_tiles.size() <= 1) {
+        m_encoder_request.set_input_tensor(image);
+        m_encoder_request.infer();
+        return m_encoder_request.get_output_tensor();
+    }
+
+    OPENVINO_ASSERT(m_encoder_request.get_compiled_model().input(0).get_partial_shape().is_dynamic(),
+                    "Tiled VAE encoding requires VAE encoder with dynamic shapes, while it's reshaped to static shape");
+
+    // encoder outputs of tiles are blended in latent space before sampling, so the distribution stays consistent
+    const size_t latent_height = image_shape[2] / vae_scale_factor, latent_width = image_shape[3] / vae_scale_factor;
+    std::optional<vae_tiling::TileBlender> blender;
+    ov::Shape output_shape;
+    for (const auto& h_tile : h_tiles) {
+        for (const auto& w_tile : w_tiles) {
+            m_encoder_request.set_input_tensor(vae_tiling::crop(image,
+                {0, 0, h_tile.sample_begin, w_tile.sample_begin},
+                {image_shape[0], image_shape[1], h_tile.sample_end, w_tile.sample_end}));
+            m_encoder_request.infer();
+            ov::Tensor output_tile = m_encoder_request.get_output_tensor();
+
+            if (!blender) {
+                output_shape = {image_shape[0], output_tile.get_shape()[1], latent_height, latent_width};
+                const size_t blend = tiling_config->tile_overlap / vae_scale_factor;
+                blender.emplace(std::array<size_t, 5>{output_shape[0], output_shape[1], 1, latent_height, latent_width}, false, std::array<size_t, 3>{0, blend, blend});
+            }
+            blender->add_tile(output_tile, 0, 1, h_tile.latent_begin, h_tile.latent_end, w_tile.latent_begin, w_tile.latent_end);
+        }
+    }
+
+    return blender->get_output(ov::element::f32, output_shape);
+}
+
 const AutoencoderKL::Config& AutoencoderKL::get_config() const {
     return m_config;
 }
@@ -476,7 +476,7 @@ public:
             proccesed_image = m_image_resizer->execute(initial_image, generation_config.height, generation_config.width);
             proccesed_image = m_image_processor->execute(proccesed_image);
 
-            image_latents = m_vae->encode(proccesed_image, generation_config.generator);
+            image_latents = m_vae->encode(proccesed_image, generation_config.generator, generation_config.vae_tiling_config);
             if (m_pipeline_type == PipelineType::INPAINTING) {
                 image_latents = numpy_utils::repeat(image_latents, generation_config.num_images_per_prompt);
             }
@@ -639,7 +639,7 @@ public:
             callback_ptr->end();
         }
         auto decode_start = std::chrono::steady_clock::now();
-        auto image = decode(latent);
+        auto image = m_vae->decode(latent, generation_config.vae_tiling_config);
         m_perf_metrics.vae_decoder_inference_duration =
             std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - decode_start)
                 .count();
@@ -649,7 +649,7 @@ public:
     }
 
     ov::Tensor decode(const ov::Tensor latent) override {
-        return m_vae->decode(latent);
+        return m_vae->decode(latent, m_generation_config.vae_tiling_config);
     }
 
     ImageGenerationPerfMetrics get_performance_metrics() override {
@@ -0,0 +1,347 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "image_generation/stable_diffusion_batched_engine.hpp"
+
+#include <algorithm>
+#include <map>
+#include <tuple>
+
+#include "image_generation/stable_diffusion_pipeline.hpp"
+#include "openvino/genai/perf_metrics.hpp"
+
+namespace ov {
+namespace genai {
+
+ImageGenerationRequest::ImageGenerationRequest(uint64_t request_id,
+                                               const std::string& prompt,
+                                               const ImageGenerationConfig& config,
+                                               const std::function<bool(size_t, size_t, ov::Tensor&)>& callback)
+    : m_request_id(request_id),
+      m_prompt(prompt),
+      m_config(config),
+      m_callback(callback),
+      m_start_time(std::chrono::steady_clock::now()) {
+    m_result.performance_stat.clean_up();
+}
+
+uint64_t ImageGenerationRequest::get_request_id() const {
+    return m_request_id;
+}
+
+GenerationStatus ImageGenerationRequest::get_status() const {
+    return m_status;
+}
+
+bool ImageGenerationRequest::has_finished() const {
+    return m_status != GenerationStatus::RUNNING;
+}
+
+void ImageGenerationRequest::stop() {
+    m_stop_requested = true;
+}
+
+ImageGenerationResult& ImageGenerationRequest::get_result() {
+    OPENVINO_ASSERT(has_finished(), "Image generation request ", m_request_id, " has not finished");
+    return m_result;
+}
+
+StableDiffusionBatchedEngine::StableDiffusionBatchedEngine(StableDiffusionPipeline& pipeline, size_t max_batch_size)
+    : m_pipeline(pipeline),
+      m_max_batch_size(max_batch_size) {
+    OPENVINO_ASSERT(m_max_batch_size > 0, "Max batch size of the image generation engine must be greater than 0");
+    OPENVINO_ASSERT(m_pipeline.m_pipeline_type == PipelineType::TEXT_2_IMAGE,
+                    "Batched image generation is supported for text to image pipeline only");
+    OPENVINO_ASSERT(!m_pipeline.m_root_dir.empty(), "Batched image generation requires pipeline root directory");
+}
+
+ImageGenerationRequest::Ptr StableDiffusionBatchedEngine::add_request(uint64_t request_id,
+                                                                      const std::string& prompt,
+                                                                      const ov::AnyMap& properties) {
+    ImageGenerationConfig config = m_pipeline.m_generation_config;
+    // the generator of the pipeline config is shared by requests, a seeded request needs its own one to be reproducible
+    if (properties.find(ov::genai::generator.name()) == properties.end() &&
+        properties.find(ov::genai::rng_seed.name()) != properties.end()) {
+        config.generator = std::make_shared<CppStdGenerator>(config.rng_seed);
+    }
+    OPENVINO_ASSERT(properties.find("adapters") == properties.end(),
+                    "LoRA adapters can't be set per request of batched image generation");
+    config.update_generation_config(properties);
+
+    if (config.height < 0)
+        m_pipeline.compute_dim(config.height, {}, 1 /* assume NHWC */);
+    if (config.width < 0)
+        m_pipeline.compute_dim(config.width, {}, 2 /* assume NHWC */);
+    m_pipeline.check_inputs(config, {});
+
+    std::function<bool(size_t, size_t, ov::Tensor&)> callback;
+    auto callback_iter = properties.find(ov::genai::callback.name());
+    if (callback_iter != properties.end()) {
+        callback = callback_iter->second.as<std::function<bool(size_t, size_t, ov::Tensor&)>>();
+    }
+
+    ImageGenerationRequest::Ptr request{new ImageGenerationRequest(request_id, prompt, config, callback)};
+    request->m_scheduler = std::dynamic_pointer_cast<IScheduler>(
+        Scheduler::from_config(m_pipeline.m_root_dir / "scheduler/scheduler_config.json"));
+    OPENVINO_ASSERT(request->m_scheduler != nullptr, "Passed incorrect scheduler type");
+
+    std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
+    m_awaiting_requests.push_back(request);
+    return request;
+}
+
+bool StableDiffusionBatchedEngine::has_non_finished_requests() {
+    std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
+    return !m_awaiting_requests.empty() || !m_requests.empty();
+}
+
+void StableDiffusionBatchedEngine::step() {
+    pull_awaiting_requests();
+
+    // the timestep is shared by the whole UNet batch, other inputs must have the same shapes
+    std::map<std::tuple<int64_t, int64_t, size_t, int64_t>, std::vector<ImageGenerationRequest::Ptr>> groups;
+    for (const auto& request : m_requests) {
+        if (request->has_finished()) {
+            continue;
+        }
+        if (request->m_stop_requested) {
+            finish_request(*request, GenerationStatus::STOP);
+            continue;
+        }
+        const ImageGenerationConfig& config = request->m_config;
+        groups[{config.height, config.width, request->m_batch_size_multiplier, request->m_timesteps[request->m_inference_step]}]
+            .push_back(request);
+    }
+
+    for (const auto& [key, requests] : groups) {
+        denoise(requests);
+    }
+
+    m_requests.erase(std::remove_if(m_requests.begin(),
+                                    m_requests.end(),
+                                    [](const ImageGenerationRequest::Ptr& request) {
+                                        return request->has_finished();
+                                    }),
+                     m_requests.end());
+}
+
+void StableDiffusionBatchedEngine::clear_requests() {
+    {
+        std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
+        for (const auto& request : m_awaiting_requests) {
+            request->m_status = GenerationStatus::CANCEL;
+        }
+        m_awaiting_requests.clear();
+    }
+    for (const auto& request : m_requests) {
+        request->m_callback.end();
+        request->m_status = GenerationStatus::CANCEL;
+    }
+    m_requests.clear();
+}
+
+void StableDiffusionBatchedEngine::pull_awaiting_requests() {
+    size_t num_running_images = 0;
+    for (const auto& request : m_requests) {
+        num_running_images += request->m_config.num_images_per_prompt;
+    }
+
+    std::vector<ImageGenerationRequest::Ptr> admitted_requests;
+    {
+        std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
+        // requests are admitted in the order they were added, a request larger than the limit runs alone
+        auto request_it = m_awaiting_requests.begin();
+        for (; request_it != m_awaiting_requests.end(); ++request_it) {
+            const size_t num_images = (*request_it)->m_config.num_images_per_prompt;
+            if (num_running_images > 0 && num_running_images + num_images > m_max_batch_size) {
+                break;
+            }
+            num_running_images += num_images;
+            admitted_requests.push_back(*request_it);
+        }
+        m_awaiting_requests.erase(m_awaiting_requests.begin(), request_it);
+    }
+
+    for (const auto& request : admitted_requests) {
+        m_requests.push_back(request);
+        start_request(*request);
+    }
+}
+
+void StableDiffusionBatchedEngine::start_request(ImageGenerationRequest& request) {
+    const ImageGenerationConfig& config = request.m_config;
+    ImageGenerationPerfMetrics& perf_metrics = request.m_result.performance_stat;
+    const auto& unet_config = m_pipeline.m_unet->get_config();
+    request.m_batch_size_multiplier = m_pipeline.m_unet->do_classifier_free_guidance(config.guidance_scale) ? 2 : 1;
+
+    request.m_scheduler->set_timesteps(config.num_inference_steps, config.strength);
+    request.m_timesteps = request.m_scheduler->get_timesteps();
+    OPENVINO_ASSERT(!request.m_timesteps.empty(), "Timesteps are not computed yet");
+
+    const std::string negative_prompt = config.negative_prompt != std::nullopt ? *config.negative_prompt : std::string{};
+    const auto infer_start = std::chrono::steady_clock::now();
+    ov::Tensor encoder_hidden_states =
+        m_pipeline.m_clip_text_encoder->infer(request.m_prompt, negative_prompt, request.m_batch_size_multiplier > 1);
+    perf_metrics.encoder_inference_duration["text_encoder"] =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - infer_start).count();
+    // the output of text encoder is overwritten by the next request
+    request.m_encoder_hidden_states = ov::Tensor(encoder_hidden_states.get_element_type(), encoder_hidden_states.get_shape());
+    encoder_hidden_states.copy_to(request.m_encoder_hidden_states);
+
+    if (unet_config.time_cond_proj_dim >= 0) {  // LCM
+        request.m_timestep_cond = get_guidance_scale_embedding(config.guidance_scale - 1.0f, unet_config.time_cond_proj_dim);
+    }
+
+    const size_t vae_scale_factor = m_pipeline.m_vae->get_vae_scale_factor();
+    ov::Shape latent_shape{config.num_images_per_prompt, m_pipeline.m_vae->get_config().latent_channels,
+                           config.height / vae_scale_factor, config.width / vae_scale_factor};
+    ov::Tensor noise = config.generator->randn_tensor(latent_shape);
+    request.m_latent = ov::Tensor(ov::element::f32, latent_shape);
+
+    // scale the initial latents by the Scheduler's init sigma
+    const float* noise_data = noise.data<const float>();
+    float* latent_data = request.m_latent.data<float>();
+    for (size_t i = 0; i < request.m_latent.get_size(); ++i)
+        latent_data[i] = noise_data[i] * request.m_scheduler->get_init_noise_sigma();
+
+    request.m_callback.start();
+}
+
+void StableDiffusionBatchedEngine::denoise(const std::vector<ImageGenerationRequest::Ptr>& requests) {
+    const auto step_start = std::chrono::steady_clock::now();
+    const ImageGenerationRequest& first_request = *requests.front();
+
+    size_t batch_size = 0;
+    for (const auto& request : requests) {
+        OPENVINO_ASSERT(request->m_encoder_hidden_states.get_shape() == first_request.m_encoder_hidden_states.get_shape(),
+                        "Text encoder outputs of batched requests must have the same shape");
+        batch_size += request->m_config.num_images_per_prompt * request->m_batch_size_multiplier;
+    }
+
+    ov::Shape sample_shape = first_request.m_latent.get_shape();
+    sample_shape[0] = batch_size;
+    ov::Shape hidden_states_shape = first_request.m_encoder_hidden_states.get_shape();
+    hidden_states_shape[0] = batch_size;
+    ov::Tensor sample(ov::element::f32, sample_shape), timestep_cond;
+    ov::Tensor encoder_hidden_states(first_request.m_encoder_hidden_states.get_element_type(), hidden_states_shape);
+    if (first_request.m_timestep_cond) {
+        ov::Shape timestep_cond_shape = first_request.m_timestep_cond.get_shape();
+        timestep_cond_shape[0] = batch_size;
+        timestep_cond = ov::Tensor(ov::element::f32, timestep_cond_shape);
+    }
+
+    // the UNet batch of a request is its latent concatenated twice in case of CFG, the first half is for negative prompt
+    size_t batch_offset = 0;
+    for (const auto& request : requests) {
+        const size_t num_images = request->m_config.num_images_per_prompt;
+        const size_t request_batch_size = num_images * request->m_batch_size_multiplier;
+
+        ov::Shape latent_shape_cfg = request->m_latent.get_shape();
+        latent_shape_cfg[0] = request_batch_size;
+        ov::Tensor latent_cfg(ov::element::f32, latent_shape_cfg);
+        for (size_t part = 0; part < request->m_batch_size_multiplier; ++part) {
+            numpy_utils::batch_copy(request->m_latent, latent_cfg, 0, part * num_images, num_images);
+            for (size_t n = 0; n < num_images; ++n) {
+                numpy_utils::batch_copy(request->m_encoder_hidden_states, encoder_hidden_states, part,
+                                        batch_offset + part * num_images + n);
+            }
+        }
+        request->m_scheduler->scale_model_input(latent_cfg, request->m_inference_step);
+        numpy_utils::batch_copy(latent_cfg, sample, 0, batch_offset, request_batch_size);
+
+        if (timestep_cond) {
+            for (size_t n = 0; n < request_batch_size; ++n) {
+                numpy_utils::batch_copy(request->m_timestep_cond, timestep_cond, 0, batch_offset + n);
+            }
+        }
+        batch_offset += request_batch_size;
+    }
+
+    m_pipeline.m_unet->set_hidden_states("encoder_hidden_states", encoder_hidden_states);
+    if (timestep_cond) {
+        m_pipeline.m_unet->set_hidden_states("timestep_cond", timestep_cond);
+    }
+
+    int64_t timestep_value = first_request.m_timesteps[first_request.m_inference_step];
+    ov::Tensor timestep(ov::element::i64, {1}, &timestep_value);
+    const auto infer_start = std::chrono::steady_clock::now();
+    ov::Tensor noise_pred_tensor = m_pipeline.m_unet->infer(sample, timestep);
+    const auto infer_duration = PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start);
+    const size_t noise_pred_batch_stride = noise_pred_tensor.get_size() / batch_size;
+
+    std::vector<bool> stopped_requests(requests.size(), false);
+    batch_offset = 0;
+    for (size_t idx = 0; idx < requests.size(); ++idx) {
+        ImageGenerationRequest& request = *requests[idx];
+        const size_t num_steps = request.m_timesteps.size();
+
+        ov::Tensor noisy_residual_tensor(ov::element::f32, request.m_latent.get_shape());
+        float* noisy_residual = noisy_residual_tensor.data<float>();
+        const float* noise_pred_uncond = noise_pred_tensor.data<const float>() + batch_offset * noise_pred_batch_stride;
+        if (request.m_batch_size_multiplier > 1) {
+            // perform guidance
+            const float* noise_pred_text = noise_pred_uncond + noisy_residual_tensor.get_size();
+            for (size_t i = 0; i < noisy_residual_tensor.get_size(); ++i) {
+                noisy_residual[i] = noise_pred_uncond[i] +
+                    request.m_config.guidance_scale * (noise_pred_text[i] - noise_pred_uncond[i]);
+            }
+        } else {
+            std::copy_n(noise_pred_uncond, noisy_residual_tensor.get_size(), noisy_residual);
+        }
+        batch_offset += request.m_config.num_images_per_prompt * request.m_batch_size_multiplier;
+
+        auto scheduler_step_result = request.m_scheduler->step(noisy_residual_tensor,
+                                                               request.m_latent,
+                                                               request.m_inference_step,
+                                                               request.m_config.generator);
+        request.m_latent = scheduler_step_result["latent"];
+
+        // check whether scheduler returns "denoised" image, which should be passed to VAE decoder
+        const auto it = scheduler_step_result.find("denoised");
+        request.m_denoised = it != scheduler_step_result.end() ? it->second : request.m_latent;
+
+        request.m_result.performance_stat.raw_metrics.unet_inference_durations.emplace_back(MicroSeconds(infer_duration));
+        stopped_requests[idx] = request.m_callback.has_callback() &&
+            request.m_callback.write(request.m_inference_step, num_steps, request.m_denoised) == CallbackStatus::STOP;
+        ++request.m_inference_step;
+    }
+
+    // each request of the batch spends the whole step
+    const auto step_duration = PerfMetrics::get_microsec(std::chrono::steady_clock::now() - step_start);
+    for (size_t idx = 0; idx < requests.size(); ++idx) {
+        ImageGenerationRequest& request = *requests[idx];
+        request.m_result.performance_stat.raw_metrics.iteration_durations.emplace_back(MicroSeconds(step_duration));
+        if (stopped_requests[idx]) {
+            finish_request(request, GenerationStatus::STOP);
+        } else if (request.m_inference_step == request.m_timesteps.size()) {
+            finish_request(request, GenerationStatus::FINISHED);
+        }
+    }
+}
+
+void StableDiffusionBatchedEngine::finish_request(ImageGenerationRequest& request, GenerationStatus status) {
+    request.m_callback.end();
+    ImageGenerationPerfMetrics& perf_metrics = request.m_result.performance_stat;
+
+    if (status == GenerationStatus::FINISHED) {
+        const auto decode_start = std::chrono::steady_clock::now();
+        request.m_result.image = m_pipeline.m_vae->decode(request.m_denoised, request.m_config.vae_tiling_config);
+        perf_metrics.vae_decoder_inference_duration =
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - decode_start).count();
+    } else {
+        request.m_result.image = ov::Tensor(ov::element::u8, {});
+    }
+
+    perf_metrics.load_time = m_pipeline.m_load_time_ms;
+    perf_metrics.generate_duration =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - request.m_start_time).count();
+
+    // intermediate tensors are not needed anymore
+    request.m_encoder_hidden_states = {};
+    request.m_latent = {};
+    request.m_denoised = {};
+    request.m_status = status;
+}
+
+}  // namespace genai
+}  // namespace ov
@@ -0,0 +1,132 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "image_generation/schedulers/ischeduler.hpp"
+#include "image_generation/threaded_callback.hpp"
+
+#include "openvino/genai/generation_handle.hpp"
+#include "openvino/genai/image_generation/generation_config.hpp"
+#include "openvino/genai/image_generation/text2image_pipeline.hpp"
+
+namespace ov {
+namespace genai {
+
+class StableDiffusionPipeline;
+
+/**
+ * @brief Handle of a prompt added to StableDiffusionBatchedEngine.
+ * The result is available once the request has finished.
+ */
+class ImageGenerationRequest {
+public:
+    using Ptr = std::shared_ptr<ImageGenerationRequest>;
+
+    uint64_t get_request_id() const;
+
+    GenerationStatus get_status() const;
+
+    bool has_finished() const;
+
+    /**
+     * @brief Stops denoising of the request before the next step, its result has an empty image.
+     */
+    void stop();
+
+    /**
+     * @return Images and metrics of the request, which must have finished.
+     */
+    ImageGenerationResult& get_result();
+
+private:
+    friend class StableDiffusionBatchedEngine;
+
+    ImageGenerationRequest(uint64_t request_id,
+                           const std::string& prompt,
+                           const ImageGenerationConfig& config,
+                           const std::function<bool(size_t, size_t, ov::Tensor&)>& callback);
+
+    uint64_t m_request_id;
+    std::string m_prompt;
+    ImageGenerationConfig m_config;
+    ThreadedCallbackWrapper m_callback;
+    std::chrono::steady_clock::time_point m_start_time;
+
+    // 2 in case of classifier free guidance, the UNet batch of the request is m_batch_size_multiplier * num_images_per_prompt
+    size_t m_batch_size_multiplier = 1;
+    std::shared_ptr<IScheduler> m_scheduler;
+    std::vector<int64_t> m_timesteps;
+    size_t m_inference_step = 0;
+    // [m_batch_size_multiplier, sequence length, hidden size] output of text encoder, negative prompt goes first
+    ov::Tensor m_encoder_hidden_states;
+    // guidance scale embedding of LCM
+    ov::Tensor m_timestep_cond;
+    ov::Tensor m_latent, m_denoised;
+    ImageGenerationResult m_result;
+
+    std::atomic<GenerationStatus> m_status{GenerationStatus::RUNNING};
+    std::atomic<bool> m_stop_requested{false};
+};
+
+/**
+ * @brief Generates images for many text to image requests of a Stable Diffusion or LCM pipeline at once.
+ * The UNet timestep input is a scalar, so requests are denoised together when they are at the same timestep and have
+ * the same latent shape and guidance mode. Each step runs a single UNet inference per such group: the latents,
+ * encoder hidden states and LCM guidance embeddings of the requests are concatenated along the batch dimension, and
+ * the noise prediction is split back to apply guidance scale and scheduler step of each request.
+ * Requests are admitted between steps while the running ones have less than max_batch_size images, with their own
+ * scheduler, random generator and callback. A request leaves the engine once it has been denoised and decoded by VAE,
+ * or stopped by its callback or handle.
+ * The UNet must be compiled with a dynamic batch dimension.
+ */
+class StableDiffusionBatchedEngine {
+public:
+    StableDiffusionBatchedEngine(StableDiffusionPipeline& pipeline, size_t max_batch_size);
+
+    /**
+     * @brief Validates generation parameters and adds the prompt to be generated by the next steps.
+     * @param properties Generation parameters of the request, which override the pipeline generation config.
+     * If a generator is not passed, the request uses its own generator initialized with rng_seed.
+     */
+    ImageGenerationRequest::Ptr add_request(uint64_t request_id, const std::string& prompt, const ov::AnyMap& properties);
+
+    bool has_non_finished_requests();
+
+    /**
+     * @brief Admits awaiting requests and makes a denoising step of all running requests.
+     */
+    void step();
+
+    /**
+     * @brief Drops all requests, e.g. after a step has thrown an exception.
+     */
+    void clear_requests();
+
+private:
+    void pull_awaiting_requests();
+
+    // encodes the prompt and initializes latent of a request
+    void start_request(ImageGenerationRequest& request);
+
+    // a single UNet inference for requests at the same timestep
+    void denoise(const std::vector<ImageGenerationRequest::Ptr>& requests);
+
+    void finish_request(ImageGenerationRequest& request, GenerationStatus status);
+
+    StableDiffusionPipeline& m_pipeline;
+    size_t m_max_batch_size;
+
+    std::vector<ImageGenerationRequest::Ptr> m_requests;
+    std::mutex m_awaiting_requests_mutex;
+    std::vector<ImageGenerationRequest::Ptr> m_awaiting_requests;
+};
+
+}  // namespace genai
+}  // namespace ov
@@ -3,12 +3,15 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 #include <memory>
 #include <filesystem>
+#include <typeinfo>
 
 #include "image_generation/diffusion_pipeline.hpp"
+#include "image_generation/stable_diffusion_batched_engine.hpp"
 #include "image_generation/threaded_callback.hpp"
 
 #include "openvino/genai/image_generation/clip_text_model.hpp"
@@ -26,6 +29,9 @@ namespace genai {
 
 class StableDiffusionPipeline : public DiffusionPipeline {
 public:
+    // max number of images denoised at once by batched generation
+    static constexpr size_t BATCHED_GENERATION_MAX_IMAGES = 8;
+
     explicit StableDiffusionPipeline(PipelineType pipeline_type) :
         DiffusionPipeline(pipeline_type) {}
 
@@ -96,6 +102,7 @@ public:
         const std::string unet = data["unet"][1].get<std::string>();
         if (unet == "UNet2DConditionModel") {
             m_unet = std::make_shared<UNet2DConditionModel>(root_dir / "unet", device, *updated_properties);
+            m_is_unet_batch_dynamic = device != "NPU";
         } else {
             OPENVINO_THROW("Unsupported '", unet, "' UNet type");
         }
@@ -158,6 +165,7 @@ public:
         const size_t batch_size_multiplier = m_unet->do_classifier_free_guidance(guidance_scale) ? 2 : 1;  // Unet accepts 2x batch in case of CFG
         m_clip_text_encoder->reshape(batch_size_multiplier);
         m_unet->reshape(num_images_per_prompt * batch_size_multiplier, height, width, m_clip_text_encoder->get_config().max_position_embeddings);
+        m_is_unet_batch_dynamic = false;
         m_vae->reshape(num_images_per_prompt, height, width);
     }
 
@@ -170,6 +178,7 @@ public:
 
         m_clip_text_encoder->compile(text_encode_device, *updated_properties);
         m_unet->compile(denoise_device, *updated_properties);
+        m_is_unet_batch_dynamic = m_is_unet_batch_dynamic && denoise_device != "NPU";
         m_vae->compile(vae_device, *updated_properties);
     }
 
@@ -188,6 +197,7 @@ public:
         pipeline->m_root_dir = m_root_dir;
         pipeline->set_scheduler(Scheduler::from_config(m_root_dir / "scheduler/scheduler_config.json"));
         pipeline->set_generation_config(m_generation_config);
+        pipeline->m_is_unet_batch_dynamic = m_is_unet_batch_dynamic;
         return pipeline;
     }
 
@@ -252,7 +262,7 @@ public:
             // - inpainting with non-specialized model
             if (!is_strength_max || return_image_latent) {
                 auto encode_start = std::chrono::steady_clock::now();
-                image_latent = m_vae->encode(proccesed_image, generation_config.generator);
+                image_latent = m_vae->encode(proccesed_image, generation_config.generator, generation_config.vae_tiling_config);
                 m_perf_metrics.vae_encoder_inference_duration = std::chrono::duration_cast<std::chrono::milliseconds>(
                                                                     std::chrono::steady_clock::now() - encode_start)
                                                                     .count();
@@ -415,7 +425,7 @@ public:
             callback_ptr->end();
         }
         auto decode_start = std::chrono::steady_clock::now();
-        auto image = decode(denoised);
+        auto image = m_vae->decode(denoised, generation_config.vae_tiling_config);
         m_perf_metrics.vae_decoder_inference_duration =
             std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - decode_start)
                 .count();
@@ -424,8 +434,49 @@ public:
         return image;
     }
 
+    std::vector<ImageGenerationResult> generate_batch(const std::vector<std::string>& positive_prompts,
+                                                      const std::vector<ov::AnyMap>& properties) override {
+        OPENVINO_ASSERT(positive_prompts.size() == properties.size(), "Each prompt must have its own properties");
+        // requests share the UNet inference with their own schedulers, which are created from the pipeline folder
+        const bool has_request_adapters = std::any_of(properties.begin(), properties.end(), [](const ov::AnyMap& request_properties) {
+            return request_properties.find("adapters") != request_properties.end();
+        });
+        bool is_batched = m_pipeline_type == PipelineType::TEXT_2_IMAGE && m_is_unet_batch_dynamic &&
+            !m_root_dir.empty() && !has_request_adapters;
+        if (is_batched) {
+            const std::shared_ptr<Scheduler> request_scheduler = Scheduler::from_config(m_root_dir / "scheduler/scheduler_config.json");
+            is_batched = typeid(*request_scheduler) == typeid(*m_scheduler);
+        }
+        if (!is_batched) {
+            return DiffusionPipeline::generate_batch(positive_prompts, properties);
+        }
+
+        set_lora_adapters(m_generation_config.adapters);
+
+        StableDiffusionBatchedEngine engine(*this, BATCHED_GENERATION_MAX_IMAGES);
+        std::vector<ImageGenerationRequest::Ptr> requests;
+        try {
+            for (size_t idx = 0; idx < positive_prompts.size(); ++idx) {
+                requests.push_back(engine.add_request(idx, positive_prompts[idx], properties[idx]));
+            }
+            while (engine.has_non_finished_requests()) {
+                engine.step();
+            }
+        } catch (...) {
+            engine.clear_requests();
+            throw;
+        }
+
+        std::vector<ImageGenerationResult> results;
+        results.reserve(requests.size());
+        for (const auto& request : requests) {
+            results.push_back(std::move(request->get_result()));
+        }
+        return results;
+    }
+
     ov::Tensor decode(const ov::Tensor latent) override {
-        return m_vae->decode(latent);
+        return m_vae->decode(latent, m_generation_config.vae_tiling_config);
     }
 
     ImageGenerationPerfMetrics get_performance_metrics() override {
@@ -519,9 +570,12 @@ protected:
 
     friend class Text2ImagePipeline;
     friend class Image2ImagePipeline;
+    friend class StableDiffusionBatchedEngine;
 
     std::shared_ptr<CLIPTextModel> m_clip_text_encoder = nullptr;
     std::shared_ptr<UNet2DConditionModel> m_unet = nullptr;
+    // UNet reshaped to a static batch or compiled for NPU can't denoise batched requests
+    bool m_is_unet_batch_dynamic = true;
 };
 
 }  // namespace genai
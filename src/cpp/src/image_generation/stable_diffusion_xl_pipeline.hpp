@@ -405,6 +405,12 @@ public:
         }
     }
 
+    std::vector<ImageGenerationResult> generate_batch(const std::vector<std::string>& positive_prompts,
+                                                      const std::vector<ov::AnyMap>& properties) override {
+        // the batched engine of Stable Diffusion doesn't pass pooled text embeddings and time ids to SDXL UNet
+        return DiffusionPipeline::generate_batch(positive_prompts, properties);
+    }
+
     void export_model(const std::filesystem::path& export_path) override {
         m_unet->export_model(export_path / "unet");
         m_clip_text_encoder->export_model(export_path / "text_encoder");
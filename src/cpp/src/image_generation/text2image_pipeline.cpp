@@ -219,6 +219,16 @@ ov::Tensor Text2ImagePipeline::generate(const std::string& positive_prompt, cons
     return m_impl->generate(positive_prompt, {}, {}, properties);
 }
 
+std::vector<ImageGenerationResult> Text2ImagePipeline::generate(const std::vector<std::string>& positive_prompts,
+                                                              const std::vector<ov::AnyMap>& properties) {
+    OPENVINO_ASSERT(properties.empty() || properties.size() == positive_prompts.size(),
+                    "Number of properties (", properties.size(), ") must match number of prompts (", positive_prompts.size(), ")");
+    if (properties.empty()) {
+        return m_impl->generate_batch(positive_prompts, std::vector<ov::AnyMap>(positive_prompts.size()));
+    }
+    return m_impl->generate_batch(positive_prompts, properties);
+}
+
 ov::Tensor Text2ImagePipeline::decode(const ov::Tensor latent) {
     return m_impl->decode(latent);
 }
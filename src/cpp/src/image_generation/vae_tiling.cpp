@@ -0,0 +1,189 @@
+// Copyright (C) 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "image_generation/vae_tiling.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace genai {
+namespace vae_tiling {
+
+namespace {
+
+// logical [N, C, D, H, W] sizes of a 4D or 5D tensor shape
+std::array<size_t, 5> get_logical_shape(const ov::Shape& shape, bool channels_last) {
+    OPENVINO_ASSERT(shape.size() == 4 || shape.size() == 5, "VAE tiling expects 4D or 5D tensor, got ", shape);
+    if (shape.size() == 4) {
+        return channels_last ? std::array<size_t, 5>{shape[0], shape[3], 1, shape[1], shape[2]}
+                             : std::array<size_t, 5>{shape[0], shape[1], 1, shape[2], shape[3]};
+    }
+    return channels_last ? std::array<size_t, 5>{shape[0], shape[4], shape[1], shape[2], shape[3]}
+                         : std::array<size_t, 5>{shape[0], shape[1], shape[2], shape[3], shape[4]};
+}
+
+// strides of logical [N, C, D, H, W] dimensions
+std::array<size_t, 5> get_strides(const std::array<size_t, 5>& shape, bool channels_last) {
+    const auto [N, C, D, H, W] = shape;
+    if (channels_last) {
+        return {D * H * W * C, 1, H * W * C, W * C, C};
+    }
+    return {C * D * H * W, D * H * W, H * W, W, 1};
+}
+
+template <typename T>
+void accumulate(const T* tile_data,
+                const std::array<size_t, 5>& tile_strides,
+                float* values,
+                const std::array<size_t, 5>& strides,
+                const std::array<size_t, 3>& begin,
+                const std::array<size_t, 3>& size,
+                size_t batch,
+                size_t channels,
+                const std::vector<float>& d_weights,
+                const std::vector<float>& h_weights,
+                const std::vector<float>& w_weights) {
+    for (size_t n = 0; n < batch; ++n) {
+        for (size_t d = 0; d < size[0]; ++d) {
+            for (size_t h = 0; h < size[1]; ++h) {
+                for (size_t w = 0; w < size[2]; ++w) {
+                    const float weight = d_weights[d] * h_weights[h] * w_weights[w];
+                    const T* src = tile_data + n * tile_strides[0] + d * tile_strides[2] + h * tile_strides[3] + w * tile_strides[4];
+                    float* dst = values + n * strides[0] + (begin[0] + d) * strides[2] + (begin[1] + h) * strides[3] + (begin[2] + w) * strides[4];
+                    for (size_t c = 0; c < channels; ++c) {
+                        dst[c * strides[1]] += weight * static_cast<float>(src[c * tile_strides[1]]);
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+std::vector<TileRange> split_spatial(size_t latent_size, size_t tile_size, size_t tile_overlap, size_t scale_factor) {
+    tile_size = std::max<size_t>(tile_size, 1);
+    if (tile_size >= latent_size) {
+        return {{0, latent_size, 0, latent_size * scale_factor}};
+    }
+
+    const size_t stride = tile_size > tile_overlap ? tile_size - tile_overlap : 1;
+    std::vector<TileRange> tiles;
+    for (size_t begin = 0;; begin += stride) {
+        begin = std::min(begin, latent_size - tile_size);
+        tiles.push_back({begin, begin + tile_size, begin * scale_factor, (begin + tile_size) * scale_factor});
+        if (begin + tile_size >= latent_size) {
+            break;
+        }
+    }
+    return tiles;
+}
+
+std::vector<TileRange> split_temporal(size_t latent_num_frames, size_t tile_size, size_t tile_overlap, size_t scale_factor) {
+    std::vector<TileRange> tiles = split_spatial(latent_num_frames, tile_size, tile_overlap, scale_factor);
+    for (TileRange& tile : tiles) {
+        // the first decoded frame of a tile corresponds to the first frame of its first latent
+        tile.sample_begin = tile.latent_begin == 0 ? 0 : tile.latent_begin * scale_factor + 1;
+        tile.sample_end = (tile.latent_end - 1) * scale_factor + 1;
+    }
+    return tiles;
+}
+
+ov::Tensor crop(const ov::Tensor& tensor, const ov::Coordinate& begin, const ov::Coordinate& end) {
+    ov::Tensor roi(tensor, begin, end);
+    ov::Tensor result(roi.get_element_type(), roi.get_shape());
+    roi.copy_to(result);
+    return result;
+}
+
+TileBlender::TileBlender(const std::array<size_t, 5>& shape, bool channels_last, const std::array<size_t, 3>& blend)
+    : m_shape(shape),
+      m_channels_last(channels_last),
+      m_blend(blend),
+      m_values(shape[0] * shape[1] * shape[2] * shape[3] * shape[4], 0.0f),
+      m_weights(shape[2] * shape[3] * shape[4], 0.0f) {}
+
+std::vector<float> TileBlender::get_weights(size_t dim, size_t begin, size_t end) const {
+    const size_t size = m_shape[dim + 2];
+    const float ramp = static_cast<float>(m_blend[dim] + 1);
+    std::vector<float> weights(end - begin, 1.0f);
+    for (size_t i = 0; i < weights.size(); ++i) {
+        if (begin > 0) {
+            weights[i] = std::min(weights[i], (i + 1) / ramp);
+        }
+        if (end < size) {
+            weights[i] = std::min(weights[i], (weights.size() - i) / ramp);
+        }
+    }
+    return weights;
+}
+
+void TileBlender::add_tile(const ov::Tensor& tile, size_t d_begin, size_t d_end, size_t h_begin, size_t h_end, size_t w_begin, size_t w_end) {
+    const std::array<size_t, 5> tile_shape = get_logical_shape(tile.get_shape(), m_channels_last);
+    OPENVINO_ASSERT(tile_shape[0] == m_shape[0] && tile_shape[1] == m_shape[1], "VAE tile has unexpected batch or channels");
+    OPENVINO_ASSERT(d_end <= m_shape[2] && h_end <= m_shape[3] && w_end <= m_shape[4], "VAE tile exceeds output");
+    OPENVINO_ASSERT(d_end - d_begin <= tile_shape[2] && h_end - h_begin <= tile_shape[3] && w_end - w_begin <= tile_shape[4],
+                    "VAE tile is smaller than its range");
+
+    const std::vector<float> d_weights = get_weights(0, d_begin, d_end),
+                             h_weights = get_weights(1, h_begin, h_end),
+                             w_weights = get_weights(2, w_begin, w_end);
+    const std::array<size_t, 5> tile_strides = get_strides(tile_shape, m_channels_last), strides = get_strides(m_shape, m_channels_last);
+    const std::array<size_t, 3> begin = {d_begin, h_begin, w_begin}, size = {d_end - d_begin, h_end - h_begin, w_end - w_begin};
+
+    if (tile.get_element_type() == ov::element::u8) {
+        accumulate(tile.data<const uint8_t>(), tile_strides, m_values.data(), strides, begin, size, m_shape[0], m_shape[1], d_weights, h_weights, w_weights);
+    } else if (tile.get_element_type() == ov::element::f32) {
+        accumulate(tile.data<const float>(), tile_strides, m_values.data(), strides, begin, size, m_shape[0], m_shape[1], d_weights, h_weights, w_weights);
+    } else {
+        OPENVINO_THROW("Unsupported VAE tile element type ", tile.get_element_type());
+    }
+
+    for (size_t d = 0; d < size[0]; ++d) {
+        for (size_t h = 0; h < size[1]; ++h) {
+            float* weights = m_weights.data() + ((d_begin + d) * m_shape[3] + h_begin + h) * m_shape[4] + w_begin;
+            for (size_t w = 0; w < size[2]; ++w) {
+                weights[w] += d_weights[d] * h_weights[h] * w_weights[w];
+            }
+        }
+    }
+}
+
+ov::Tensor TileBlender::get_output(const ov::element::Type& type, const ov::Shape& shape) const {
+    OPENVINO_ASSERT(get_logical_shape(shape, m_channels_last) == m_shape, "VAE tiling output shape mismatch");
+    const std::array<size_t, 5> strides = get_strides(m_shape, m_channels_last);
+    ov::Tensor output(type, shape);
+
+    auto normalize = [&](auto* data, auto convert) {
+        for (size_t n = 0; n < m_shape[0]; ++n) {
+            for (size_t c = 0; c < m_shape[1]; ++c) {
+                for (size_t dhw = 0; dhw < m_weights.size(); ++dhw) {
+                    const size_t d = dhw / (m_shape[3] * m_shape[4]), h = dhw / m_shape[4] % m_shape[3], w = dhw % m_shape[4];
+                    const size_t offset = n * strides[0] + c * strides[1] + d * strides[2] + h * strides[3] + w * strides[4];
+                    OPENVINO_ASSERT(m_weights[dhw] > 0.0f, "VAE tiles don't cover the whole output");
+                    data[offset] = convert(m_values[offset] / m_weights[dhw]);
+                }
+            }
+        }
+    };
+
+    if (type == ov::element::u8) {
+        normalize(output.data<uint8_t>(), [](float value) {
+            return static_cast<uint8_t>(std::clamp(std::round(value), 0.0f, 255.0f));
+        });
+    } else if (type == ov::element::f32) {
+        normalize(output.data<float>(), [](float value) {
+            return value;
+        });
+    } else {
+        OPENVINO_THROW("Unsupported VAE tiling output element type ", type);
+    }
+    return output;
+}
+
+} // namespace vae_tiling
+} // namespace genai
+} // namespace ov
@@ -0,0 +1,62 @@
+// Copyright (C) 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov {
+namespace genai {
+namespace vae_tiling {
+
+// A tile along a single dimension: VAE processes latent positions [latent_begin, latent_end)
+// into sample (pixel or frame) positions [sample_begin, sample_end)
+struct TileRange {
+    size_t latent_begin, latent_end;
+    size_t sample_begin, sample_end;
+};
+
+// Splits a spatial dimension into tiles of 'tile_size' latent positions which overlap by 'tile_overlap' positions.
+// The last tile is aligned to the end of the dimension, so all tiles have the same size.
+std::vector<TileRange> split_spatial(size_t latent_size, size_t tile_size, size_t tile_overlap, size_t scale_factor);
+
+// Same as split_spatial, but for a causal video VAE, which decodes the first latent frame of a tile into a single frame
+// and the others into 'scale_factor' frames. Tiles except the first one skip the last decoded frame
+std::vector<TileRange> split_temporal(size_t latent_num_frames, size_t tile_size, size_t tile_overlap, size_t scale_factor);
+
+// Returns a contiguous copy of [begin, end) region of a tensor
+ov::Tensor crop(const ov::Tensor& tensor, const ov::Coordinate& begin, const ov::Coordinate& end);
+
+/**
+ * Accumulates tiles of a [N, C, D, H, W] tensor (with NDHWC memory layout if channels_last), D is 1 for images.
+ * Each tile is weighted by linear ramps over 'blend' positions of the D, H and W sides it shares with other tiles,
+ * the result is normalized by the sum of weights.
+ */
+class TileBlender {
+public:
+    TileBlender(const std::array<size_t, 5>& shape, bool channels_last, const std::array<size_t, 3>& blend);
+
+    // tile has the same layout and at least the sizes of the ranges, its extra trailing positions are ignored
+    void add_tile(const ov::Tensor& tile, size_t d_begin, size_t d_end, size_t h_begin, size_t h_end, size_t w_begin, size_t w_end);
+
+    // u8 result is rounded and clamped, f32 is returned as is
+    ov::Tensor get_output(const ov::element::Type& type, const ov::Shape& shape) const;
+
+private:
+    std::vector<float> get_weights(size_t dim, size_t begin, size_t end) const;
+
+    std::array<size_t, 5> m_shape;
+    bool m_channels_last;
+    std::array<size_t, 3> m_blend;
+    std::vector<float> m_values;
+    // [D, H, W] sum of weights
+    std::vector<float> m_weights;
+};
+
+} // namespace vae_tiling
+} // namespace genai
+} // namespace ov
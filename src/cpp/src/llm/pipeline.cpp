@@ -446,6 +446,14 @@ void ov::genai::LLMPipeline::finish_chat() {
     m_pimpl->finish_chat();
 }
 
+ov::genai::SessionState ov::genai::LLMPipeline::save_session() {
+    return m_pimpl->save_session();
+}
+
+void ov::genai::LLMPipeline::restore_session(const SessionState& session) {
+    m_pimpl->restore_session(session);
+}
+
 void ov::genai::LLMPipeline::set_generation_config(const GenerationConfig& config) {
     m_pimpl->set_generation_config(config);
 }
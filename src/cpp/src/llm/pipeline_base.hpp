@@ -60,6 +60,14 @@ public:
     virtual void start_chat(const std::string& system_message) = 0;
     virtual void finish_chat() = 0;
 
+    virtual SessionState save_session() {
+        OPENVINO_THROW("Sessions are supported by the stateful LLM pipeline only");
+    }
+
+    virtual void restore_session(const SessionState& session) {
+        OPENVINO_THROW("Sessions are supported by the stateful LLM pipeline only");
+    }
+
     virtual ~LLMPipelineImplBase() = default;
 
     void save_load_time(std::chrono::steady_clock::time_point start_time) {
@@ -4,6 +4,9 @@
 
 #include "llm/pipeline_stateful.hpp"
 
+#include <unordered_map>
+
+#include "llm/session_state.hpp"
 #include "lora/helper.hpp"
 #include "lm_encoding.hpp"
 #include "openvino/genai/text_streamer.hpp"
@@ -66,6 +69,11 @@ StatefulLLMPipeline::StatefulLLMPipeline(
         m_cache_state.seq_length_axis = kv_pos.seq_len;
 
     auto [filtered_properties_without_gguf, enable_save_ov_model] = utils::extract_gguf_properties(properties);
+    auto incremental_chat_encoding_it = filtered_properties_without_gguf.find("incremental_chat_encoding");
+    if (incremental_chat_encoding_it != filtered_properties_without_gguf.end()) {
+        m_chat_history_encoder.set_incremental(incremental_chat_encoding_it->second.as<bool>());
+        filtered_properties_without_gguf.erase(incremental_chat_encoding_it);
+    }
     auto filtered_properties = extract_adapters_from_properties(filtered_properties_without_gguf, &m_generation_config.adapters);
     if (m_generation_config.adapters) {
         m_generation_config.adapters->set_tensor_name_prefix("base_model.model.");
@@ -162,8 +170,7 @@ DecodedResults StatefulLLMPipeline::generate(
             OPENVINO_ASSERT(input_vector->size() == 1, "Can't chat with multiple prompts");
             m_history.push_back({{"role", "user"}, {"content", (*input_vector)[0]}});
             constexpr bool add_generation_prompt = true;
-            auto new_templated_chat_history = m_tokenizer.apply_chat_template(m_history, add_generation_prompt);
-            auto new_chat_tokens = m_tokenizer.encode(new_templated_chat_history, ov::genai::add_special_tokens(false));
+            auto new_chat_tokens = m_chat_history_encoder.encode(m_tokenizer, m_history, add_generation_prompt);
 
             if (m_use_full_chat_history) {
                 encoded_input = new_chat_tokens;
@@ -189,9 +196,8 @@ DecodedResults StatefulLLMPipeline::generate(
         if (is_chat_conversation) {
             m_history.push_back({{"role", "user"}, {"content", prompt}});
             constexpr bool add_generation_prompt = true;
-            auto new_templated_chat_history = m_tokenizer.apply_chat_template(m_history, add_generation_prompt);
             // Do not add special tokens in chat scenario to be aligned with HF.
-            auto new_chat_tokens = m_tokenizer.encode(new_templated_chat_history, ov::genai::add_special_tokens(false));
+            auto new_chat_tokens = m_chat_history_encoder.encode(m_tokenizer, m_history, add_generation_prompt);
 
             if (m_use_full_chat_history) {
                 encoded_input = new_chat_tokens;
@@ -271,8 +277,7 @@ DecodedResults StatefulLLMPipeline::generate(
     m_history = history;
 
     constexpr bool add_generation_prompt = true;
-    auto new_templated_chat_history = m_tokenizer.apply_chat_template(m_history, add_generation_prompt);
-    auto new_chat_tokens = m_tokenizer.encode(new_templated_chat_history, ov::genai::add_special_tokens(false));
+    auto new_chat_tokens = m_chat_history_encoder.encode(m_tokenizer, m_history, add_generation_prompt);
 
     TokenizedInputs encoded_input;
     if (m_use_full_chat_history) {
@@ -512,11 +517,82 @@ void StatefulLLMPipeline::finish_chat() {
         reset_state();
         m_model_runner.get_tensor("attention_mask").set_shape({1, 0});
         m_history.clear();
+        m_chat_history_encoder.reset();
         m_tokenized_chat_history.clear();
         m_cache_state.reset_state();
     }
 }
 
+SessionState StatefulLLMPipeline::save_session() {
+    const auto start_time = std::chrono::steady_clock::now();
+    SessionState session;
+    auto& impl = *session.m_pimpl;
+    impl.is_saved = true;
+    impl.is_chat_conversation = is_chat_conversation;
+    impl.history = m_history;
+    impl.chat_history_encoder = m_chat_history_encoder;
+    impl.tokenized_chat_history = m_tokenized_chat_history;
+    impl.chat_input_type = m_chat_input_type;
+    impl.chat_generation_finish_status = m_chat_generation_finish_status;
+    impl.cache_state = m_cache_state;
+
+    ov::Tensor attention_mask = m_model_runner.get_tensor("attention_mask");
+    impl.attention_mask = ov::Tensor(attention_mask.get_element_type(), attention_mask.get_shape());
+    attention_mask.copy_to(impl.attention_mask);
+
+    for (auto& state : m_model_runner.query_state()) {
+        // LoRA adapters are applied by the pipeline itself, they don't belong to the session
+        if (m_adapter_controller && m_adapter_controller->has_state_name(state.get_name())) {
+            continue;
+        }
+        // the returned tensor may share memory with the variable, so it's copied
+        ov::Tensor tensor = state.get_state();
+        ov::Tensor copy(tensor.get_element_type(), tensor.get_shape());
+        tensor.copy_to(copy);
+        impl.states.push_back({state.get_name(), copy.get_element_type(), copy.get_shape(), copy});
+        impl.states.back().byte_size = copy.get_byte_size();
+    }
+
+    impl.save_duration = PerfMetrics::get_microsec(std::chrono::steady_clock::now() - start_time) / 1000.0f;
+    return session;
+}
+
+void StatefulLLMPipeline::restore_session(const SessionState& session) {
+    const auto start_time = std::chrono::steady_clock::now();
+    auto& impl = *session.m_pimpl;
+
+    finish_chat();
+    if (!impl.is_saved) {
+        impl.restore_duration = PerfMetrics::get_microsec(std::chrono::steady_clock::now() - start_time) / 1000.0f;
+        return;
+    }
+
+    std::unordered_map<std::string, ov::VariableState> states;
+    for (auto& state : m_model_runner.query_state()) {
+        states.emplace(state.get_name(), state);
+    }
+    const std::vector<ov::Tensor> tensors = impl.load_states();
+    for (size_t i = 0; i < impl.states.size(); ++i) {
+        auto state = states.find(impl.states[i].name);
+        OPENVINO_ASSERT(state != states.end(), "Session state '", impl.states[i].name, "' doesn't belong to the model of the pipeline");
+        state->second.set_state(tensors[i]);
+    }
+
+    ov::Tensor attention_mask(impl.attention_mask.get_element_type(), impl.attention_mask.get_shape());
+    impl.attention_mask.copy_to(attention_mask);
+    m_model_runner.set_tensor("attention_mask", attention_mask);
+
+    is_chat_conversation = impl.is_chat_conversation;
+    m_history = impl.history;
+    m_chat_history_encoder = impl.chat_history_encoder;
+    m_tokenized_chat_history = impl.tokenized_chat_history;
+    m_chat_input_type = impl.chat_input_type;
+    m_chat_generation_finish_status = impl.chat_generation_finish_status;
+    m_cache_state = impl.cache_state;
+
+    impl.restore_duration = PerfMetrics::get_microsec(std::chrono::steady_clock::now() - start_time) / 1000.0f;
+}
+
 StatefulLLMPipeline::~StatefulLLMPipeline() {
     m_model_runner.get_compiled_model().release_memory();
 }
@@ -9,6 +9,7 @@
 #include "llm/pipeline_base.hpp"
 #include "lm_encoding.hpp"
 #include "sampling/sampler.hpp"
+#include "tokenizer/chat_history_encoder.hpp"
 #include "utils.hpp"
 
 namespace ov::genai {
@@ -20,6 +21,8 @@ class StatefulLLMPipeline final : public LLMPipelineImplBase {
     // Chat scenario specific parameters
     bool is_chat_conversation = false;
     ChatHistory m_history;
+    // tokenizes the templated chat history, reusing the tokens of the previous turns if "incremental_chat_encoding" is set
+    ChatHistoryEncoder m_chat_history_encoder;
     std::vector<int64_t> m_tokenized_chat_history;
     ov::genai::utils::GenerationChatInputsType m_chat_input_type = ov::genai::utils::GenerationChatInputsType::UNDEF;
     // Finish reason of last generation for chat scenario
@@ -93,6 +96,10 @@ public:
 
     void finish_chat() override;
 
+    SessionState save_session() override;
+
+    void restore_session(const SessionState& session) override;
+
     ~StatefulLLMPipeline();
 };
 
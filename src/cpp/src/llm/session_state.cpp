@@ -0,0 +1,113 @@
+// Copyright (C) 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "llm/session_state.hpp"
+
+#include <fstream>
+
+#include "openvino/core/type/float16.hpp"
+
+namespace ov::genai {
+
+SessionState::SessionState() : m_pimpl(std::make_shared<SessionStateImpl>()) {}
+
+void SessionState::compress() {
+    m_pimpl->compress();
+}
+
+void SessionState::spill(const std::filesystem::path& path) {
+    m_pimpl->spill(path);
+}
+
+bool SessionState::is_spilled() const {
+    return !m_pimpl->spill_path.empty();
+}
+
+size_t SessionState::get_size_in_bytes() const {
+    size_t size = 0;
+    for (const auto& state : m_pimpl->states) {
+        size += state.byte_size;
+    }
+    return size;
+}
+
+float SessionState::get_save_duration() const {
+    return m_pimpl->save_duration;
+}
+
+float SessionState::get_restore_duration() const {
+    return m_pimpl->restore_duration;
+}
+
+void SessionState::SessionStateImpl::compress() {
+    OPENVINO_ASSERT(spill_path.empty(), "Spilled session can't be compressed");
+    for (auto& state : states) {
+        if (state.is_compressed || state.element_type != ov::element::f32) {
+            continue;
+        }
+        ov::Tensor compressed(ov::element::f16, state.shape);
+        const float* src = state.tensor.data<const float>();
+        ov::float16* dst = compressed.data<ov::float16>();
+        for (size_t i = 0; i < compressed.get_size(); ++i) {
+            dst[i] = ov::float16(src[i]);
+        }
+        state.tensor = compressed;
+        state.is_compressed = true;
+        state.byte_size = compressed.get_byte_size();
+    }
+}
+
+void SessionState::SessionStateImpl::spill(const std::filesystem::path& path) {
+    OPENVINO_ASSERT(spill_path.empty(), "Session is already spilled to ", spill_path);
+    std::ofstream file(path, std::ios::binary);
+    OPENVINO_ASSERT(file.is_open(), "Failed to open ", path, " to spill the session");
+
+    size_t offset = 0;
+    for (auto& state : states) {
+        file.write(static_cast<const char*>(state.tensor.data()), state.byte_size);
+        state.file_offset = offset;
+        offset += state.byte_size;
+    }
+    file.close();
+    OPENVINO_ASSERT(file.good(), "Failed to write the session to ", path);
+
+    for (auto& state : states) {
+        state.tensor = ov::Tensor();
+    }
+    spill_path = path;
+}
+
+std::vector<ov::Tensor> SessionState::SessionStateImpl::load_states() const {
+    std::ifstream file;
+    if (!spill_path.empty()) {
+        file.open(spill_path, std::ios::binary);
+        OPENVINO_ASSERT(file.is_open(), "Failed to open the spilled session ", spill_path);
+    }
+
+    std::vector<ov::Tensor> tensors;
+    tensors.reserve(states.size());
+    for (const auto& state : states) {
+        ov::Tensor tensor = state.tensor;
+        if (!spill_path.empty()) {
+            // compressed tensors are f16 in memory and in the file
+            tensor = ov::Tensor(state.is_compressed ? ov::element::f16 : state.element_type, state.shape);
+            file.seekg(state.file_offset);
+            file.read(static_cast<char*>(tensor.data()), state.byte_size);
+            OPENVINO_ASSERT(file.good(), "Failed to read state '", state.name, "' from the spilled session ", spill_path);
+        }
+
+        if (state.is_compressed) {
+            ov::Tensor decompressed(state.element_type, state.shape);
+            const ov::float16* src = tensor.data<const ov::float16>();
+            float* dst = decompressed.data<float>();
+            for (size_t i = 0; i < decompressed.get_size(); ++i) {
+                dst[i] = static_cast<float>(src[i]);
+            }
+            tensor = decompressed;
+        }
+        tensors.push_back(tensor);
+    }
+    return tensors;
+}
+
+}  // namespace ov::genai
@@ -0,0 +1,60 @@
+// Copyright (C) 2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "openvino/genai/session_state.hpp"
+#include "openvino/genai/chat_history.hpp"
+#include "openvino/genai/generation_handle.hpp"
+#include "openvino/runtime/tensor.hpp"
+#include "tokenizer/chat_history_encoder.hpp"
+#include "utils.hpp"
+
+namespace ov::genai {
+
+class SessionState::SessionStateImpl {
+public:
+    struct StateTensor {
+        std::string name;
+        // precision and shape of the variable, the tensor is stored in f16 if the session is compressed
+        ov::element::Type element_type;
+        ov::Shape shape;
+        // empty if the session is spilled
+        ov::Tensor tensor;
+        bool is_compressed = false;
+        size_t file_offset = 0;
+        size_t byte_size = 0;
+    };
+
+    // true for sessions created by a pipeline, an empty session starts a new chat on restore
+    bool is_saved = false;
+
+    // chat state of StatefulLLMPipeline
+    bool is_chat_conversation = false;
+    ChatHistory history;
+    ChatHistoryEncoder chat_history_encoder;
+    std::vector<int64_t> tokenized_chat_history;
+    utils::GenerationChatInputsType chat_input_type = utils::GenerationChatInputsType::UNDEF;
+    GenerationStatus chat_generation_finish_status = GenerationStatus::RUNNING;
+    utils::CacheState cache_state;
+    ov::Tensor attention_mask;
+
+    std::vector<StateTensor> states;
+    std::filesystem::path spill_path;
+
+    float save_duration = 0.0f;
+    float restore_duration = 0.0f;
+
+    void compress();
+
+    void spill(const std::filesystem::path& path);
+
+    // returns the state tensors in the precision of the variables, reading them from the file if the session is spilled
+    std::vector<ov::Tensor> load_states() const;
+};
+
+}  // namespace ov::genai
@@ -408,18 +408,22 @@ namespace {
 
 // Creates ReadValue and Assign nodes to inject LoRA tensors as variables for a given node but
 // doesn't connect them to the model returning as LoRANode instance.
+// If adapter_ids is given, alpha variable holds a row per adapter slot and a row is selected for each token by adapter_ids.
 struct LoRAWeightStateGetter {
     std::shared_ptr<ov::Model> model;
     LoRAParametersGetter params_getter;
     LoRAVarMap& variable_ids;
+    std::shared_ptr<v0::Parameter> adapter_ids;
     // TODO: Use variable indices instead of variable_id for faster search for a state tensor
 
     LoRAWeightStateGetter(const LoRAParametersGetter& params_getter,
                           std::shared_ptr<ov::Model> model,
-                          LoRAVarMap& variable_ids)
+                          LoRAVarMap& variable_ids,
+                          std::shared_ptr<v0::Parameter> adapter_ids = nullptr)
         : model(model),
           params_getter(params_getter),
-          variable_ids(variable_ids) {}
+          variable_ids(variable_ids),
+          adapter_ids(adapter_ids) {}
 
     std::optional<LoRANode> operator() (NodePtr node) const {
         if(auto params = params_getter(node)) {
@@ -443,12 +447,21 @@ struct LoRAWeightStateGetter {
             result.A = add_variable(var_ids.A, model);
             // FIXME: No guarantees on ordering of state in InferRequest makes impossible using indices of variables later, forced to use variable_id instead
             //indices.A = model->get_variables().size();
+            ov::PartialShape alpha_shape = params->fine_grained_alpha ? ov::PartialShape{1, params->rank} : ov::PartialShape{};
+            if (adapter_ids) {
+                alpha_shape = ov::PartialShape{ov::Dimension::dynamic(), params->rank};
+            }
             var_ids.alpha = ov::op::util::VariableInfo{
-                params->fine_grained_alpha ? ov::PartialShape{1, params->rank} : ov::PartialShape{},
+                alpha_shape,
                 ov::element::f32,   // alpha is always f32 because it is set from host as float data type
                 variable_id_prefix + ".alpha"
             };
             result.alpha = add_variable(var_ids.alpha, model);
+            if (adapter_ids) {
+                // [num_slots, rank] -> [adapter_ids shape..., rank], reshaped to the shape of activations in tensors_multiplication
+                auto axis = v0::Constant::create(ov::element::i32, ov::Shape{}, {0});
+                result.alpha = std::make_shared<v8::Gather>(result.alpha, adapter_ids, axis);
+            }
             // FIXME: No guarantees on ordering of state in InferRequest makes impossible using indices of variables later, forced to use variable_id instead
             //indices.B = model->get_variables().size();
             var_ids.B = ov::op::util::VariableInfo{
@@ -666,7 +679,8 @@ NodePtr tensors_multiplication(NodePtr input,
                                bool transpose_weights,
                                size_t alpha_pos,
                                size_t A_pos,
-                               bool transpose_in_end) {
+                               bool transpose_in_end,
+                               bool per_token_alpha = false) {
     const auto target_type = target.get_element_type();
     const auto target_shape = target.get_partial_shape();
     const auto target_rank = target_shape.rank().get_length();
@@ -679,13 +693,18 @@ NodePtr tensors_multiplication(NodePtr input,
                 input->get_rt_info()["decompression"];
             }
         }
-        if (normalized->get_output_partial_shape(0).rank().get_length() > 2) {
+        if (normalized->get_output_partial_shape(0).rank().get_length() > 2 && !(per_token_alpha && i == alpha_pos)) {
             // FIXME: Any other shape patterns possible?
             normalized = squeeze_2d(normalized);
         }
         if (input) {
             if (i == alpha_pos) {  // Multiply for alpha
                 // TODO: Apply alpha multiplication separately
+                if (per_token_alpha) {
+                    // alpha has a row per token, align it with tokens of activations whatever their layout is
+                    auto shape = std::make_shared<v3::ShapeOf>(input, ov::element::i64);
+                    normalized = std::make_shared<v1::Reshape>(normalized, shape, false);
+                }
                 input = std::make_shared<v1::Multiply>(input, normalized);
             } else {  // MatMul for A and B
                 input = std::make_shared<v0::MatMul>(input,
@@ -928,7 +947,8 @@ public:
 
     OPENVINO_RTTI("LoRASeparateTransform", "genai", LoRATransformBase);
 
-    LoRASeparateTransform(const LoRAWeightByNodeGetter& lora_getter) : LoRATransformBase(lora_getter) {}
+    LoRASeparateTransform(const LoRAWeightByNodeGetter& lora_getter, bool per_token_alpha = false) :
+        LoRATransformBase(lora_getter), per_token_alpha(per_token_alpha) {}
 
     bool apply (NodePtr node, const LoRANode& lora_weight) override {
         auto activations = node->input_value(0);    // FIXME: consider MatMul.transpose_a
@@ -961,7 +981,8 @@ public:
                                              true,
                                              1, // alpha idx
                                              0, // A idx
-                                             transpose_in_end);
+                                             transpose_in_end,
+                                             per_token_alpha);
 
         replacement->get_output_tensor(0).add_names(target.get_names());
         for (auto consumer : consumers) {
@@ -970,6 +991,9 @@ public:
 
         return true;
     }
+
+private:
+    bool per_token_alpha;
 };
 
 
@@ -1286,12 +1310,16 @@ struct AdapterControllerImpl {
     AdapterConfig current_config;
     bool need_full_apply = true;
     InferRequestSignatureCache lora_state_evaluators;
+    // Model input that selects adapter slot for each token, nullptr if adapters are not selected per request
+    std::shared_ptr<v0::Parameter> adapter_ids;
+    // Ranks of adapters from current_config for each LoRA layer, used to place alphas of adapter slots
+    std::map<std::string, std::vector<size_t>> lora_ranks;
 
     // Stores the actual LoRA weight getter used for Constant tensor replacement
     // Needed to track which LoRA tensors were actually applied to suppress unused tensor warnings
     std::shared_ptr<LoRAWeightGetterDefault<NodePtr, NodePtr>> const_getter_impl;
 
-    AdapterControllerImpl(std::shared_ptr<ov::Model> model, const AdapterConfig& config) :
+    AdapterControllerImpl(std::shared_ptr<ov::Model> model, const AdapterConfig& config, bool per_request_adapters = false) :
         current_config(config),  // FIXME: Compare current and passed configs and change incrementally
         lora_state_evaluators("CPU")    // FIXME: Try to run on the same device that is used for model inference
     {
@@ -1363,7 +1391,11 @@ struct AdapterControllerImpl {
         if(mode == AdapterConfig::MODE_DYNAMIC || mode == AdapterConfig::MODE_STATIC_RANK || mode == AdapterConfig::MODE_AUTO) {
             // State mode
             params_getter.dynamic_lora_rank = (mode != AdapterConfig::MODE_STATIC_RANK);
-            pm.register_pass<LoRASeparateTransform>(LoRAWeightStateGetter(params_getter, model, variable_ids));
+            // Adapters of different requests are concatenated along rank, so it can't be fixed at this point
+            if (per_request_adapters && params_getter.dynamic_lora_rank) {
+                adapter_ids = create_adapter_ids(model);
+            }
+            pm.register_pass<LoRASeparateTransform>(LoRAWeightStateGetter(params_getter, model, variable_ids, adapter_ids), bool(adapter_ids));
             if (const_getter) {
                 LoRAStateGetterForConst getter = LoRAStateGetterForConst(const_getter, model, constant_variable_ids);
                 pm.register_pass<LoRAReplaceConstantTransformDynamic>(getter, getter.create_if_input());
@@ -1383,6 +1415,14 @@ struct AdapterControllerImpl {
 
         pm.run_passes(model);
 
+        if (adapter_ids) {
+            if (variable_ids.empty()) {
+                adapter_ids.reset();
+            } else {
+                model->add_parameters({adapter_ids});
+            }
+        }
+
         // Collect all variable names to quickly detect which state tensor belongs to this adapter controller later
         for(const auto& var: variable_ids) {
             variable_names.insert(var.second.A.variable_id);
@@ -1398,6 +1438,20 @@ struct AdapterControllerImpl {
         return adapter.m_pimpl;
     }
 
+    // Creates an adapter slot input for each token. It has the shape of input_ids, or 1D if the model takes inputs_embeds.
+    static std::shared_ptr<v0::Parameter> create_adapter_ids(const std::shared_ptr<ov::Model>& model) {
+        ov::PartialShape shape{ov::Dimension::dynamic()};
+        for (const auto& input : model->inputs()) {
+            if (input.get_names().count("input_ids")) {
+                shape = input.get_partial_shape();
+            }
+        }
+        auto adapter_ids = std::make_shared<v0::Parameter>(ov::element::i32, shape);
+        adapter_ids->set_friendly_name("lora_adapter_ids");
+        adapter_ids->get_output_tensor(0).set_names({"lora_adapter_ids"});
+        return adapter_ids;
+    }
+
     struct ConfigChanged {
         bool mode = false;
         bool alpha = false;
@@ -1453,10 +1507,79 @@ struct AdapterControllerImpl {
         }
     }
 
+    void apply_per_request(ov::InferRequest& infer_request, const std::vector<AdapterConfig>& slot_configs) {
+        OPENVINO_ASSERT(adapter_ids, "AdapterController was not configured to select adapters per request");
+        OPENVINO_ASSERT(!slot_configs.empty(), "At least one adapter slot is expected");
+
+        // Adapters of all slots are applied together, each slot enables its own adapters by alpha
+        std::vector<std::pair<Adapter, float>> adapters;
+        for (const auto& config : slot_configs) {
+            for (const auto& adapter : config.get_adapters()) {
+                OPENVINO_ASSERT(get_adapter_impl(adapter)->get_constant_tensors().empty(),
+                                "LoRA adapters with constants cannot be selected per request");
+                auto it = std::find_if(adapters.begin(), adapters.end(), [&adapter](const std::pair<Adapter, float>& applied) {
+                    return applied.first == adapter;
+                });
+                if (it == adapters.end()) {
+                    adapters.emplace_back(adapter, 1.0f);
+                }
+            }
+        }
+
+        // A and B tensors are concatenated again only if the set of adapters is changed, the order of adapters doesn't matter
+        const auto& current_adapters = current_config.get_adapters();
+        bool adapters_changed = adapters.size() != current_adapters.size();
+        for (size_t i = 0; i < adapters.size() && !adapters_changed; ++i) {
+            adapters_changed = std::find(current_adapters.begin(), current_adapters.end(), adapters[i].first) == current_adapters.end();
+        }
+        if (need_full_apply || adapters_changed) {
+            need_full_apply = false;
+            current_config.set_adapters_and_alphas(adapters);
+            set_new_adapter_tensors(infer_request);
+        }
+        set_slot_alphas(infer_request, slot_configs);
+    }
+
+    bool has_per_request_adapters() const {
+        return bool(adapter_ids);
+    }
+
     bool has_state_name(const std::string& name) {
         return variable_names.count(name);
     }
 
+    // Sets alpha of each LoRA layer to [num_slots, rank] tensor. A row has alphas of the slot adapters in rank columns
+    // of these adapters and zeros in columns of other adapters, so tokens of a slot are not affected by other adapters.
+    void set_slot_alphas(ov::InferRequest& infer_request, const std::vector<AdapterConfig>& slot_configs) {
+        const auto& adapters = current_config.get_adapters();
+        auto state = infer_request.query_state();
+        std::map<std::string, size_t> state_name_to_index;
+        for (size_t i = 0; i < state.size(); ++i) {
+            state_name_to_index[state[i].get_name()] = i;
+        }
+
+        // Usually all layers have the same ranks for a given adapter, so the same alpha tensor is set for most of them
+        std::map<std::vector<size_t>, ov::Tensor> alphas;
+        for (const auto& [name, ranks] : lora_ranks) {
+            ov::Tensor& alpha = alphas[ranks];
+            if (!alpha) {
+                const size_t rank = std::accumulate(ranks.begin(), ranks.end(), size_t(0));
+                alpha = ov::Tensor(ov::element::f32, ov::Shape{slot_configs.size(), rank});
+                float* alpha_data = alpha.data<float>();
+                std::fill_n(alpha_data, alpha.get_size(), 0.0f);
+                for (size_t slot = 0; slot < slot_configs.size(); ++slot) {
+                    const auto& slot_adapters = slot_configs[slot].get_adapters();
+                    for (size_t i = 0, offset = 0; i < adapters.size(); offset += ranks[i], ++i) {
+                        if (std::find(slot_adapters.begin(), slot_adapters.end(), adapters[i]) != slot_adapters.end()) {
+                            std::fill_n(alpha_data + slot * rank + offset, ranks[i], slot_configs[slot].get_alpha(adapters[i]));
+                        }
+                    }
+                }
+            }
+            state[state_name_to_index.at(variable_ids.at(name).alpha.variable_id)].set_state(alpha);
+        }
+    }
+
     void set_new_adapter_alphas (ov::InferRequest& infer_request) {
         set_new_adapter_tensors(infer_request, /*alpha_only=*/true);
     }
@@ -1506,6 +1629,10 @@ struct AdapterControllerImpl {
             set_lora_tensors(state, lora_var_ids.first, lora_var_ids.second, lora_indices, weight_getters, alpha_only);
         }
 
+        if (adapter_ids && !alpha_only) {
+            collect_lora_ranks(weight_getters);
+        }
+
         for (const auto& [const_name, var_info] : constant_variable_ids) {
 
             size_t const_lora_index = state_name_to_index.at(var_info.variable_id);
@@ -1533,6 +1660,18 @@ struct AdapterControllerImpl {
 
     }
 
+    void collect_lora_ranks(const std::vector<LoRAWeightGetter>& weight_getters) {
+        lora_ranks.clear();
+        for (const auto& lora_var_ids : variable_ids) {
+            auto& ranks = lora_ranks[lora_var_ids.first];
+            ranks.reserve(weight_getters.size());
+            for (const auto& weight_getter : weight_getters) {
+                auto lora_tensors = weight_getter(lora_var_ids.first);
+                ranks.push_back(lora_tensors ? lora_tensors->A->get_output_partial_shape(0)[0].get_length() : 0);
+            }
+        }
+    }
+
     std::vector<LoRAWeight> collect_applicable_tensors (const std::string& lora_name, const std::vector<LoRAWeightGetter>& weight_getters) {
         const auto& adapters = current_config.get_adapters();
         OPENVINO_ASSERT(weight_getters.size() == adapters.size());
@@ -1759,7 +1898,7 @@ struct AdapterControllerImpl {
 };
 
 
-AdapterController::AdapterController(std::shared_ptr<ov::Model> model, const AdapterConfig& config, std::string device)
+AdapterController::AdapterController(std::shared_ptr<ov::Model> model, const AdapterConfig& config, std::string device, bool per_request_adapters)
 {
     // If AdapterConfig::MODE_AUTO is used, then set real mode depending on the device capabilities
     // TODO: Remove this code when devices become aligned on their capabilities for LoRA adapters
@@ -1776,7 +1915,7 @@ AdapterController::AdapterController(std::shared_ptr<ov::Model> model, const Ada
         if(default_mode != default_modes.end()) {
             AdapterConfig updated_config = config;
             updated_config.set_mode(default_mode->second);
-            m_pimpl = std::make_shared<AdapterControllerImpl>(model, updated_config);
+            m_pimpl = std::make_shared<AdapterControllerImpl>(model, updated_config, per_request_adapters);
             return;
         } else {
             std::string device_msg;
@@ -1791,7 +1930,7 @@ AdapterController::AdapterController(std::shared_ptr<ov::Model> model, const Ada
                 << "To avoid this warning set one of the AdapterConfig::Mode values except MODE_AUTO.";
         }
     }
-    m_pimpl = std::make_shared<AdapterControllerImpl>(model, config);
+    m_pimpl = std::make_shared<AdapterControllerImpl>(model, config, per_request_adapters);
 }
 
 
@@ -1805,6 +1944,15 @@ void AdapterController::apply(ov::InferRequest request, const std::optional<Adap
     }
 }
 
+void AdapterController::apply_per_request(ov::InferRequest request, const std::vector<AdapterConfig>& slot_configs) {
+    OPENVINO_ASSERT(m_pimpl, "AdapterController was not configured to use adapters");
+    m_pimpl->apply_per_request(request, slot_configs);
+}
+
+bool AdapterController::has_per_request_adapters() const {
+    return m_pimpl && m_pimpl->has_per_request_adapters();
+}
+
 bool AdapterController::has_state_name(const std::string& name) {
     return m_pimpl->has_state_name(name);
 }
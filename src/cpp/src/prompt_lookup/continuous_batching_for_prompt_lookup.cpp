@@ -6,6 +6,8 @@
 namespace ov::genai {
 
 const int64_t PADDING_TOKEN_ID = -1;
+// candidate branches take additional KV cache blocks, so they are not created when the cache is short of them
+const float MAX_CACHE_USAGE_FOR_BRANCHING = 50.f;
 
 std::map<uint64_t, ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::SequenceLen>
 ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::get_generated_request_len() {
@@ -19,75 +21,136 @@ ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::get_generated
     return result;
 }
 
-TokenIds ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::generate_candidates(const TokenIds& input_ids, size_t num_pred_tokens, size_t max_ngram_size) {
-    if (num_pred_tokens == 0) {
-        return std::vector<int64_t>{};
-    }
+NgramIndex& ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::get_ngram_index(const Sequence::Ptr& sequence,
+                                                                                              const TokenIds& prompt,
+                                                                                              size_t max_ngram_size) {
+    const TokenIds& generated_tokens = sequence->get_generated_ids();
+    const size_t full_len = prompt.size() + generated_tokens.size();
 
-    const size_t input_length = input_ids.size();
-    if (max_ngram_size >= input_length) {
-        // Comparing the whole input_ids is not very meaningful until the ngram length reaches half the length of
-        // `input_ids`, because the ngrams will overlap with `input_ids`.
-        max_ngram_size = static_cast<int32_t>(input_length / 2);
-    }
-    for (int32_t ngram_size = max_ngram_size; ngram_size > 0; ngram_size--) {
-        // extract last ngram_size tokens as search ngram
-        std::vector<int64_t> ngram = std::vector<int64_t>{input_ids.cend() - ngram_size, input_ids.cend()};
+    auto is_prefix_of_sequence = [&](const NgramIndex& ngram_index) {
+        const TokenIds& indexed_tokens = ngram_index.get_tokens();
+        const size_t indexed_len = indexed_tokens.size();
+        if (indexed_len > full_len || ngram_index.get_max_ngram_size() != max_ngram_size) {
+            return false;
+        }
+        // the whole indexed range is compared: a reused sequence id or a rollback followed by another continuation
+        // may keep the length and the last token, but change the tokens before them
+        const size_t indexed_prompt_len = std::min(indexed_len, prompt.size());
+        return std::equal(indexed_tokens.begin(), indexed_tokens.begin() + indexed_prompt_len, prompt.begin()) &&
+               std::equal(indexed_tokens.begin() + indexed_prompt_len, indexed_tokens.end(), generated_tokens.begin());
+    };
 
-        for (int32_t input_i = 0; input_i < static_cast<int32_t>(input_length) - ngram_size; input_i++) {
-            if (!std::equal(ngram.begin(), ngram.end(), input_ids.begin() + input_i)) {
-                continue;
+    auto it = m_ngram_indices.find(sequence->get_id());
+    if (it == m_ngram_indices.end()) {
+        // the longest branch of the previous step continues the sequence it was forked from, so the index is taken over
+        auto origin_it = m_branch_origins.find(sequence->get_id());
+        if (origin_it != m_branch_origins.end()) {
+            auto node = m_ngram_indices.extract(origin_it->second);
+            if (!node.empty()) {
+                node.key() = sequence->get_id();
+                it = m_ngram_indices.insert(std::move(node)).position;
             }
-            auto start_candidate_idx = input_i + ngram.size();
-            // match found with the end at input_i
-            size_t available_num_pred = std::min(input_length - start_candidate_idx, num_pred_tokens);
-            // return candidates with length of available_num_pred
-            return std::vector<int64_t>{input_ids.cbegin() + start_candidate_idx,
-                                        input_ids.cbegin() + start_candidate_idx + available_num_pred};
         }
     }
+    // candidates are appended only after indexing and rejected ones are removed before the next step,
+    // so a sequence normally just grows; an index which is not a prefix of the sequence has to be rebuilt
+    if (it == m_ngram_indices.end() || !is_prefix_of_sequence(it->second)) {
+        it = m_ngram_indices.insert_or_assign(sequence->get_id(), NgramIndex(max_ngram_size)).first;
+    }
+
+    NgramIndex& ngram_index = it->second;
+    for (size_t position = ngram_index.size(); position < prompt.size(); ++position) {
+        ngram_index.append(prompt[position]);
+    }
+    for (size_t position = ngram_index.size() - prompt.size(); position < generated_tokens.size(); ++position) {
+        ngram_index.append(generated_tokens[position]);
+    }
+    return ngram_index;
+}
 
-    return std::vector<int64_t>{};
+void ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::set_num_candidate_branches(size_t num_candidate_branches) {
+    OPENVINO_ASSERT(num_candidate_branches > 0, "Number of candidate branches must be positive");
+    m_num_candidate_branches = num_candidate_branches;
+}
+
+bool ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::can_branch_candidates(const SequenceGroup::Ptr& request) const {
+    if (m_num_candidate_branches < 2 || request->num_running_seqs() != 1 ||
+        m_pipeline_metrics.cache_usage > MAX_CACHE_USAGE_FOR_BRANCHING) {
+        return false;
+    }
+    // the branches are validated one by one with a single logit processor, so it must not depend on the generated tokens
+    const auto& sampling_params = request->get_sampling_parameters();
+    return sampling_params.is_greedy_decoding() && !sampling_params.is_structured_output_generation() &&
+           sampling_params.repetition_penalty == 1.0f && sampling_params.presence_penalty == 0.0f &&
+           sampling_params.frequency_penalty == 0.0f;
 }
 
 void ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::generate_candidates_for_prompt_lookup() {
+    // indices of the sequences which are still running are moved here, the rest are dropped
+    std::map<uint64_t, NgramIndex> active_ngram_indices;
+    std::map<uint64_t, uint64_t> branch_origins;
     for (auto& request : m_requests) {
-        const auto prompt = request->get_prompt_ids();
+        const auto& prompt = request->get_prompt_ids();
+        const bool can_branch = can_branch_candidates(request);
 
         size_t max_validation_len = 0;
+        bool has_candidate_branches = false;
         for (auto& running_sequence : request->get_running_sequences()) {
-            const auto generated_tokens = running_sequence->get_generated_ids();
-            if (generated_tokens.empty()) {
+            if (running_sequence->get_generated_ids().empty()) {
                 continue;
             }
-            TokenIds full_input_ids = prompt;
-            full_input_ids.insert(full_input_ids.end(), generated_tokens.begin(), generated_tokens.end());
 
             size_t min_num_assistant_tokens = 0;
-            const auto sampling_params = request->get_sampling_parameters();
+            const auto& sampling_params = request->get_sampling_parameters();
             {
                 const auto generated_len = running_sequence->get_generated_len();
                 const auto left_generated_len = request->get_max_new_tokens() - generated_len - 1;
                 min_num_assistant_tokens = std::min(sampling_params.num_assistant_tokens, left_generated_len);
             }
-            TokenIds candidates = generate_candidates(full_input_ids, min_num_assistant_tokens, sampling_params.max_ngram_size);
-
-            // Padding candidate tokens to maintain consistent shape.
-            // Avoid shape checking and increasing the amount of computation when the shape changes.
-            if (candidates.size() < sampling_params.num_assistant_tokens) {
-                int token_sz = static_cast<int>(candidates.size());
-                for (int ci = 0; ci < static_cast<int>(sampling_params.num_assistant_tokens) - token_sz; ci++) {
-                    candidates.push_back(PADDING_TOKEN_ID);
+            NgramIndex& ngram_index = get_ngram_index(running_sequence, prompt, sampling_params.max_ngram_size);
+            std::vector<TokenIds> branches;
+            if (can_branch) {
+                for (auto& continuation : ngram_index.find_ranked_candidates(min_num_assistant_tokens, sampling_params.max_ngram_size, m_num_candidate_branches)) {
+                    branches.push_back(std::move(continuation.tokens));
                 }
             }
+            if (branches.size() < 2) {
+                branches = {ngram_index.find_candidates(min_num_assistant_tokens, sampling_params.max_ngram_size)};
+            }
+            active_ngram_indices.insert_or_assign(running_sequence->get_id(), std::move(ngram_index));
 
-            for (const auto& candidate : candidates) {
-                running_sequence->append_token(candidate, 0);
+            // branches are forked before the candidates are appended, so they share the blocks of the verified tokens only
+            std::vector<Sequence::Ptr> branch_sequences = {running_sequence};
+            for (size_t branch_idx = 1; branch_idx < branches.size(); ++branch_idx) {
+                const auto forked_sequence = request->fork_sequence(running_sequence);
+                m_scheduler->fork_sequence(running_sequence->get_id(), forked_sequence->get_id());
+                branch_origins.emplace(forked_sequence->get_id(), running_sequence->get_id());
+                branch_sequences.push_back(forked_sequence);
+            }
+            has_candidate_branches |= branches.size() > 1;
+
+            for (size_t branch_idx = 0; branch_idx < branches.size(); ++branch_idx) {
+                TokenIds& candidates = branches[branch_idx];
+                // Padding candidate tokens to maintain consistent shape.
+                // Avoid shape checking and increasing the amount of computation when the shape changes.
+                if (candidates.size() < sampling_params.num_assistant_tokens) {
+                    int token_sz = static_cast<int>(candidates.size());
+                    for (int ci = 0; ci < static_cast<int>(sampling_params.num_assistant_tokens) - token_sz; ci++) {
+                        candidates.push_back(PADDING_TOKEN_ID);
+                    }
+                }
+
+                for (const auto& candidate : candidates) {
+                    branch_sequences[branch_idx]->append_token(candidate, 0);
+                }
+                max_validation_len = std::max(max_validation_len, candidates.size());
             }
-            max_validation_len = std::max(max_validation_len, candidates.size());
         }
+        request->set_candidate_branches(has_candidate_branches);
         request->set_num_validated_tokens(max_validation_len);
     }
+    m_ngram_indices = std::move(active_ngram_indices);
+    m_branch_origins = std::move(branch_origins);
 }
 
 bool ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::is_requests_empty() {
@@ -6,6 +6,7 @@
 #include "openvino/genai/continuous_batching_pipeline.hpp"
 
 #include "continuous_batching/pipeline_impl.hpp"
+#include "prompt_lookup/ngram_index.hpp"
 
 namespace ov::genai {
 class ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl : public ContinuousBatchingPipeline::ContinuousBatchingImpl {
@@ -51,10 +52,28 @@ public:
 
     bool is_requests_empty();
 
+    /**
+     * @brief Sets the number of alternative candidate continuations verified in a single step for greedy requests.
+     * The branches are ranked continuations of the matched n-gram, each verified as a forked sequence sharing
+     * the KV cache blocks of the verified tokens, and only the branch with the most accepted tokens is kept.
+     * @param num_candidate_branches The maximum number of branches, 1 disables branching.
+     */
+    void set_num_candidate_branches(size_t num_candidate_branches);
+
     size_t get_processed_tokens_per_iteration();
 
     using ContinuousBatchingPipeline::ContinuousBatchingImpl::drop_requests;
 protected:
-    TokenIds generate_candidates(const TokenIds& input_ids, size_t num_pred_tokens, size_t max_ngram_size);
+    // returns the index of the sequence's prompt and generated tokens, extended with the tokens accepted since the last step
+    NgramIndex& get_ngram_index(const Sequence::Ptr& sequence, const TokenIds& prompt, size_t max_ngram_size);
+
+    // whether the candidates of the request can be verified as several branches
+    bool can_branch_candidates(const SequenceGroup::Ptr& request) const;
+
+    // n-gram indices of the running sequences, keyed by the sequence id
+    std::map<uint64_t, NgramIndex> m_ngram_indices;
+    // sequences forked for candidate branches in the last step, mapped to the sequences they were forked from
+    std::map<uint64_t, uint64_t> m_branch_origins;
+    size_t m_num_candidate_branches = 1;
 };
 }
@@ -0,0 +1,167 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "prompt_lookup/ngram_index.hpp"
+
+#include <algorithm>
+
+#include "openvino/core/except.hpp"
+
+namespace ov::genai {
+
+namespace {
+
+constexpr uint64_t HASH_MULTIPLIER = 0x9E3779B97F4A7C15ull;
+
+// n-grams are hashed from the last token to the first one, so the hashes of all the suffixes ending
+// at a position are computed in a single backward pass
+uint64_t extend_hash(uint64_t hash, int64_t token) {
+    uint64_t value = static_cast<uint64_t>(token) + HASH_MULTIPLIER + (hash << 6) + (hash >> 2);
+    return hash ^ (value * HASH_MULTIPLIER);
+}
+
+}  // namespace
+
+NgramIndex::NgramIndex(size_t max_ngram_size) : m_max_ngram_size(max_ngram_size), m_tables(max_ngram_size) {}
+
+void NgramIndex::update(const std::vector<int64_t>& tokens) {
+    OPENVINO_ASSERT(tokens.size() >= m_tokens.size(), "NgramIndex can only be extended with new tokens");
+    m_tokens.reserve(tokens.size());
+    for (size_t position = m_tokens.size(); position < tokens.size(); ++position) {
+        append(tokens[position]);
+    }
+}
+
+void NgramIndex::append(int64_t token) {
+    m_tokens.push_back(token);
+    const size_t end = m_tokens.size();
+    const size_t max_ngram_size = std::min(m_max_ngram_size, end);
+    uint64_t hash = 0;
+    for (size_t ngram_size = 1; ngram_size <= max_ngram_size; ++ngram_size) {
+        const size_t start = end - ngram_size;
+        hash = extend_hash(hash, m_tokens[start]);
+        m_tables[ngram_size - 1][hash].push_back(start);
+    }
+}
+
+std::vector<uint64_t> NgramIndex::get_suffix_hashes(size_t max_ngram_size) const {
+    std::vector<uint64_t> hashes(max_ngram_size);
+    uint64_t hash = 0;
+    for (size_t ngram_size = 1; ngram_size <= max_ngram_size; ++ngram_size) {
+        hash = extend_hash(hash, m_tokens[m_tokens.size() - ngram_size]);
+        hashes[ngram_size - 1] = hash;
+    }
+    return hashes;
+}
+
+std::vector<size_t> NgramIndex::find_matches(size_t ngram_size, uint64_t hash, bool first_only) const {
+    std::vector<size_t> matches;
+    const NgramTable& table = m_tables[ngram_size - 1];
+    auto it = table.find(hash);
+    if (it == table.end()) {
+        return matches;
+    }
+
+    const size_t suffix_start = m_tokens.size() - ngram_size;
+    const auto suffix_begin = m_tokens.begin() + suffix_start;
+    for (size_t start : it->second) {
+        // positions are sorted, so the suffix itself and anything after it ends the search
+        if (start >= suffix_start) {
+            break;
+        }
+        // hashes may collide, so an occurrence is confirmed by comparing the tokens
+        if (!std::equal(suffix_begin, m_tokens.end(), m_tokens.begin() + start)) {
+            continue;
+        }
+        matches.push_back(start);
+        if (first_only) {
+            break;
+        }
+    }
+    return matches;
+}
+
+size_t NgramIndex::get_effective_ngram_size(size_t max_ngram_size) const {
+    const size_t input_length = m_tokens.size();
+    if (max_ngram_size >= input_length) {
+        // Comparing the whole input_ids is not very meaningful until the ngram length reaches half the length of
+        // `input_ids`, because the ngrams will overlap with `input_ids`.
+        max_ngram_size = input_length / 2;
+    }
+    return std::min(max_ngram_size, m_max_ngram_size);
+}
+
+std::vector<int64_t> NgramIndex::find_candidates(size_t num_pred_tokens, size_t max_ngram_size) const {
+    if (num_pred_tokens == 0) {
+        return {};
+    }
+
+    const size_t effective_ngram_size = get_effective_ngram_size(max_ngram_size);
+    const std::vector<uint64_t> hashes = get_suffix_hashes(effective_ngram_size);
+    for (size_t ngram_size = effective_ngram_size; ngram_size > 0; --ngram_size) {
+        const std::vector<size_t> matches = find_matches(ngram_size, hashes[ngram_size - 1], true);
+        if (matches.empty()) {
+            continue;
+        }
+        const size_t start_candidate_idx = matches.front() + ngram_size;
+        const size_t available_num_pred = std::min(m_tokens.size() - start_candidate_idx, num_pred_tokens);
+        return std::vector<int64_t>{m_tokens.cbegin() + start_candidate_idx,
+                                    m_tokens.cbegin() + start_candidate_idx + available_num_pred};
+    }
+
+    return {};
+}
+
+std::vector<NgramIndex::Continuation> NgramIndex::find_ranked_candidates(size_t num_pred_tokens,
+                                                                         size_t max_ngram_size,
+                                                                         size_t max_num_continuations) const {
+    std::vector<Continuation> continuations;
+    if (num_pred_tokens == 0 || max_num_continuations == 0) {
+        return continuations;
+    }
+
+    const size_t effective_ngram_size = get_effective_ngram_size(max_ngram_size);
+    const std::vector<uint64_t> hashes = get_suffix_hashes(effective_ngram_size);
+    for (size_t ngram_size = effective_ngram_size; ngram_size > 0; --ngram_size) {
+        const std::vector<size_t> matches = find_matches(ngram_size, hashes[ngram_size - 1], false);
+        if (matches.empty()) {
+            continue;
+        }
+
+        // group the occurrences by the next token, keeping the earliest occurrence of every group
+        struct Group {
+            size_t earliest_start;
+            size_t frequency;
+        };
+        std::vector<Group> groups;
+        std::unordered_map<int64_t, size_t> group_by_token;
+        for (size_t start : matches) {
+            auto [it, inserted] = group_by_token.emplace(m_tokens[start + ngram_size], groups.size());
+            if (inserted) {
+                groups.push_back({start, 1});
+            } else {
+                ++groups[it->second].frequency;
+            }
+        }
+
+        // groups are created in the order of their earliest occurrences, so a stable sort resolves the ties
+        std::stable_sort(groups.begin(), groups.end(), [](const Group& lhs, const Group& rhs) {
+            return lhs.frequency > rhs.frequency;
+        });
+
+        const size_t num_continuations = std::min(groups.size(), max_num_continuations);
+        continuations.reserve(num_continuations);
+        for (size_t group_idx = 0; group_idx < num_continuations; ++group_idx) {
+            const size_t start_candidate_idx = groups[group_idx].earliest_start + ngram_size;
+            const size_t available_num_pred = std::min(m_tokens.size() - start_candidate_idx, num_pred_tokens);
+            continuations.push_back({std::vector<int64_t>{m_tokens.cbegin() + start_candidate_idx,
+                                                          m_tokens.cbegin() + start_candidate_idx + available_num_pred},
+                                     groups[group_idx].frequency});
+        }
+        return continuations;
+    }
+
+    return continuations;
+}
+
+}  // namespace ov::genai
@@ -0,0 +1,78 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace ov::genai {
+
+/**
+ * @brief Incremental n-gram index over a growing token sequence used by prompt lookup decoding.
+ * For every n-gram size in [1, max_ngram_size] it keeps a rolling-hash table mapping an n-gram to its start positions,
+ * so appending a token costs O(max_ngram_size) and a lookup does not rescan the sequence.
+ */
+class NgramIndex {
+public:
+    struct Continuation {
+        std::vector<int64_t> tokens;
+        // number of occurrences of the matched n-gram followed by the same next token
+        size_t frequency;
+    };
+
+    explicit NgramIndex(size_t max_ngram_size);
+
+    /**
+     * @brief Indexes the tokens from `tokens[size()]` onwards. Tokens before it must be the same as the indexed ones.
+     */
+    void update(const std::vector<int64_t>& tokens);
+
+    void append(int64_t token);
+
+    size_t size() const {
+        return m_tokens.size();
+    }
+
+    size_t get_max_ngram_size() const {
+        return m_max_ngram_size;
+    }
+
+    const std::vector<int64_t>& get_tokens() const {
+        return m_tokens;
+    }
+
+    /**
+     * @brief Finds the longest n-gram matching the end of the sequence and returns the tokens following its earliest occurrence.
+     * @param num_pred_tokens The maximum number of returned tokens.
+     * @param max_ngram_size The longest n-gram to match, limited by the index's own maximum and by half of the sequence length
+     * when it is not shorter than the sequence.
+     */
+    std::vector<int64_t> find_candidates(size_t num_pred_tokens, size_t max_ngram_size) const;
+
+    /**
+     * @brief Same as `find_candidates`, but returns up to `max_num_continuations` distinct continuations of the longest match,
+     * ranked by the number of occurrences followed by the same next token, with ties resolved in favour of the earliest occurrence.
+     */
+    std::vector<Continuation> find_ranked_candidates(size_t num_pred_tokens, size_t max_ngram_size, size_t max_num_continuations) const;
+
+private:
+    using NgramTable = std::unordered_map<uint64_t, std::vector<size_t>>;
+
+    // hashes[n - 1] is the hash of the last n tokens
+    std::vector<uint64_t> get_suffix_hashes(size_t max_ngram_size) const;
+
+    // start positions of the earlier occurrences of the last `ngram_size` tokens, in ascending order
+    std::vector<size_t> find_matches(size_t ngram_size, uint64_t hash, bool first_only) const;
+
+    size_t get_effective_ngram_size(size_t max_ngram_size) const;
+
+    size_t m_max_ngram_size;
+    std::vector<int64_t> m_tokens;
+    // m_tables[n - 1] indexes n-grams of size n
+    std::vector<NgramTable> m_tables;
+};
+
+}  // namespace ov::genai
@@ -12,6 +12,26 @@ namespace ov::genai {
 template<class... Ts> struct overloaded : Ts... {using Ts::operator()...;};
 template<class... Ts> overloaded(Ts...) -> overloaded<Ts...>;
 
+size_t ContinuousBatchingPipeline::PromptLookupImpl::extract_num_candidate_branches(ov::AnyMap& properties) {
+    auto it = properties.find("prompt_lookup_num_branches");
+    if (it == properties.end()) {
+        return 1;
+    }
+    const size_t num_candidate_branches = it->second.as<size_t>();
+    properties.erase(it);
+    return num_candidate_branches;
+}
+
+bool ContinuousBatchingPipeline::PromptLookupImpl::extract_incremental_chat_encoding(ov::AnyMap& properties) {
+    auto it = properties.find("incremental_chat_encoding");
+    if (it == properties.end()) {
+        return false;
+    }
+    const bool is_incremental = it->second.as<bool>();
+    properties.erase(it);
+    return is_incremental;
+}
+
 GenerationHandle
 ContinuousBatchingPipeline::PromptLookupImpl::add_request(uint64_t request_id,
                                                           const ov::Tensor& input_ids,
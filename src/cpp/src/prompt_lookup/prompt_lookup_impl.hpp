@@ -19,6 +19,11 @@ protected:
 
     void drop_requests();
 
+    // extracts the number of candidate branches, which is not a plugin property, and removes it from properties
+    static size_t extract_num_candidate_branches(ov::AnyMap& properties);
+    // extracts the incremental chat encoding flag, which is not a plugin property, and removes it from properties
+    static bool extract_incremental_chat_encoding(ov::AnyMap& properties);
+
 public:
     PromptLookupImpl(const std::shared_ptr<ov::Model>& model,
                      const Tokenizer& tokenizer,
@@ -28,7 +33,11 @@ public:
                      const ov::genai::GenerationConfig& generation_config) {
         m_tokenizer = tokenizer;
         m_perf_metrics.raw_metrics.m_inference_durations = {{ MicroSeconds(0.0f) }};
-        m_pipeline = std::make_shared<ContinuousBatchingForPromptLookupImpl>(model, tokenizer, scheduler_config, device, properties, generation_config);
+        ov::AnyMap pipeline_properties = properties;
+        const size_t num_candidate_branches = extract_num_candidate_branches(pipeline_properties);
+        m_chat_history_encoder.set_incremental(extract_incremental_chat_encoding(pipeline_properties));
+        m_pipeline = std::make_shared<ContinuousBatchingForPromptLookupImpl>(model, tokenizer, scheduler_config, device, pipeline_properties, generation_config);
+        m_pipeline->set_num_candidate_branches(num_candidate_branches);
     };
 
     PromptLookupImpl(const std::shared_ptr<ov::Model>& model,
@@ -43,13 +52,17 @@ public:
         m_model_input_type = ModelInputType::EMBEDDINGS;
         m_vision_registry = std::make_shared<VisionRegistry>();
         m_perf_metrics.raw_metrics.m_inference_durations = {{MicroSeconds(0.0f)}};
+        ov::AnyMap pipeline_properties = properties;
+        const size_t num_candidate_branches = extract_num_candidate_branches(pipeline_properties);
+        m_chat_history_encoder.set_incremental(extract_incremental_chat_encoding(pipeline_properties));
         m_pipeline = std::make_shared<ContinuousBatchingForPromptLookupImpl>(model,
                                                                              m_inputs_embedder,
                                                                              m_tokenizer,
                                                                              scheduler_config,
                                                                              device,
-                                                                             properties,
+                                                                             pipeline_properties,
                                                                              generation_config);
+        m_pipeline->set_num_candidate_branches(num_candidate_branches);
     };
 
     GenerationHandle add_request(uint64_t request_id,
@@ -0,0 +1,530 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "sampling/logit_kernels.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include "openvino/core/visibility.hpp"
+
+#if defined(OPENVINO_ARCH_X86_64)
+#    ifdef _MSC_VER
+#        include <intrin.h>
+#    else
+#        include <x86intrin.h>
+#    endif
+
+#    ifdef _MSC_VER
+static inline unsigned count_trailing_zeros(unsigned mask) {
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned>(index);
+}
+#    else
+static inline unsigned count_trailing_zeros(unsigned mask) {
+    return static_cast<unsigned>(__builtin_ctz(mask));
+}
+#    endif
+
+#    if defined(__GNUC__) || defined(__clang__)
+#        define OV_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#        define OV_TARGET_AVX512 __attribute__((target("avx512f,avx2,fma")))
+#    else
+#        define OV_TARGET_AVX2
+#        define OV_TARGET_AVX512
+#    endif
+#endif  // OPENVINO_ARCH_X86_64
+
+namespace ov::genai::kernels {
+
+namespace {
+
+ISA detect_isa() {
+#if defined(OPENVINO_ARCH_X86_64)
+#    ifdef _MSC_VER
+    int cpu_info[4] = {0};
+    __cpuid(cpu_info, 0);
+    if (cpu_info[0] < 7)
+        return ISA::SCALAR;
+    __cpuid(cpu_info, 1);
+    const bool os_xsave = (cpu_info[2] & (1 << 27)) != 0;
+    const bool fma = (cpu_info[2] & (1 << 12)) != 0;
+    if (!os_xsave)
+        return ISA::SCALAR;
+    const unsigned long long xcr0 = _xgetbv(_XCR_XFEATURE_ENABLED_MASK);
+    __cpuidex(cpu_info, 7, 0);
+    const bool avx2 = (cpu_info[1] & (1 << 5)) != 0;
+    const bool avx512f = (cpu_info[1] & (1 << 16)) != 0;
+    // XCR0 bits 1, 2 enable the XMM / YMM state, bits 5, 6, 7 enable the opmask and ZMM state
+    if (avx512f && fma && (xcr0 & 0xE6) == 0xE6)
+        return ISA::AVX512;
+    if (avx2 && fma && (xcr0 & 0x6) == 0x6)
+        return ISA::AVX2;
+#    else
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("fma"))
+        return ISA::AVX512;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        return ISA::AVX2;
+#    endif
+#endif  // OPENVINO_ARCH_X86_64
+    return ISA::SCALAR;
+}
+
+const ISA supported_isa = detect_isa();
+ISA active_isa = supported_isa;
+
+constexpr float negative_infinity = -std::numeric_limits<float>::infinity();
+
+// scalar implementations, also used for the remainders of the vectorized loops
+
+float reduce_max_scalar(const float* data, size_t size, float max_value = negative_infinity) {
+    for (size_t i = 0; i < size; ++i)
+        if (data[i] > max_value)
+            max_value = data[i];
+    return max_value;
+}
+
+size_t find_first_equal_scalar(const float* data, size_t size, float value) {
+    for (size_t i = 0; i < size; ++i)
+        if (data[i] == value)
+            return i;
+    return size;
+}
+
+float reduce_sum_scalar(const float* data, size_t size) {
+    float sum = 0.0f;
+    for (size_t i = 0; i < size; ++i)
+        sum += data[i];
+    return sum;
+}
+
+size_t find_first_greater_scalar(const float* data, size_t size, float threshold) {
+    for (size_t i = 0; i < size; ++i)
+        if (data[i] > threshold)
+            return i;
+    return size;
+}
+
+float exp_sum_scalar(const float* data, size_t size, float shift) {
+    float sum = 0.0f;
+    for (size_t i = 0; i < size; ++i)
+        sum += expf(data[i] - shift);
+    return sum;
+}
+
+float scaled_exp_scalar(float* data, size_t size, float shift, float scale) {
+    float sum = 0.0f;
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = expf((data[i] - shift) * scale);
+        sum += data[i];
+    }
+    return sum;
+}
+
+void divide_scalar(float* data, size_t size, float divisor) {
+    for (size_t i = 0; i < size; ++i)
+        data[i] /= divisor;
+}
+
+void apply_token_bitmask_scalar(float* data, size_t size, const int32_t* bitmask) {
+    for (size_t word = 0; word * 32 < size; ++word) {
+        const uint32_t bits = static_cast<uint32_t>(bitmask[word]);
+        if (bits == 0xFFFFFFFFu)
+            continue;
+        const size_t end = std::min(size, word * 32 + 32);
+        for (size_t i = word * 32; i < end; ++i)
+            if (!((bits >> (i % 32)) & 1u))
+                data[i] = negative_infinity;
+    }
+}
+
+#if defined(OPENVINO_ARCH_X86_64)
+
+// exp(x) via range reduction x = n * ln2 + r, |r| <= ln2 / 2, and a degree 5 polynomial for exp(r) (Cephes expf).
+// Inputs below the smallest normal result are flushed to zero, NaNs are propagated.
+namespace exp_constants {
+constexpr float max_input = 88.3762626647949f;
+constexpr float min_input = -87.3365478515625f;
+constexpr float log2e = 1.44269504088896341f;
+constexpr float ln2_hi = 0.693359375f;
+constexpr float ln2_lo = -2.12194440e-4f;
+constexpr std::array<float, 6> poly = {1.9875691500e-4f, 1.3981999507e-3f, 8.3334519073e-3f,
+                                       4.1665795894e-2f, 1.6666665459e-1f, 5.0000001201e-1f};
+}  // namespace exp_constants
+
+OV_TARGET_AVX2
+inline __m256 exp_avx2(__m256 x) {
+    using namespace exp_constants;
+    const __m256 clamped = _mm256_min_ps(_mm256_max_ps(x, _mm256_set1_ps(min_input)), _mm256_set1_ps(max_input));
+    const __m256 n = _mm256_round_ps(_mm256_mul_ps(clamped, _mm256_set1_ps(log2e)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256 r = _mm256_fnmadd_ps(n, _mm256_set1_ps(ln2_hi), clamped);
+    r = _mm256_fnmadd_ps(n, _mm256_set1_ps(ln2_lo), r);
+
+    __m256 p = _mm256_set1_ps(poly[0]);
+    for (size_t i = 1; i < poly.size(); ++i)
+        p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(poly[i]));
+    p = _mm256_fmadd_ps(p, _mm256_mul_ps(r, r), _mm256_add_ps(r, _mm256_set1_ps(1.0f)));
+
+    const __m256i exponent = _mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(n), _mm256_set1_epi32(127)), 23);
+    __m256 result = _mm256_mul_ps(p, _mm256_castsi256_ps(exponent));
+
+    result = _mm256_andnot_ps(_mm256_cmp_ps(x, _mm256_set1_ps(min_input), _CMP_LT_OQ), result);
+    result = _mm256_blendv_ps(result, _mm256_set1_ps(std::numeric_limits<float>::infinity()),
+                              _mm256_cmp_ps(x, _mm256_set1_ps(max_input), _CMP_GT_OQ));
+    return _mm256_blendv_ps(result, x, _mm256_cmp_ps(x, x, _CMP_UNORD_Q));
+}
+
+OV_TARGET_AVX2
+inline float horizontal_max_avx2(__m256 v) {
+    __m128 m = _mm_max_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    m = _mm_max_ps(m, _mm_movehl_ps(m, m));
+    m = _mm_max_ss(m, _mm_shuffle_ps(m, m, 1));
+    return _mm_cvtss_f32(m);
+}
+
+OV_TARGET_AVX2
+inline float horizontal_sum_avx2(__m256 v) {
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+    return _mm_cvtss_f32(s);
+}
+
+OV_TARGET_AVX2
+float reduce_max_avx2(const float* data, size_t size) {
+    // the accumulator is the second operand, so NaN inputs are skipped
+    __m256 max_vec = _mm256_set1_ps(negative_infinity);
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8)
+        max_vec = _mm256_max_ps(_mm256_loadu_ps(data + i), max_vec);
+    return reduce_max_scalar(data + i, size - i, horizontal_max_avx2(max_vec));
+}
+
+OV_TARGET_AVX2
+size_t find_first_equal_avx2(const float* data, size_t size, float value) {
+    const __m256 value_vec = _mm256_set1_ps(value);
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(data + i), value_vec, _CMP_EQ_OQ));
+        if (mask)
+            return i + count_trailing_zeros(static_cast<unsigned>(mask));
+    }
+    return i + find_first_equal_scalar(data + i, size - i, value);
+}
+
+OV_TARGET_AVX2
+float reduce_sum_avx2(const float* data, size_t size) {
+    __m256 sum_vec = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8)
+        sum_vec = _mm256_add_ps(sum_vec, _mm256_loadu_ps(data + i));
+    return horizontal_sum_avx2(sum_vec) + reduce_sum_scalar(data + i, size - i);
+}
+
+OV_TARGET_AVX2
+size_t find_first_greater_avx2(const float* data, size_t size, float threshold) {
+    const __m256 threshold_vec = _mm256_set1_ps(threshold);
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        int mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(data + i), threshold_vec, _CMP_GT_OQ));
+        if (mask)
+            return i + count_trailing_zeros(static_cast<unsigned>(mask));
+    }
+    return i + find_first_greater_scalar(data + i, size - i, threshold);
+}
+
+OV_TARGET_AVX2
+float exp_sum_avx2(const float* data, size_t size, float shift) {
+    const __m256 shift_vec = _mm256_set1_ps(shift);
+    __m256 sum_vec = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8)
+        sum_vec = _mm256_add_ps(sum_vec, exp_avx2(_mm256_sub_ps(_mm256_loadu_ps(data + i), shift_vec)));
+    return horizontal_sum_avx2(sum_vec) + exp_sum_scalar(data + i, size - i, shift);
+}
+
+OV_TARGET_AVX2
+float scaled_exp_avx2(float* data, size_t size, float shift, float scale) {
+    const __m256 shift_vec = _mm256_set1_ps(shift), scale_vec = _mm256_set1_ps(scale);
+    __m256 sum_vec = _mm256_setzero_ps();
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        __m256 value = exp_avx2(_mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(data + i), shift_vec), scale_vec));
+        _mm256_storeu_ps(data + i, value);
+        sum_vec = _mm256_add_ps(sum_vec, value);
+    }
+    return horizontal_sum_avx2(sum_vec) + scaled_exp_scalar(data + i, size - i, shift, scale);
+}
+
+OV_TARGET_AVX2
+void divide_avx2(float* data, size_t size, float divisor) {
+    const __m256 divisor_vec = _mm256_set1_ps(divisor);
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8)
+        _mm256_storeu_ps(data + i, _mm256_div_ps(_mm256_loadu_ps(data + i), divisor_vec));
+    divide_scalar(data + i, size - i, divisor);
+}
+
+OV_TARGET_AVX2
+void apply_token_bitmask_avx2(float* data, size_t size, const int32_t* bitmask) {
+    const __m256 negative_infinity_vec = _mm256_set1_ps(negative_infinity);
+    const __m256i lane_bits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        const int32_t bits = bitmask[i / 32];
+        if (bits == -1)
+            continue;
+        // a lane is stored when its bit is clear, i.e. the token is not allowed
+        for (int j = 0; j < 4; ++j) {
+            const __m256i byte = _mm256_set1_epi32(bits >> (8 * j));
+            const __m256i disallowed = _mm256_cmpeq_epi32(_mm256_and_si256(byte, lane_bits), _mm256_setzero_si256());
+            _mm256_maskstore_ps(data + i + 8 * j, disallowed, negative_infinity_vec);
+        }
+    }
+    apply_token_bitmask_scalar(data + i, size - i, bitmask + i / 32);
+}
+
+OV_TARGET_AVX512
+inline __m512 exp_avx512(__m512 x) {
+    using namespace exp_constants;
+    const __m512 clamped = _mm512_min_ps(_mm512_max_ps(x, _mm512_set1_ps(min_input)), _mm512_set1_ps(max_input));
+    const __m512 n = _mm512_roundscale_ps(_mm512_mul_ps(clamped, _mm512_set1_ps(log2e)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m512 r = _mm512_fnmadd_ps(n, _mm512_set1_ps(ln2_hi), clamped);
+    r = _mm512_fnmadd_ps(n, _mm512_set1_ps(ln2_lo), r);
+
+    __m512 p = _mm512_set1_ps(poly[0]);
+    for (size_t i = 1; i < poly.size(); ++i)
+        p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(poly[i]));
+    p = _mm512_fmadd_ps(p, _mm512_mul_ps(r, r), _mm512_add_ps(r, _mm512_set1_ps(1.0f)));
+
+    const __m512i exponent = _mm512_slli_epi32(_mm512_add_epi32(_mm512_cvtps_epi32(n), _mm512_set1_epi32(127)), 23);
+    __m512 result = _mm512_mul_ps(p, _mm512_castsi512_ps(exponent));
+
+    result = _mm512_mask_mov_ps(result, _mm512_cmp_ps_mask(x, _mm512_set1_ps(min_input), _CMP_LT_OQ), _mm512_setzero_ps());
+    result = _mm512_mask_mov_ps(result, _mm512_cmp_ps_mask(x, _mm512_set1_ps(max_input), _CMP_GT_OQ),
+                                _mm512_set1_ps(std::numeric_limits<float>::infinity()));
+    return _mm512_mask_mov_ps(result, _mm512_cmp_ps_mask(x, x, _CMP_UNORD_Q), x);
+}
+
+// folds the vector through memory, _mm512_reduce_* trigger false -Wuninitialized warnings in GCC 12 headers
+OV_TARGET_AVX512
+inline float horizontal_max_avx512(__m512 v) {
+    alignas(64) float lanes[16];
+    _mm512_store_ps(lanes, v);
+    return reduce_max_scalar(lanes, 16);
+}
+
+OV_TARGET_AVX512
+inline float horizontal_sum_avx512(__m512 v) {
+    alignas(64) float lanes[16];
+    _mm512_store_ps(lanes, v);
+    return reduce_sum_scalar(lanes, 16);
+}
+
+OV_TARGET_AVX512
+float reduce_max_avx512(const float* data, size_t size) {
+    __m512 max_vec = _mm512_set1_ps(negative_infinity);
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16)
+        max_vec = _mm512_max_ps(_mm512_loadu_ps(data + i), max_vec);
+    return reduce_max_scalar(data + i, size - i, horizontal_max_avx512(max_vec));
+}
+
+OV_TARGET_AVX512
+size_t find_first_equal_avx512(const float* data, size_t size, float value) {
+    const __m512 value_vec = _mm512_set1_ps(value);
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __mmask16 mask = _mm512_cmp_ps_mask(_mm512_loadu_ps(data + i), value_vec, _CMP_EQ_OQ);
+        if (mask)
+            return i + count_trailing_zeros(static_cast<unsigned>(mask));
+    }
+    return i + find_first_equal_scalar(data + i, size - i, value);
+}
+
+OV_TARGET_AVX512
+float reduce_sum_avx512(const float* data, size_t size) {
+    __m512 sum_vec = _mm512_setzero_ps();
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16)
+        sum_vec = _mm512_add_ps(sum_vec, _mm512_loadu_ps(data + i));
+    return horizontal_sum_avx512(sum_vec) + reduce_sum_scalar(data + i, size - i);
+}
+
+OV_TARGET_AVX512
+size_t find_first_greater_avx512(const float* data, size_t size, float threshold) {
+    const __m512 threshold_vec = _mm512_set1_ps(threshold);
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __mmask16 mask = _mm512_cmp_ps_mask(_mm512_loadu_ps(data + i), threshold_vec, _CMP_GT_OQ);
+        if (mask)
+            return i + count_trailing_zeros(static_cast<unsigned>(mask));
+    }
+    return i + find_first_greater_scalar(data + i, size - i, threshold);
+}
+
+OV_TARGET_AVX512
+float exp_sum_avx512(const float* data, size_t size, float shift) {
+    const __m512 shift_vec = _mm512_set1_ps(shift);
+    __m512 sum_vec = _mm512_setzero_ps();
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16)
+        sum_vec = _mm512_add_ps(sum_vec, exp_avx512(_mm512_sub_ps(_mm512_loadu_ps(data + i), shift_vec)));
+    return horizontal_sum_avx512(sum_vec) + exp_sum_scalar(data + i, size - i, shift);
+}
+
+OV_TARGET_AVX512
+float scaled_exp_avx512(float* data, size_t size, float shift, float scale) {
+    const __m512 shift_vec = _mm512_set1_ps(shift), scale_vec = _mm512_set1_ps(scale);
+    __m512 sum_vec = _mm512_setzero_ps();
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        __m512 value = exp_avx512(_mm512_mul_ps(_mm512_sub_ps(_mm512_loadu_ps(data + i), shift_vec), scale_vec));
+        _mm512_storeu_ps(data + i, value);
+        sum_vec = _mm512_add_ps(sum_vec, value);
+    }
+    return horizontal_sum_avx512(sum_vec) + scaled_exp_scalar(data + i, size - i, shift, scale);
+}
+
+OV_TARGET_AVX512
+void divide_avx512(float* data, size_t size, float divisor) {
+    const __m512 divisor_vec = _mm512_set1_ps(divisor);
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16)
+        _mm512_storeu_ps(data + i, _mm512_div_ps(_mm512_loadu_ps(data + i), divisor_vec));
+    divide_scalar(data + i, size - i, divisor);
+}
+
+OV_TARGET_AVX512
+void apply_token_bitmask_avx512(float* data, size_t size, const int32_t* bitmask) {
+    const __m512 negative_infinity_vec = _mm512_set1_ps(negative_infinity);
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        const uint32_t disallowed = ~static_cast<uint32_t>(bitmask[i / 32]);
+        if (disallowed == 0)
+            continue;
+        _mm512_mask_storeu_ps(data + i, static_cast<__mmask16>(disallowed), negative_infinity_vec);
+        _mm512_mask_storeu_ps(data + i + 16, static_cast<__mmask16>(disallowed >> 16), negative_infinity_vec);
+    }
+    apply_token_bitmask_scalar(data + i, size - i, bitmask + i / 32);
+}
+
+#    define OV_DISPATCH(name, ...)                       \
+        switch (active_isa) {                            \
+        case ISA::AVX512:                                \
+            return name##_avx512(__VA_ARGS__);           \
+        case ISA::AVX2:                                  \
+            return name##_avx2(__VA_ARGS__);             \
+        default:                                         \
+            return name##_scalar(__VA_ARGS__);           \
+        }
+#else
+#    define OV_DISPATCH(name, ...) return name##_scalar(__VA_ARGS__);
+#endif  // OPENVINO_ARCH_X86_64
+
+size_t find_first_equal(const float* data, size_t size, float value) {
+    OV_DISPATCH(find_first_equal, data, size, value)
+}
+
+float scaled_exp(float* data, size_t size, float shift, float scale) {
+    OV_DISPATCH(scaled_exp, data, size, shift, scale)
+}
+
+void divide(float* data, size_t size, float divisor) {
+    OV_DISPATCH(divide, data, size, divisor)
+}
+
+// maps float bit patterns to unsigned keys preserving the order of values, NaNs are mapped below -inf
+uint32_t to_ordered_key(float value) {
+    if (std::isnan(value))
+        return 0;
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+float from_ordered_key(uint32_t key) {
+    if (key == 0)
+        return std::numeric_limits<float>::quiet_NaN();
+    uint32_t bits = (key & 0x80000000u) ? (key & 0x7FFFFFFFu) : ~key;
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+}  // namespace
+
+ISA get_isa() {
+    return active_isa;
+}
+
+void set_max_isa(ISA isa) {
+    active_isa = std::min(isa, supported_isa);
+}
+
+float reduce_max(const float* data, size_t size) {
+    OV_DISPATCH(reduce_max, data, size)
+}
+
+size_t argmax(const float* data, size_t size) {
+    const float max_value = reduce_max(data, size);
+    if (max_value == negative_infinity)
+        return 0;
+    return find_first_equal(data, size, max_value);
+}
+
+float reduce_sum(const float* data, size_t size) {
+    OV_DISPATCH(reduce_sum, data, size)
+}
+
+size_t find_first_greater(const float* data, size_t size, float threshold) {
+    OV_DISPATCH(find_first_greater, data, size, threshold)
+}
+
+float exp_sum(const float* data, size_t size, float shift) {
+    OV_DISPATCH(exp_sum, data, size, shift)
+}
+
+void softmax(float* data, size_t size, float temperature) {
+    const float max_value = reduce_max(data, size);
+    const float norm_sum = scaled_exp(data, size, max_value, 1.0f / temperature);
+    divide(data, size, norm_sum);
+}
+
+void apply_token_bitmask(float* data, size_t size, const int32_t* bitmask) {
+    OV_DISPATCH(apply_token_bitmask, data, size, bitmask)
+}
+
+float top_k_threshold(const float* data, size_t size, size_t k, size_t stride) {
+    if (size == 0 || k == 0)
+        return std::numeric_limits<float>::infinity();
+    k = std::min(k, size);
+
+    // MSB-first radix select: every pass fixes the next 8 bits of the k-th largest key
+    // by counting the keys which share the already fixed prefix
+    uint32_t prefix = 0, prefix_mask = 0;
+    std::array<size_t, 256> histogram;
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        histogram.fill(0);
+        for (size_t i = 0; i < size; ++i) {
+            const uint32_t key = to_ordered_key(data[i * stride]);
+            if ((key & prefix_mask) == prefix)
+                ++histogram[(key >> shift) & 0xFF];
+        }
+        size_t digit = 255;
+        while (histogram[digit] < k) {
+            k -= histogram[digit];
+            --digit;
+        }
+        prefix |= static_cast<uint32_t>(digit) << shift;
+        prefix_mask |= 0xFFu << shift;
+    }
+    return from_ordered_key(prefix);
+}
+
+}  // namespace ov::genai::kernels
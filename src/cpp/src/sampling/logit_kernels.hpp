@@ -0,0 +1,83 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov::genai::kernels {
+
+/**
+ * @brief Vectorized reductions and transforms over contiguous logit buffers used by the sampler.
+ * Every function dispatches at runtime to an AVX-512 or AVX2 implementation when the CPU supports it
+ * and falls back to a scalar loop otherwise. NaN values are ignored by the max/argmax reductions.
+ */
+
+enum class ISA {
+    SCALAR,
+    AVX2,
+    AVX512
+};
+
+/**
+ * @return The instruction set used by the kernels on this CPU.
+ */
+ISA get_isa();
+
+/**
+ * @brief Limits the instruction set used by the kernels. Mainly for tests and benchmarks.
+ * @param isa The best allowed instruction set. It is further limited by the CPU capabilities.
+ */
+void set_max_isa(ISA isa);
+
+/**
+ * @return The maximum value, or -inf if `size` is 0 or all values are NaN.
+ */
+float reduce_max(const float* data, size_t size);
+
+/**
+ * @return The index of the first occurrence of the maximum value, or 0 if there is no such value.
+ */
+size_t argmax(const float* data, size_t size);
+
+float reduce_sum(const float* data, size_t size);
+
+/**
+ * @return The index of the first value strictly greater than `threshold`, or `size` if there is none.
+ */
+size_t find_first_greater(const float* data, size_t size, float threshold);
+
+/**
+ * @return Σ exp(data[i] - shift). With `shift` set to the maximum value it is the log-sum-exp denominator.
+ */
+float exp_sum(const float* data, size_t size, float shift);
+
+/**
+ * @brief Computes softmax(data / temperature) in place, fusing the scaling, the exponent and the normalization.
+ */
+void softmax(float* data, size_t size, float temperature);
+
+/**
+ * @brief Sets to -inf the logits of the tokens which are not allowed by a packed token bitmask.
+ * @param bitmask `ceil(size / 32)` words, bit `i % 32` of word `i / 32` is set if token `i` is allowed,
+ * the layout produced by XGrammar matchers.
+ */
+void apply_token_bitmask(float* data, size_t size, const int32_t* bitmask);
+
+/**
+ * @return Whether token `index` is allowed by a packed token bitmask, see apply_token_bitmask.
+ */
+inline bool is_token_allowed(const int32_t* bitmask, size_t index) {
+    return (static_cast<uint32_t>(bitmask[index / 32]) >> (index % 32)) & 1u;
+}
+
+/**
+ * @brief Finds the k-th largest value with a radix select over the float bit patterns in O(size) time.
+ * Elements strictly greater than the result, followed by the needed number of elements equal to it, form the top-k.
+ * @param stride Distance between consecutive values in floats, allowing to select over arrays of structures.
+ * @return The k-th largest value, NaNs are ordered below -inf.
+ */
+float top_k_threshold(const float* data, size_t size, size_t k, size_t stride = 1);
+
+}  // namespace ov::genai::kernels
@@ -7,6 +7,7 @@
 #include <cmath>
 
 #include "openvino/genai/generation_config.hpp"
+#include "sampling/logit_kernels.hpp"
 
 namespace ov::genai {
 
@@ -186,12 +187,15 @@ public:
                 logits.m_vector[i] = Token(logits.m_data[i], static_cast<int64_t>(i));
             std::make_heap(logits.m_vector.begin(), logits.m_vector.end(), min_cmp);
 
-            for (size_t i = m_top_k; i < logits.m_size; i++) {
-                if (logits.m_data[i] > logits.m_vector[0].m_log_prob) {
-                    std::pop_heap(logits.m_vector.begin(), logits.m_vector.end(), min_cmp);
-                    logits.m_vector.back() = Token(logits.m_data[i], static_cast<int64_t>(i));
-                    std::push_heap(logits.m_vector.begin(), logits.m_vector.end(), min_cmp);
-                }
+            // The heap root is the current selection threshold: skip over the elements not exceeding it
+            // with a vectorized scan, which keeps the insertion order (and so the resulting heap order) intact.
+            for (size_t i = m_top_k; ; i++) {
+                i += kernels::find_first_greater(logits.m_data + i, logits.m_size - i, logits.m_vector[0].m_log_prob);
+                if (i >= logits.m_size)
+                    break;
+                std::pop_heap(logits.m_vector.begin(), logits.m_vector.end(), min_cmp);
+                logits.m_vector.back() = Token(logits.m_data[i], static_cast<int64_t>(i));
+                std::push_heap(logits.m_vector.begin(), logits.m_vector.end(), min_cmp);
             }
         }
         logits.m_size = m_top_k;
@@ -217,10 +221,8 @@ public:
     void apply(Logits& logits) override {
         OPENVINO_ASSERT(!logits.is_vector_initialized(),
             "FullVocabLogSumExpTransform must run before any transform that modifies m_data or creates m_vector");
-        const float max_logit = *std::max_element(logits.m_data, logits.m_data + logits.m_size);
-        float sum = 0.0f;
-        for (size_t i = 0; i < logits.m_size; ++i)
-            sum += expf(logits.m_data[i] - max_logit);
+        const float max_logit = kernels::reduce_max(logits.m_data, logits.m_size);
+        const float sum = kernels::exp_sum(logits.m_data, logits.m_size, max_logit);
         logits.m_full_vocab_log_sum_exp = logf(sum) + max_logit;
     }
 };
@@ -288,24 +290,9 @@ public:
                 for (size_t i = 0; i < logits.m_size; i++)
                     logits.m_vector[i].m_log_prob /= norm_sum;
             } else {
-                // No effective top_k filtering: expf on all m_data elements directly.
-                float max_logit = *std::max_element(logits.m_data, logits.m_data + logits.m_size);
-                float norm_sum = 0.0f;
-                if (m_temperature == 1.0f) {
-                    for (size_t i = 0; i < logits.m_size; i++) {
-                        logits.m_data[i] = expf(logits.m_data[i] - max_logit);
-                        norm_sum += logits.m_data[i];
-                    }
-                } else {
-                    const float scaling_factor = 1.0f / m_temperature;
-                    for (size_t i = 0; i < logits.m_size; i++) {
-                        logits.m_data[i] = expf((logits.m_data[i] - max_logit) * scaling_factor);
-                        norm_sum += logits.m_data[i];
-                    }
-                }
+                // No effective top_k filtering: fused temperature scaling + softmax on all m_data elements.
                 // Normalization required for TopPFilter correctness (cumulative prob comparison).
-                for (size_t i = 0; i < logits.m_size; i++)
-                    logits.m_data[i] /= norm_sum;
+                kernels::softmax(logits.m_data, logits.m_size, m_temperature);
             }
         }
     }
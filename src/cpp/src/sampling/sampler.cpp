@@ -1,9 +1,10 @@
 // Copyright (C) 2023-2026 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
-#include <future>
+#include <cstddef>
 
 #include "sampling/sampler.hpp"
+#include "sampling/logit_kernels.hpp"
 #include "tokenizer/tokenizer_impl.hpp"
 
 namespace ov::genai {
@@ -56,11 +57,8 @@ std::vector<Token> log_softmax(const ov::Tensor& logits, size_t batch_idx) {
 
     size_t batch_offset = batch_idx * seq_len * vocab_size, sequence_offset = (seq_len - 1) * vocab_size;
     const float* beam_logits = logits.data<const float>() + batch_offset + sequence_offset;
-    float max_logit = *std::max_element(beam_logits, beam_logits + vocab_size);
-    float log_sum = std::log(std::accumulate(
-        beam_logits, beam_logits + vocab_size, 0.0f, [max_logit](float accumulated, float to_add) {
-            return accumulated + std::exp(to_add - max_logit);
-    }));
+    float max_logit = kernels::reduce_max(beam_logits, vocab_size);
+    float log_sum = std::log(kernels::exp_sum(beam_logits, vocab_size, max_logit));
 
     std::vector<Token> tokens;
     tokens.reserve(vocab_size);
@@ -359,8 +357,19 @@ void Sampler::GroupBeamSearcher::select_next_tokens(const ov::Tensor& logits,
                 }
             }
 
-            // sort tokens
-            std::sort(tokens.begin(), tokens.end(), [](Token left, Token right) {
+            // only 2 * group_size most probable tokens can become candidates: select them with a radix select
+            // over the log probabilities and sort just the selected ones
+            static_assert(offsetof(Token, m_log_prob) == 0 && sizeof(Token) % sizeof(float) == 0);
+            const size_t num_selected = std::min(2 * group_size, tokens.size());
+            const float threshold = kernels::top_k_threshold(&tokens.front().m_log_prob, tokens.size(), num_selected,
+                                                             sizeof(Token) / sizeof(float));
+            auto ties_begin = std::partition(tokens.begin(), tokens.end(), [threshold](const Token& token) {
+                return token.m_log_prob > threshold;
+            });
+            std::partition(ties_begin, tokens.end(), [threshold](const Token& token) {
+                return token.m_log_prob == threshold;
+            });
+            std::sort(tokens.begin(), tokens.begin() + num_selected, [](Token left, Token right) {
                 return left.m_log_prob > right.m_log_prob;  // Most probable tokens in front
             });
 
@@ -509,27 +518,20 @@ Token Sampler::_greedy_sample(const Logits& logits, size_t top_logprobs) const {
     // When logprobs > 0, m_vector is initialized (penalties wrote there, m_data is pristine);
     // scan m_vector so penalty effects influence token selection.
     // Otherwise operate directly on m_data.
-    size_t m = std::max(size_t(1), top_logprobs); // ensure m is at least 1
-    std::vector<float> top_values(m, -std::numeric_limits<float>::infinity());
-    std::vector<size_t> top_indexes(m, 0);
-
-    const bool use_vector = logits.is_vector_initialized();
-    auto value_at = [&](size_t i) { return use_vector ? logits.m_vector[i].m_log_prob : logits.m_data[i]; };
-    auto index_at = [&](size_t i) -> size_t { return use_vector ? static_cast<size_t>(logits.m_vector[i].m_index) : i; };
-
-    for (size_t i = 0; i < logits.m_size; ++i) {
-        if (value_at(i) > top_values.back()) {
-            top_values.back() = value_at(i);
-            top_indexes.back() = index_at(i);
-
-            for (size_t j = top_values.size() - 1; j > 0 && top_values[j] > top_values[j - 1]; --j) {
-                std::swap(top_values[j], top_values[j - 1]);
-                std::swap(top_indexes[j], top_indexes[j - 1]);
+    // Only the most probable token is returned, the first one wins among equal values.
+    size_t max_index = 0;
+    if (logits.is_vector_initialized()) {
+        float max_logit = -std::numeric_limits<float>::infinity();
+        for (size_t i = 0; i < logits.m_size; ++i) {
+            if (logits.m_vector[i].m_log_prob > max_logit) {
+                max_logit = logits.m_vector[i].m_log_prob;
+                max_index = static_cast<size_t>(logits.m_vector[i].m_index);
             }
         }
+    } else {
+        max_index = kernels::argmax(logits.m_data, logits.m_size);
     }
 
-    size_t max_index = top_indexes.front();
     float max_value = 0.0;
 
     if (top_logprobs) {
@@ -606,8 +608,7 @@ std::vector<Token> Sampler::_multinomial_sample(const Logits& logits, size_t num
             for (size_t i = 0; i < logits.m_size; ++i)
                 total_weight += logits.m_vector[i].m_log_prob;
         } else {
-            for (size_t i = 0; i < logits.m_size; ++i)
-                total_weight += logits.m_data[i];
+            total_weight = kernels::reduce_sum(logits.m_data, logits.m_size);
         }
         // Defensive fallback: should not occur in practice (at least one non-masked token is
         // always guaranteed), but recover gracefully by sampling uniformly if all probabilities
@@ -776,6 +777,42 @@ align_all_sequence_len(SequenceGroup::Ptr& sequence_group,
     logit_processor.update_generated_len(min_generated_tokens);
 }
 
+// keeps the branch of candidates with the most accepted tokens, the other branches are removed from the sequence group
+// and their tokens are unregistered from the logit processor; ties are resolved in favour of the earlier branch.
+// The kept branch takes over the grouped id of the original branch, as the tokens streamed so far are keyed by it
+Sequence::Ptr
+keep_longest_candidate_branch(SequenceGroup::Ptr& sequence_group,
+                              const std::vector<Sequence::Ptr>& branches,
+                              size_t verified_len,
+                              LogitProcessor& logit_processor,
+                              std::vector<uint64_t>& dropped_sequences) {
+    auto longest_branch_it = std::max_element(branches.begin(), branches.end(), [](const Sequence::Ptr& lhs, const Sequence::Ptr& rhs) {
+        return lhs->get_generated_len() < rhs->get_generated_len();
+    });
+    Sequence::Ptr longest_branch = *longest_branch_it;
+    // forks get grouped ids after the one of the sequence they are forked from
+    const uint64_t original_grouped_id = (*std::min_element(branches.begin(), branches.end(), [](const Sequence::Ptr& lhs, const Sequence::Ptr& rhs) {
+        return lhs->get_grouped_id() < rhs->get_grouped_id();
+    }))->get_grouped_id();
+    for (const auto& branch : branches) {
+        if (branch == longest_branch) {
+            continue;
+        }
+        const auto& generated_token_ids = branch->get_generated_ids();
+        for (size_t i = verified_len; i < generated_token_ids.size(); ++i) {
+            logit_processor.decrease_generated_token_occurance(generated_token_ids[i]);
+        }
+        // finished branches are already dropped
+        if (!branch->has_finished()) {
+            dropped_sequences.push_back(branch->get_id());
+        }
+        sequence_group->remove_sequence(branch->get_id());
+    }
+    longest_branch->set_grouped_id(original_grouped_id);
+    sequence_group->set_candidate_branches(false);
+    return longest_branch;
+}
+
 bool Sampler::validate_candidate(
     Sequence::Ptr running_sequence,
     size_t& token_idx,
@@ -890,11 +927,16 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
     if (sampling_params.is_greedy_decoding() || sampling_params.is_multinomial()) {
         std::vector<Sequence::Ptr> running_sequences = sequence_group->get_running_sequences();
         size_t num_running_sequences = sequence_group->num_running_seqs();
+        const bool has_candidate_branches = sequence_group->has_candidate_branches();
         if (sampling_params.is_greedy_decoding()) {
-            OPENVINO_ASSERT(num_running_sequences == 1);
+            OPENVINO_ASSERT(num_running_sequences == 1 || (has_candidate_branches && is_validation_mode_enabled));
         }
+        // branches share the tokens generated before the candidates
+        const size_t verified_len = has_candidate_branches ? running_sequences.front()->get_generated_len() - num_generated_tokens_to_validate : 0;
+        std::vector<size_t> num_generated_tokens_per_sequence(num_running_sequences, 0);
         for (size_t running_sequence_id = 0; running_sequence_id < num_running_sequences; ++running_sequence_id) {
             auto& running_sequence = running_sequences[running_sequence_id];
+            const size_t num_generated_tokens_before = sg_sampling_info.sampler_output.num_generated_tokens;
             bool is_validation_passed = true;
             // make `num_tokens_to_process` iteration to validate a candidate generated by `draft_model` + 1 iteration to generate one more token by `main_model`
             for (size_t i = 0; i <= num_tokens_to_process; ++i) {
@@ -989,6 +1031,15 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
                 }
             }
             assisting_pipeline_info.min_generated_len = std::min(assisting_pipeline_info.min_generated_len, running_sequence->get_generated_len());
+            num_generated_tokens_per_sequence[running_sequence_id] = sg_sampling_info.sampler_output.num_generated_tokens - num_generated_tokens_before;
+        }
+        if (has_candidate_branches) {
+            const auto longest_branch = keep_longest_candidate_branch(sequence_group, running_sequences, verified_len, logit_processor,
+                                                                      sg_sampling_info.sampler_output.m_dropped_sequences);
+            assisting_pipeline_info.min_generated_len = longest_branch->get_generated_len();
+            // tokens of the dropped branches are not generated
+            const size_t longest_branch_id = std::find(running_sequences.begin(), running_sequences.end(), longest_branch) - running_sequences.begin();
+            sg_sampling_info.sampler_output.num_generated_tokens = num_generated_tokens_per_sequence[longest_branch_id];
         }
         align_all_sequence_len(sequence_group, assisting_pipeline_info.min_generated_len, logit_processor);
         for (const auto& dropped_seq_id : _try_finish_generation(sequence_group, ctx.stop_strings)) {
@@ -1029,6 +1080,47 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
     return sg_sampling_info;
 }
 
+Sampler::RequestSamplerContext& Sampler::_get_or_create_request_context(const SequenceGroup::Ptr& sequence_group, size_t vocab_size) {
+    const ov::genai::GenerationConfig& sampling_params = sequence_group->get_sampling_parameters();
+    const auto request_id = sequence_group->get_request_id();
+    if (!m_request_contexts.count(request_id)) {
+        std::shared_ptr<StructuredOutputController> structured_output_controller = nullptr;
+        if (m_tokenizer.m_pimpl != nullptr) {
+            structured_output_controller = m_tokenizer.m_pimpl->get_structured_output_controller(vocab_size);
+        }
+        LogitProcessor lp(sampling_params, sequence_group->get_prompt_ids(), structured_output_controller);
+        m_request_contexts.emplace(
+            std::piecewise_construct,
+            std::forward_as_tuple(request_id),
+            std::forward_as_tuple(sampling_params.rng_seed, std::move(lp)));
+    }
+    auto& ctx = m_request_contexts.at(request_id);
+    // Process stop strings if not yet done. The context may have been pre-created via
+    // create_logit_processor() (speculative decoding CB path), which does not have
+    // access to sequence_group and cannot call set_stream_window_size(). Check
+    // ctx.stop_strings to avoid re-processing on subsequent sample() calls.
+    if (!sampling_params.stop_strings.empty() && ctx.stop_strings.second.empty()) {
+        OPENVINO_ASSERT(m_tokenizer.m_pimpl != nullptr, "Stop strings require a valid tokenizer");
+        ctx.stop_strings = process_stop_strings(sampling_params.stop_strings, m_tokenizer);
+        sequence_group->set_stream_window_size(ctx.stop_strings.first);
+    }
+    return ctx;
+}
+
+void Sampler::prepare(const std::vector<SequenceGroup::Ptr> & sequence_groups, size_t vocab_size) {
+    for (const auto& sequence_group : sequence_groups) {
+        if (sequence_group->is_scheduled() && sequence_group->requires_sampling()) {
+            _get_or_create_request_context(sequence_group, vocab_size);
+        }
+    }
+}
+
+void Sampler::start_structured_output_compilation(const GenerationConfig& sampling_parameters, size_t vocab_size) {
+    if (m_tokenizer.m_pimpl != nullptr && sampling_parameters.is_structured_output_generation()) {
+        m_tokenizer.m_pimpl->get_structured_output_controller(vocab_size)->start_grammar_compilation(sampling_parameters);
+    }
+}
+
 SamplerOutput Sampler::sample(const std::vector<SequenceGroup::Ptr> & sequence_groups,
                               ov::Tensor logits,
                               bool is_validation_mode_enabled) {
@@ -1038,7 +1130,15 @@ SamplerOutput Sampler::sample(const std::vector<SequenceGroup::Ptr> & sequence_g
     size_t vocab_size = logits_shape[2];
 
     SamplerOutput sampler_output;
-    std::unordered_map<uint64_t, std::future<SequenceGroupSamplingInfo>> sg_sampling_future_map;
+    // sequence groups to sample from, processed in parallel by the thread pool
+    struct SamplingTask {
+        size_t sequence_group_id;
+        ov::Tensor logits;
+        RequestSamplerContext* context;
+        SequenceGroupSamplingInfo sampling_info;
+    };
+    std::vector<SamplingTask> sampling_tasks;
+    sampling_tasks.reserve(sequence_groups.size());
     for (size_t sequence_group_id = 0, currently_processed_tokens = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
         SequenceGroup::Ptr sequence_group = sequence_groups[sequence_group_id];
         if (!sequence_group->is_scheduled())
@@ -1046,36 +1146,12 @@ SamplerOutput Sampler::sample(const std::vector<SequenceGroup::Ptr> & sequence_g
 
         const size_t num_running_sequences = sequence_group->num_running_seqs();
         const size_t output_seq_len = sequence_group->get_output_seq_len();
-        const ov::genai::GenerationConfig& sampling_params = sequence_group->get_sampling_parameters();
 
-        const auto request_id = sequence_group->get_request_id();
-        if (!m_request_contexts.count(request_id)) {
-            std::shared_ptr<StructuredOutputController> structured_output_controller = nullptr;
-            if (m_tokenizer.m_pimpl != nullptr) {
-                structured_output_controller = m_tokenizer.m_pimpl->get_structured_output_controller(vocab_size);
-            }
-            LogitProcessor lp(sampling_params, sequence_group->get_prompt_ids(), structured_output_controller);
-            m_request_contexts.emplace(
-                std::piecewise_construct,
-                std::forward_as_tuple(request_id),
-                std::forward_as_tuple(sampling_params.rng_seed, std::move(lp)));
-        }
-        auto& ctx = m_request_contexts.at(request_id);
-        // Process stop strings if not yet done. The context may have been pre-created via
-        // create_logit_processor() (speculative decoding CB path), which does not have
-        // access to sequence_group and cannot call set_stream_window_size(). Check
-        // ctx.stop_strings to avoid re-processing on subsequent sample() calls.
-        if (!sampling_params.stop_strings.empty() && ctx.stop_strings.second.empty()) {
-            OPENVINO_ASSERT(m_tokenizer.m_pimpl != nullptr, "Stop strings require a valid tokenizer");
-            ctx.stop_strings = process_stop_strings(sampling_params.stop_strings, m_tokenizer);
-            sequence_group->set_stream_window_size(ctx.stop_strings.first);
-        }
+        auto& ctx = _get_or_create_request_context(sequence_group, vocab_size);
         const void * sequence_group_logits_data = logits_data + vocab_size * currently_processed_tokens;
         ov::Tensor sequence_group_logits(ov::element::f32, ov::Shape{num_running_sequences, output_seq_len, vocab_size}, (void *)sequence_group_logits_data);
         if (sequence_group->requires_sampling()) {
-            // Call sample_from_sequence_group asynchronously
-            sg_sampling_future_map[request_id] = m_thread_pool.submit(&Sampler::sample_from_sequence_group, this, sequence_group, sequence_group_logits,
-                                                                      std::ref(ctx), is_validation_mode_enabled);
+            sampling_tasks.push_back({sequence_group_id, sequence_group_logits, &ctx, {}});
         } else {
             // we are in prompt processing phase when prompt is split into chunks and processed step by step
         }
@@ -1083,15 +1159,20 @@ SamplerOutput Sampler::sample(const std::vector<SequenceGroup::Ptr> & sequence_g
         currently_processed_tokens += output_seq_len * num_running_sequences;
     }
 
+    m_thread_pool.parallel_for(sampling_tasks.size(), [&](size_t task_id) {
+        SamplingTask& task = sampling_tasks[task_id];
+        task.sampling_info = sample_from_sequence_group(sequence_groups[task.sequence_group_id], task.logits,
+                                                        *task.context, is_validation_mode_enabled);
+    });
+
     // Update sequence groups internal states after sampling is done
-    for (auto& sequence_group : sequence_groups) {
+    for (size_t sequence_group_id = 0, task_id = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
+        const SequenceGroup::Ptr& sequence_group = sequence_groups[sequence_group_id];
         if (!sequence_group->is_scheduled())
             continue;
         SequenceGroupSamplingInfo sg_sampling_info;
-        const auto request_id = sequence_group->get_request_id();
-        if (sg_sampling_future_map.find(request_id) != sg_sampling_future_map.end()) {
-            // If there is a future assigned to a sequence group we read it's result (blocking if results not available yet)
-            sg_sampling_info = sg_sampling_future_map[request_id].get();
+        if (task_id < sampling_tasks.size() && sampling_tasks[task_id].sequence_group_id == sequence_group_id) {
+            sg_sampling_info = std::move(sampling_tasks[task_id++].sampling_info);
             sampler_output.num_generated_tokens += sg_sampling_info.sampler_output.num_generated_tokens;
 
             // Merge sampler output from sequence group to the main one
@@ -99,6 +99,8 @@ class Sampler {
                                                         RequestSamplerContext& context,
                                                         bool is_validation_mode_enabled);
 
+    RequestSamplerContext& _get_or_create_request_context(const SequenceGroup::Ptr& sequence_group, size_t vocab_size);
+
     // request ID => beam search tracking information (kept separate — has its own mutex)
     std::map<uint64_t, GroupBeamSearcher> m_beam_search_info;
     std::mutex m_beam_search_info_mutex;
@@ -118,6 +120,14 @@ public:
 
     SamplerOutput sample(const std::vector<SequenceGroup::Ptr> & sequence_groups, ov::Tensor logits, bool is_validation_mode_enabled = false);
 
+    // Creates the per-request sampling contexts (logit processors, structured output matchers, stop strings) for scheduled
+    // sequence groups ahead of `sample`, e.g. while the inference producing the logits is still running.
+    void prepare(const std::vector<SequenceGroup::Ptr> & sequence_groups, size_t vocab_size);
+
+    // Starts background compilation of the structured output grammar of a new request, so that it overlaps with
+    // processing of the request prompt instead of blocking its first sampling.
+    void start_structured_output_compilation(const GenerationConfig& sampling_parameters, size_t vocab_size);
+
     // Non-CB pipelines required API for seed. The CB path uses per-request engines from m_request_contexts.
     void set_seed(size_t new_seed) { m_default_seed = new_seed; }
     size_t get_seed() const { return m_default_seed; }
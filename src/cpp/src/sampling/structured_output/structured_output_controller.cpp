@@ -61,6 +61,12 @@ void StructuredOutputController::validate_grammar(const std::optional<Structured
     backend->validate_grammar(structured_output_config);
 }
 
+void StructuredOutputController::start_grammar_compilation(const ov::genai::GenerationConfig& sampling_parameters) {
+    OPENVINO_ASSERT(sampling_parameters.structured_output_config.has_value());
+    std::string backend_name = sampling_parameters.structured_output_config.value().backend.value_or(get_default_backend_name());
+    get_backend(backend_name)->start_grammar_compilation(sampling_parameters);
+}
+
 std::shared_ptr<LogitTransformers::ILogitTransformer> StructuredOutputController::get_logits_transformer(const ov::genai::GenerationConfig& sampling_parameters) {
     OPENVINO_ASSERT(sampling_parameters.structured_output_config.has_value());
     std::string backend_name = sampling_parameters.structured_output_config.value().backend.value_or(get_default_backend_name());
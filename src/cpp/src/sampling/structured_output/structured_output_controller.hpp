@@ -49,6 +49,11 @@ public:
     virtual std::shared_ptr<ov::genai::LogitTransformers::ILogitTransformer>
         get_logits_transformer(const ov::genai::GenerationConfig& sampling_parameters) = 0;
     virtual void validate_grammar(const std::optional<StructuredOutputConfig>& structured_output_config) = 0;
+    /**
+     * @brief Lets a backend prepare the grammar in background before get_logits_transformer() is called for it.
+     * Backends which don't support it do nothing.
+     */
+    virtual void start_grammar_compilation(const ov::genai::GenerationConfig& sampling_parameters) {}
 };
 
 /**
@@ -73,6 +78,10 @@ public:
 
 
     void validate_grammar(const std::optional<StructuredOutputConfig>& structured_output_config);
+    /**
+     * @brief Starts compilation of the request grammar, so it overlaps with processing of the prompt.
+     */
+    void start_grammar_compilation(const ov::genai::GenerationConfig& sampling_parameters);
     std::shared_ptr<ov::genai::LogitTransformers::ILogitTransformer> get_logits_transformer(const ov::genai::GenerationConfig& sampling_parameters);
 
     static void register_backend(const std::string& name, BackendFactory factory);
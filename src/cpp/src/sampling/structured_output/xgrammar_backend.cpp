@@ -3,10 +3,13 @@
 
 #include "xgrammar_backend.hpp"
 #include "logger.hpp"
+#include "sampling/logit_kernels.hpp"
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <limits>
 #include <iostream>
+#include <nlohmann/json.hpp>
 
 namespace ov {
 namespace genai {
@@ -28,21 +31,23 @@ XGrammarStructuredOutput::XGrammarStructuredOutput(const ov::genai::Tokenizer::T
 }
 
 
-xgrammar::Grammar XGrammarStructuredOutput::parse_structural_tag(const StructuredOutputConfig::CompoundGrammar& compound_grammar) {
-    
-    std::ostringstream oss;
-
+std::string XGrammarStructuredOutput::structural_tag_to_string(const StructuredOutputConfig::CompoundGrammar& compound_grammar) {
     // compound grammar is already a string JSON representation
     if (std::holds_alternative<std::string>(compound_grammar)) {
-        oss << std::get<std::string>(compound_grammar);
-    } else {
-        oss << "{\"type\": \"structural_tag\", \"format\": ";
-        oss << std::visit([](const auto& grammar) -> std::string {
-            return StructuredOutputConfig::structural_tag_to_json(grammar);
-        }, compound_grammar);
-        oss << "}";
-    };
-    auto result = xgrammar::Grammar::FromStructuralTag(oss.str());
+        return std::get<std::string>(compound_grammar);
+    }
+
+    std::ostringstream oss;
+    oss << "{\"type\": \"structural_tag\", \"format\": ";
+    oss << std::visit([](const auto& grammar) -> std::string {
+        return StructuredOutputConfig::structural_tag_to_json(grammar);
+    }, compound_grammar);
+    oss << "}";
+    return oss.str();
+}
+
+xgrammar::Grammar XGrammarStructuredOutput::parse_structural_tag(const StructuredOutputConfig::CompoundGrammar& compound_grammar) {
+    auto result = xgrammar::Grammar::FromStructuralTag(structural_tag_to_string(compound_grammar));
     if (std::holds_alternative<xgrammar::Grammar>(result)) {
         return std::get<xgrammar::Grammar>(result);
     } else {
@@ -114,14 +119,75 @@ void XGrammarStructuredOutput::validate_grammar(const std::optional<StructuredOu
     create_grammar(structured_output_config);
 }
 
+std::string XGrammarStructuredOutput::get_grammar_key(const StructuredOutputConfig& structured_output_config) {
+    // the checks follow the priority of create_grammar()
+    if (structured_output_config.json_schema.has_value()) {
+        const std::string& json_schema = structured_output_config.json_schema.value();
+        // formatting doesn't affect the grammar, while the order of properties does, so it's preserved
+        const auto canonical_schema = nlohmann::ordered_json::parse(json_schema, nullptr, false);
+        return "json_schema:" + (canonical_schema.is_discarded() ? json_schema : canonical_schema.dump());
+    } else if (structured_output_config.regex.has_value()) {
+        return "regex:" + structured_output_config.regex.value();
+    } else if (structured_output_config.grammar.has_value()) {
+        return "ebnf:" + structured_output_config.grammar.value();
+    } else if (structured_output_config.structural_tags_config.has_value()) {
+        return std::visit([](const auto& config) -> std::string {
+            using ConfigType = std::decay_t<decltype(config)>;
+            if constexpr (std::is_same_v<ConfigType, StructuralTagsConfig>) {
+                return "structural_tags_config:" + config.to_json();
+            } else {
+                return "structural_tag:" + structural_tag_to_string(config);
+            }
+        }, structured_output_config.structural_tags_config.value());
+    } else if (structured_output_config.compound_grammar.has_value()) {
+        return "structural_tag:" + structural_tag_to_string(structured_output_config.compound_grammar.value());
+    }
+    OPENVINO_THROW("No grammar definition provided for structured output generation.");
+}
+
+XGrammarStructuredOutput::CompiledGrammarFuture
+XGrammarStructuredOutput::get_compiled_grammar(const StructuredOutputConfig& structured_output_config) {
+    std::string key = get_grammar_key(structured_output_config);
+
+    std::lock_guard<std::mutex> lock(m_compiled_grammars_mutex);
+    auto index_it = m_compiled_grammars_index.find(key);
+    if (index_it != m_compiled_grammars_index.end()) {
+        m_compiled_grammars.splice(m_compiled_grammars.begin(), m_compiled_grammars, index_it->second);
+        return index_it->second->second;
+    }
+
+    // errors of grammar creation are rethrown by get() of the future
+    CompiledGrammarFuture compiled_grammar = std::async(std::launch::async, [this, structured_output_config]() {
+        return m_grammar_compiler->CompileGrammar(create_grammar(structured_output_config));
+    }).share();
+    m_compiled_grammars.emplace_front(key, compiled_grammar);
+    m_compiled_grammars_index.emplace(std::move(key), m_compiled_grammars.begin());
+
+    // evict least recently used grammars, skipping the ones being compiled, since destruction of their futures blocks
+    auto it = m_compiled_grammars.end();
+    while (m_compiled_grammars.size() > COMPILED_GRAMMAR_CACHE_SIZE && it != m_compiled_grammars.begin()) {
+        --it;
+        if (it->second.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+            m_compiled_grammars_index.erase(it->first);
+            it = m_compiled_grammars.erase(it);
+        }
+    }
+    return compiled_grammar;
+}
+
+void XGrammarStructuredOutput::start_grammar_compilation(const ov::genai::GenerationConfig& sampling_parameters) {
+    OPENVINO_ASSERT(sampling_parameters.structured_output_config.has_value(),
+                    "Structured output is not enabled in the provided GenerationConfig.");
+    get_compiled_grammar(sampling_parameters.structured_output_config.value());
+}
+
 std::shared_ptr<LogitTransformers::ILogitTransformer>
 XGrammarStructuredOutput::get_logits_transformer(const ov::genai::GenerationConfig& sampling_parameters) {
     if (!sampling_parameters.structured_output_config.has_value()) {
         OPENVINO_THROW("Structured output is not enabled in the provided GenerationConfig.");
     }
     sampling_parameters.structured_output_config.value().validate();
-    auto grammar = create_grammar(sampling_parameters.structured_output_config);
-    auto compiled_grammar = m_grammar_compiler->CompileGrammar(grammar);
+    auto compiled_grammar = get_compiled_grammar(sampling_parameters.structured_output_config.value()).get();
     std::vector<int> override_stop_tokens(sampling_parameters.stop_token_ids.begin(), sampling_parameters.stop_token_ids.end());
     return std::make_shared<LogitTransformers::XGrammarLogitsTransformer>(std::move(compiled_grammar), override_stop_tokens);
 }
@@ -159,16 +225,6 @@ XGrammarLogitsTransformer::XGrammarLogitsTransformer(
     m_token_bitmask->strides = &m_bitmask_strides[0];  // xgrammar expects strides to be set, even for compact tensors
     m_bitmask_shape = {static_cast<int64_t>(m_token_bitmask_ov.get_size())};
     m_token_bitmask->shape = &m_bitmask_shape[0];
-    
-    m_next_token_logits = std::make_shared<DLTensor>();
-    m_next_token_logits->device = DLDevice{kDLCPU, 0};
-    m_next_token_logits->ndim = 1;
-    m_next_token_logits->dtype = DLDataType{kDLFloat, 32, 1};
-    m_next_token_logits->byte_offset = 0;
-    m_logits_shape = {static_cast<int64_t>(m_vocab_size)};
-    m_next_token_logits->shape = &m_logits_shape[0];
-    m_next_token_logits->strides = &m_logits_strides[0];
-    m_scratch.assign(m_vocab_size, 0.0f);
 }
 
 void XGrammarLogitsTransformer::accept_tokens(const TokenIds& input_ids) {
@@ -183,21 +239,17 @@ void XGrammarLogitsTransformer::apply(Logits& logits) {
         return;
     }
 
+    const int32_t* bitmask = m_token_bitmask_ov.data<int32_t>();
     if (logits.is_vector_initialized()) {
         // logprobs > 0 path: m_data holds pristine raw logits — must not be written.
-        // Apply the bitmask to a scratch buffer via the same xgrammar code path, then
-        // propagate -inf to the corresponding m_vector entries.
-        std::fill(m_scratch.begin(), m_scratch.end(), 0.0f);
-        m_next_token_logits->data = m_scratch.data();
-        xgrammar::ApplyTokenBitmaskInplaceCPU(m_next_token_logits.get(), *m_token_bitmask, m_vocab_size);
+        // Test the bits of the candidate tokens directly instead of masking the whole vocabulary.
         for (auto& token : logits.m_vector) {
-            if (std::isinf(m_scratch[token.m_index])) {
+            if (token.m_index < static_cast<size_t>(m_vocab_size) && !kernels::is_token_allowed(bitmask, token.m_index)) {
                 token.m_log_prob = -std::numeric_limits<float>::infinity();
             }
         }
     } else {
-        m_next_token_logits->data = logits.m_data;
-        xgrammar::ApplyTokenBitmaskInplaceCPU(m_next_token_logits.get(), *m_token_bitmask, m_vocab_size);
+        kernels::apply_token_bitmask(logits.m_data, std::min(logits.m_size, static_cast<size_t>(m_vocab_size)), bitmask);
     }
 }
 
@@ -8,8 +8,13 @@
 #include <xgrammar/tokenizer_info.h>
 #include "structured_output_controller.hpp"
 #include "dlpack/dlpack.h"
+#include <future>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace ov {
@@ -41,10 +46,6 @@ protected:
 
     ov::Tensor m_token_bitmask_ov;
     std::shared_ptr<DLTensor> m_token_bitmask;
-    std::shared_ptr<DLTensor> m_next_token_logits;
-    std::vector<float> m_scratch;  // vocab-sized scratch buffer for the m_vector masking path
-    std::vector<int64_t> m_logits_shape;
-    std::vector<int64_t> m_logits_strides = {1};
     std::vector<int64_t> m_bitmask_shape;
     std::vector<int64_t> m_bitmask_strides = {1};
     int m_vocab_size;
@@ -57,6 +58,8 @@ protected:
  * @brief XGrammarStructuredOutput is a structured output implementation that uses the XGrammar backend.
  *
  * Inherits from IStructuredOutputImpl and acts as the logit transformer builder for the XGrammar backend.
+ * Compiled grammars are kept in a LRU cache keyed by the grammar definition, where JSON schemas are canonicalized,
+ * so that requests with the same schema share a single compilation.
  */
 class XGrammarStructuredOutput : public IStructuredOutputImpl {
 public:
@@ -82,11 +85,35 @@ public:
      */
     std::shared_ptr<LogitTransformers::ILogitTransformer> get_logits_transformer(const ov::genai::GenerationConfig& sampling_parameters) override;
     void validate_grammar(const std::optional<StructuredOutputConfig>& structured_output_config) override;
+
+    /**
+     * @brief Starts compilation of the grammar in background unless it's already cached, so get_logits_transformer
+     * called later for the same grammar only waits for the remaining part of compilation.
+     * @param sampling_parameters The generation configuration parameters that include the grammar.
+     */
+    void start_grammar_compilation(const ov::genai::GenerationConfig& sampling_parameters) override;
+
+    /** The maximum number of compiled grammars kept in cache. */
+    static constexpr size_t COMPILED_GRAMMAR_CACHE_SIZE = 64;
 private:
+    using CompiledGrammarFuture = std::shared_future<xgrammar::CompiledGrammar>;
+
     std::unique_ptr<xgrammar::GrammarCompiler> m_grammar_compiler;
 
+    // most recently used grammars go first, compilations run in background hold the compiler until they finish,
+    // so the cache must be destroyed before m_grammar_compiler
+    std::list<std::pair<std::string, CompiledGrammarFuture>> m_compiled_grammars;
+    std::unordered_map<std::string, std::list<std::pair<std::string, CompiledGrammarFuture>>::iterator> m_compiled_grammars_index;
+    std::mutex m_compiled_grammars_mutex;
+
+    static std::string structural_tag_to_string(const StructuredOutputConfig::CompoundGrammar& compound_grammar);
     static xgrammar::Grammar parse_structural_tag(const StructuredOutputConfig::CompoundGrammar& compound_grammar);
     xgrammar::Grammar create_grammar(const std::optional<StructuredOutputConfig>& structured_output_config);
+
+    // returns a key, which is the same for configs describing the same grammar
+    static std::string get_grammar_key(const StructuredOutputConfig& structured_output_config);
+    // returns the cached compiled grammar or starts its compilation in background
+    CompiledGrammarFuture get_compiled_grammar(const StructuredOutputConfig& structured_output_config);
 };
 
 
@@ -3,76 +3,210 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <condition_variable>
-#include <functional>
-#include <future>
-#include <iostream>
+#include <cstddef>
+#include <exception>
+#include <memory>
 #include <mutex>
-#include <queue>
 #include <thread>
+#include <type_traits>
 #include <utility>
-#include <atomic>
+#include <vector>
 
+/**
+ * @brief Work-stealing thread pool executing index ranges in parallel.
+ * Every participant (the calling thread and `num_threads - 1` background workers) owns a deque of task indices
+ * represented by a contiguous [begin, end) range. A participant pops indices from the front of its own range and,
+ * once it is exhausted, steals the back half of the largest range among the other participants.
+ * Running a job does not allocate: the body is passed by pointer and the deques are preallocated.
+ */
 class ThreadPool {
+    struct alignas(64) WorkerDeque {
+        std::mutex mutex;
+        size_t begin = 0;
+        size_t end = 0;
+
+        bool pop_front(size_t& index) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (begin == end)
+                return false;
+            index = begin++;
+            return true;
+        }
+
+        size_t size() {
+            std::lock_guard<std::mutex> lock(mutex);
+            return end - begin;
+        }
+    };
+
+    std::vector<std::thread> m_threads;
+    std::unique_ptr<WorkerDeque[]> m_deques;
+    size_t m_num_threads;
+
+    // current job, published under m_job_mutex
+    std::mutex m_job_mutex;
+    std::condition_variable m_job_cv;
+    size_t m_job_generation = 0;
+    size_t m_num_participants = 0;
+    void* m_body = nullptr;
+    void (*m_invoke)(void*, size_t) = nullptr;
+    bool m_stop = false;
+
+    // number of background workers which have not finished the current job yet
+    std::atomic<size_t> m_num_active_workers{0};
+
+    std::mutex m_exception_mutex;
+    std::exception_ptr m_exception;
+
+    bool _steal(size_t thief_id, size_t num_participants, size_t& index) {
+        while (true) {
+            // pick the victim with the largest amount of remaining work
+            size_t victim_id = num_participants, victim_size = 0;
+            for (size_t offset = 1; offset < num_participants; ++offset) {
+                size_t candidate_id = (thief_id + offset) % num_participants;
+                size_t candidate_size = m_deques[candidate_id].size();
+                if (candidate_size > victim_size) {
+                    victim_id = candidate_id;
+                    victim_size = candidate_size;
+                }
+            }
+            if (victim_id == num_participants)
+                return false;
+
+            size_t stolen_begin, stolen_end;
+            {
+                WorkerDeque& victim = m_deques[victim_id];
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                if (victim.begin == victim.end)
+                    continue;
+                // take the back half, leaving the front (which the owner is about to pop) untouched
+                stolen_end = victim.end;
+                stolen_begin = victim.end - (victim.end - victim.begin + 1) / 2;
+                victim.end = stolen_begin;
+            }
+
+            index = stolen_begin;
+            if (stolen_begin + 1 < stolen_end) {
+                WorkerDeque& own = m_deques[thief_id];
+                std::lock_guard<std::mutex> lock(own.mutex);
+                own.begin = stolen_begin + 1;
+                own.end = stolen_end;
+            }
+            return true;
+        }
+    }
+
+    void _run(size_t participant_id, size_t num_participants) {
+        size_t index;
+        while (m_deques[participant_id].pop_front(index) || _steal(participant_id, num_participants, index)) {
+            try {
+                m_invoke(m_body, index);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(m_exception_mutex);
+                if (!m_exception)
+                    m_exception = std::current_exception();
+            }
+        }
+    }
 
-private:
-    std::vector<std::thread> threads;
-    std::queue<std::function<void()>> tasks;
-    std::mutex queue_mutex;
-    std::condition_variable cv;
-    bool stop{false};
+    void _worker_loop(size_t participant_id) {
+        size_t seen_generation = 0;
+        while (true) {
+            size_t num_participants;
+            {
+                std::unique_lock<std::mutex> lock(m_job_mutex);
+                m_job_cv.wait(lock, [&] {
+                    return m_stop || m_job_generation != seen_generation;
+                });
+                if (m_stop)
+                    return;
+                seen_generation = m_job_generation;
+                num_participants = m_num_participants;
+                if (participant_id >= num_participants)
+                    continue;
+            }
+            _run(participant_id, num_participants);
+            m_num_active_workers.fetch_sub(1, std::memory_order_acq_rel);
+        }
+    }
 
 public:
     ThreadPool(const ThreadPool& rhs) = delete;
     ThreadPool(ThreadPool&& rhs) = delete;
-    ThreadPool(size_t num_threads = std::thread::hardware_concurrency())
-    {
-        for (size_t i = 0; i < num_threads; ++i) {
-            threads.emplace_back([this] {
-                while (true) {
-                    std::function<void()> task;
-                    {
-                        std::unique_lock<std::mutex> lock(queue_mutex);
-                        cv.wait(lock, [this] {
-                            return !tasks.empty() || stop;
-                        });
-                        if (stop && tasks.empty()) {
-                            return;
-                        }
-                        task = std::move(tasks.front());
-                        tasks.pop();
-                    }
-                    task();
-                }
-            });
+
+    /**
+     * @param num_threads The total number of threads executing a job, including the calling thread.
+     */
+    explicit ThreadPool(size_t num_threads = std::thread::hardware_concurrency())
+        : m_deques(new WorkerDeque[std::max<size_t>(num_threads, 1)]),
+          m_num_threads(std::max<size_t>(num_threads, 1)) {
+        // participant 0 is the thread calling parallel_for
+        for (size_t participant_id = 1; participant_id < m_num_threads; ++participant_id) {
+            m_threads.emplace_back(&ThreadPool::_worker_loop, this, participant_id);
         }
     }
 
-    ~ThreadPool()
-    {
+    ~ThreadPool() {
         {
-            std::unique_lock<std::mutex> lock(queue_mutex);
-            stop = true;
+            std::lock_guard<std::mutex> lock(m_job_mutex);
+            m_stop = true;
         }
-        cv.notify_all();
-        for (auto& thread : threads) {
+        m_job_cv.notify_all();
+        for (auto& thread : m_threads) {
             thread.join();
         }
     }
 
-    template <typename F, typename... Args>
-    auto submit(F&& f, Args&&... args) -> std::future<std::invoke_result_t<F, Args...>>
-    {
-        using return_type = std::invoke_result_t<F, Args...>;
-        auto task = std::make_shared<std::packaged_task<return_type()>>(
-            std::bind(std::forward<F>(f), std::forward<Args>(args)...)
-        );
-        std::future<return_type> result = task->get_future();
-        {
-            std::unique_lock<std::mutex> lock(queue_mutex);
-            tasks.emplace([task]() { (*task)(); });
+    size_t get_num_threads() const {
+        return m_num_threads;
+    }
+
+    /**
+     * @brief Calls `body(index)` for every index in [0, num_tasks) and blocks until all calls are done.
+     * The calling thread takes part in the execution. The first exception thrown by `body` is rethrown
+     * once all the tasks are finished. Must not be called concurrently or from within `body`.
+     */
+    template <typename F>
+    void parallel_for(size_t num_tasks, F&& body) {
+        if (num_tasks == 0)
+            return;
+
+        using Body = std::remove_reference_t<F>;
+        m_body = const_cast<void*>(static_cast<const void*>(std::addressof(body)));
+        m_invoke = [](void* body_ptr, size_t index) {
+            (*static_cast<Body*>(body_ptr))(index);
+        };
+
+        const size_t num_participants = std::min(m_num_threads, num_tasks);
+        for (size_t participant_id = 0; participant_id < num_participants; ++participant_id) {
+            WorkerDeque& deque = m_deques[participant_id];
+            std::lock_guard<std::mutex> lock(deque.mutex);
+            deque.begin = num_tasks * participant_id / num_participants;
+            deque.end = num_tasks * (participant_id + 1) / num_participants;
+        }
+
+        if (num_participants > 1) {
+            m_num_active_workers.store(num_participants - 1, std::memory_order_release);
+            {
+                std::lock_guard<std::mutex> lock(m_job_mutex);
+                m_num_participants = num_participants;
+                ++m_job_generation;
+            }
+            m_job_cv.notify_all();
+        }
+
+        // with a single participant there is nothing to share, so the workers are not woken up
+        _run(0, num_participants);
+        while (m_num_active_workers.load(std::memory_order_acquire) != 0) {
+            std::this_thread::yield();
+        }
+
+        if (m_exception) {
+            std::exception_ptr exception = std::exchange(m_exception, nullptr);
+            std::rethrow_exception(exception);
         }
-        cv.notify_one();
-        return result;
     }
 };
@@ -5,6 +5,7 @@
 
 #include <vector>
 #include <cassert>
+#include <chrono>
 #include <set>
 #include <cstdlib>
 #include <string_view>
@@ -109,6 +110,11 @@ public:
         return m_grouped_id;
     }
 
+    // used when a forked sequence replaces the one it was forked from, so handle outputs stay under the same id
+    void set_grouped_id(uint64_t grouped_id) {
+        m_grouped_id = grouped_id;
+    }
+
     bool has_finished() const {
         return m_status == SequenceStatus::FINISHED;
     }
@@ -346,17 +352,41 @@ class SequenceGroup  : public std::enable_shared_from_this<SequenceGroup> {
     size_t m_num_validation_tokens = 0;
     // flag to enable/disable token generation, e.g. in speculative decoding scenario
     bool m_is_gen_paused = false;
+    // running sequences are alternative branches of candidates, only the longest accepted one is kept after validation
+    bool m_has_candidate_branches = false;
     // output seq len at current iteration
     size_t m_output_seq_len = 0;
 
     size_t m_num_streamed_tokens = 0, m_stream_window_size = 0;
 
+    // timestamps used by the priority scheduling and the per-class pipeline metrics
+    std::chrono::steady_clock::time_point m_arrival_time;
+    std::chrono::steady_clock::time_point m_last_scheduled_time;
+    std::optional<std::chrono::steady_clock::time_point> m_first_token_time;
+    std::chrono::steady_clock::time_point m_last_token_time;
+    // number of iterations which produced new tokens, and how many of them missed the TPOT deadline
+    size_t m_num_token_iterations = 0;
+    size_t m_num_late_token_iterations = 0;
+
     SequenceGroup(uint64_t request_id, const ov::genai::GenerationConfig& sampling_params, std::size_t block_size)
         : m_request_id(request_id),
           m_sampling_params(sampling_params),
           m_block_size(block_size),
           m_sequence_group_type(SequenceGroupType::TOKENS),
-          m_generation_stream(GenerationStream::create()) { }
+          m_generation_stream(GenerationStream::create()),
+          m_arrival_time(std::chrono::steady_clock::now()),
+          m_last_scheduled_time(m_arrival_time) { }
+
+    void register_token_iteration(std::chrono::steady_clock::time_point now) {
+        if (!m_first_token_time.has_value()) {
+            m_first_token_time = now;
+        } else if (m_sampling_params.tpot_deadline_ms > 0 &&
+                   now - m_last_token_time > std::chrono::milliseconds(m_sampling_params.tpot_deadline_ms)) {
+            ++m_num_late_token_iterations;
+        }
+        m_last_token_time = now;
+        ++m_num_token_iterations;
+    }
 
     bool out_of_memory() const {
         for (size_t seq_id = 0; seq_id < m_sequences.size(); ++seq_id) {
@@ -478,6 +508,18 @@ public:
         m_is_gen_paused = status;
     }
 
+    bool is_generation_paused() const {
+        return m_is_gen_paused;
+    }
+
+    void set_candidate_branches(bool has_candidate_branches) {
+        m_has_candidate_branches = has_candidate_branches;
+    }
+
+    bool has_candidate_branches() const {
+        return m_has_candidate_branches;
+    }
+
     // a sequence group can generate new tokens if it already processed m_max_content_len before
     bool can_generate_tokens() const {
         return m_max_content_len + m_num_validation_tokens >= get_prompt_len() && !m_is_gen_paused;
@@ -694,6 +736,14 @@ public:
 
     // mark current schedule phase as finished and updates internal counters
     void finish_iteration() {
+        if (m_num_scheduled_tokens > 0) {
+            const auto now = std::chrono::steady_clock::now();
+            m_last_scheduled_time = now;
+            // must be checked before the processed tokens are updated
+            if (requires_sampling()) {
+                register_token_iteration(now);
+            }
+        }
         m_num_processed_tokens += m_num_scheduled_tokens;
         // if some processed tokens were evicted, max content len is greater than number of processed tokens
         m_max_content_len = std::max(m_max_content_len, m_num_processed_tokens);
@@ -812,6 +862,46 @@ public:
         return m_is_gen_paused;
     }
 
+    std::chrono::steady_clock::time_point get_arrival_time() const {
+        return m_arrival_time;
+    }
+
+    /**
+     * @return The time the group was last scheduled, or its arrival time if it has not been scheduled yet.
+     */
+    std::chrono::steady_clock::time_point get_last_scheduled_time() const {
+        return m_last_scheduled_time;
+    }
+
+    const std::optional<std::chrono::steady_clock::time_point>& get_first_token_time() const {
+        return m_first_token_time;
+    }
+
+    std::chrono::steady_clock::time_point get_last_token_time() const {
+        return m_last_token_time;
+    }
+
+    size_t get_num_token_iterations() const {
+        return m_num_token_iterations;
+    }
+
+    size_t get_num_late_token_iterations() const {
+        return m_num_late_token_iterations;
+    }
+
+    /**
+     * @return The deadline of the next token according to the TTFT / TPOT targets of the request, or time_point::max()
+     * if the request has no target for it.
+     */
+    std::chrono::steady_clock::time_point get_next_token_deadline() const {
+        if (!m_first_token_time.has_value()) {
+            return m_sampling_params.ttft_deadline_ms > 0 ? m_arrival_time + std::chrono::milliseconds(m_sampling_params.ttft_deadline_ms)
+                                                          : std::chrono::steady_clock::time_point::max();
+        }
+        return m_sampling_params.tpot_deadline_ms > 0 ? m_last_token_time + std::chrono::milliseconds(m_sampling_params.tpot_deadline_ms)
+                                                      : std::chrono::steady_clock::time_point::max();
+    }
+
     GenerationStream::Ptr get_generation_stream() {
         return m_generation_stream;
     }
@@ -17,8 +17,12 @@ ContinuousBatchingPipeline::Eagle3DecodingImpl::Eagle3DecodingImpl(const ov::gen
     auto main_device = main_model_desc.device;
     std::string draft_device = draft_model_desc.device.empty() ? main_model_desc.device : draft_model_desc.device;
 
+    ov::AnyMap main_properties = main_model_desc.properties;
+    const bool is_adaptive_num_assistant_tokens_enabled = extract_speculative_decoding_option(main_properties, "adaptive_num_assistant_tokens");
+    m_is_overlap_enabled = extract_speculative_decoding_option(main_properties, "speculative_decoding_overlap");
+    m_chat_history_encoder.set_incremental(extract_speculative_decoding_option(main_properties, "incremental_chat_encoding"));
     ov::AnyMap draft_properties =
-        draft_model_desc.properties.empty() ? main_model_desc.properties : draft_model_desc.properties;
+        draft_model_desc.properties.empty() ? main_properties : draft_model_desc.properties;
 
     // main and draft model use same tokenizer, but could differ in configurations
     // for example, llama3 draft model has different eos_token_id in config.json
@@ -39,7 +43,7 @@ ContinuousBatchingPipeline::Eagle3DecodingImpl::Eagle3DecodingImpl(const ov::gen
                                                                                main_model_desc.generation_config,
                                                                                scheduler_configs.first,
                                                                                main_device,
-                                                                               main_model_desc.properties,
+                                                                               main_properties,
                                                                                true);
     m_draft_pipeline = std::make_shared<ContinuousBatchingForEagle3DecodingImpl>(draft_model,
                                                                                 draft_model_tokenizer,
@@ -48,6 +52,10 @@ ContinuousBatchingPipeline::Eagle3DecodingImpl::Eagle3DecodingImpl(const ov::gen
                                                                                 draft_device,
                                                                                 draft_properties,
                                                                                 false);
+    if (is_adaptive_num_assistant_tokens_enabled) {
+        m_draft_length_controller = std::make_shared<DraftLengthController>();
+        m_draft_pipeline->set_draft_length_controller(m_draft_length_controller);
+    }
     m_perf_metrics = ov::genai::SDPerModelsPerfMetrics();
     m_perf_metrics.raw_metrics.m_inference_durations = {{MicroSeconds(0.0f)}};
     m_draft_pipeline->raw_perf_metrics.m_inference_durations = {{ MicroSeconds(0.0f) }};
@@ -1,6 +1,7 @@
 // Copyright (C) 2023-2026 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <future>
 #include <thread>
 
 #include "openvino/genai/text_streamer.hpp"
@@ -26,6 +27,16 @@ bool are_tokenizers_equal(Tokenizer& lhs, Tokenizer& rhs) {
            lhs.get_bos_token_id() == rhs.get_bos_token_id() && lhs.get_pad_token_id() == rhs.get_pad_token_id();
 }
 
+bool extract_speculative_decoding_option(ov::AnyMap& properties, const std::string& name) {
+    auto it = properties.find(name);
+    if (it == properties.end()) {
+        return false;
+    }
+    bool value = it->second.as<bool>();
+    properties.erase(it);
+    return value;
+}
+
 std::pair<ov::genai::SchedulerConfig, ov::genai::SchedulerConfig>
 ContinuousBatchingPipeline::SpeculativeDecodingImpl::init_speculative_models(const ov::genai::ModelDesc& main_model_desc, const ov::genai::ModelDesc& draft_model_desc) {
     auto main_model = main_model_desc.model;
@@ -105,14 +116,22 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::SpeculativeDecodingImpl(con
     // todo: remove this condition after support of CVS-154103
     OPENVINO_ASSERT(are_tokenizers_equal(main_model_tokenizer, draft_model_tokenizer), "Tokenizers for draft and main models are different!");
     m_tokenizer = main_model_tokenizer;
-    ov::AnyMap draft_properties = draft_model_desc.properties.empty() ? main_model_desc.properties : draft_model_desc.properties;
+    ov::AnyMap main_properties = main_model_desc.properties;
+    const bool is_adaptive_num_assistant_tokens_enabled = extract_speculative_decoding_option(main_properties, "adaptive_num_assistant_tokens");
+    m_is_overlap_enabled = extract_speculative_decoding_option(main_properties, "speculative_decoding_overlap");
+    m_chat_history_encoder.set_incremental(extract_speculative_decoding_option(main_properties, "incremental_chat_encoding"));
+    ov::AnyMap draft_properties = draft_model_desc.properties.empty() ? main_properties : draft_model_desc.properties;
     // to create `main_pipeline` with enabled validation_mode and `draft_pipeline` with disabled validation mode
     m_main_pipeline = std::make_shared<ContinuousBatchingForSpeculativeDecodingImpl>(
         main_model_desc.model, main_model_tokenizer, main_model_desc.generation_config,
-        scheduler_configs.first, main_device, main_model_desc.properties, true);
+        scheduler_configs.first, main_device, main_properties, true);
     m_draft_pipeline = std::make_shared<ContinuousBatchingForSpeculativeDecodingImpl>(
         draft_model_desc.model, draft_model_tokenizer, draft_model_desc.generation_config,
         scheduler_configs.second, draft_device, draft_properties, false);
+    if (is_adaptive_num_assistant_tokens_enabled) {
+        m_draft_length_controller = std::make_shared<DraftLengthController>();
+        m_draft_pipeline->set_draft_length_controller(m_draft_length_controller);
+    }
 
     m_perf_metrics = ov::genai::SDPerModelsPerfMetrics();
     m_draft_pipeline->raw_perf_metrics.m_inference_durations =  {{ MicroSeconds(0.0f) }};
@@ -174,34 +193,52 @@ void ContinuousBatchingPipeline::SpeculativeDecodingImpl::step() {
     m_draft_pipeline->pull_awaiting_requests(true);
     m_main_pipeline->pull_awaiting_requests();
 
-    // generate candidates by draft model
-    const auto draft_start = std::chrono::steady_clock::now();
-    m_draft_pipeline->multistep();
-    const auto draft_end = std::chrono::steady_clock::now();
-    m_sd_metrics.draft_duration += PerfMetrics::get_microsec(draft_end - draft_start) / 1e6;
-    m_pipeline_metrics = m_main_pipeline->get_metrics();
-
     // to generate num_matches statistic
     std::map<int64_t, UpdateRequestResult> update_sequence_info;
-    // put candidates to model KV cache
-    auto draft_generated_requests = m_draft_pipeline->get_generated_requests();
-    for (const auto& candidate : m_draft_pipeline->get_generated_requests()) {
-        auto update_result = m_main_pipeline->update_request(candidate.first, candidate.second, false);
-        update_sequence_info.insert({{candidate.first, update_result}});
-    }
+    GeneratedRequests draft_generated_requests, main_generated_requests;
+    size_t num_draft_steps = 0;
+    float draft_duration = 0.f, main_duration = 0.f;
+    TimePoint main_end;
+    bool is_main_step_done = true;
+
+    if (m_is_overlap_enabled) {
+        OverlappedStepResult overlapped_step_result = overlapped_step(update_sequence_info);
+        num_draft_steps = overlapped_step_result.num_draft_steps;
+        draft_duration = overlapped_step_result.draft_duration;
+        main_duration = overlapped_step_result.main_duration;
+        is_main_step_done = overlapped_step_result.is_main_step_done;
+        main_end = std::chrono::steady_clock::now();
+        draft_generated_requests = m_draft_pipeline->get_generated_requests();
+        main_generated_requests = m_main_pipeline->get_generated_requests();
+    } else {
+        // generate candidates by draft model
+        const auto draft_start = std::chrono::steady_clock::now();
+        num_draft_steps = m_draft_pipeline->multistep();
+        const auto draft_end = std::chrono::steady_clock::now();
+        draft_duration = PerfMetrics::get_microsec(draft_end - draft_start);
+        m_pipeline_metrics = m_main_pipeline->get_metrics();
+
+        // put candidates to model KV cache
+        draft_generated_requests = m_draft_pipeline->get_generated_requests();
+        for (const auto& candidate : m_draft_pipeline->get_generated_requests()) {
+            auto update_result = m_main_pipeline->update_request(candidate.first, candidate.second, false);
+            update_sequence_info.insert({{candidate.first, update_result}});
+        }
 
-    const auto main_start = std::chrono::steady_clock::now();
-    m_main_pipeline->step();
-    const auto main_end = std::chrono::steady_clock::now();
-    const auto main_duration = PerfMetrics::get_microsec(main_end - main_start);
-    m_sd_metrics.main_duration += main_duration / 1e6;
-    m_pipeline_metrics = m_main_pipeline->get_metrics();
+        const auto main_start = std::chrono::steady_clock::now();
+        m_main_pipeline->step();
+        main_end = std::chrono::steady_clock::now();
+        main_duration = PerfMetrics::get_microsec(main_end - main_start);
 
-    auto main_generated_requests = m_main_pipeline->get_generated_requests();
-    for (const auto& checked_sequence : main_generated_requests) {
-        auto update_result = m_draft_pipeline->update_request(checked_sequence.first, checked_sequence.second, true);
-        update_sequence_info[checked_sequence.first].removed_tokens_cnt = update_result.removed_tokens_cnt;
+        main_generated_requests = m_main_pipeline->get_generated_requests();
+        for (const auto& checked_sequence : main_generated_requests) {
+            auto update_result = m_draft_pipeline->update_request(checked_sequence.first, checked_sequence.second, true);
+            update_sequence_info[checked_sequence.first].removed_tokens_cnt = update_result.removed_tokens_cnt;
+        }
     }
+    m_sd_metrics.draft_duration += draft_duration / 1e6;
+    m_sd_metrics.main_duration += main_duration / 1e6;
+    m_pipeline_metrics = m_main_pipeline->get_metrics();
 
     // finish draft request if the generation was completed
     for (const auto& draft_request : draft_generated_requests) {
@@ -210,6 +247,11 @@ void ContinuousBatchingPipeline::SpeculativeDecodingImpl::step() {
             m_draft_pipeline->finish_request(request_id);
             // remove draft_generation_handle from queue
             m_draft_generations.erase(request_id);
+            m_draft_turn_requests.erase(request_id);
+            m_candidates_to_validate.erase(request_id);
+            if (m_draft_length_controller) {
+                m_draft_length_controller->remove_request(request_id);
+            }
         }
         auto updated_seq_info = update_sequence_info[request_id];
         m_sd_metrics.update_draft_generated_len(request_id, updated_seq_info.inserted_tokens_cnt);
@@ -221,13 +263,21 @@ void ContinuousBatchingPipeline::SpeculativeDecodingImpl::step() {
         float acceptance_rate = 1 - static_cast<float>(updated_seq_info.removed_tokens_cnt) / updated_seq_info.inserted_tokens_cnt;
         m_sd_metrics.update_acceptance_rate(request_id, acceptance_rate * 100);
         m_sd_metrics.update_draft_accepted_tokens(request_id, (updated_seq_info.inserted_tokens_cnt - updated_seq_info.removed_tokens_cnt));
+        if (m_draft_length_controller && main_generated_requests.count(request_id)) {
+            const size_t num_accepted = updated_seq_info.inserted_tokens_cnt > updated_seq_info.removed_tokens_cnt ?
+                updated_seq_info.inserted_tokens_cnt - updated_seq_info.removed_tokens_cnt : 0;
+            m_draft_length_controller->update_acceptance(request_id, updated_seq_info.inserted_tokens_cnt, num_accepted);
+        }
+    }
+    if (m_draft_length_controller && num_draft_steps > 0 && is_main_step_done) {
+        m_draft_length_controller->update_cost_ratio(draft_duration / num_draft_steps, main_duration);
     }
 
     const auto step_end = std::chrono::steady_clock::now();
     const auto step_microsec_duration = PerfMetrics::get_microsec(step_end - step_start);
 
     // update perf metrics
-    const auto num_generated_tokens = m_main_pipeline->get_processed_tokens_per_iteration();
+    const auto num_generated_tokens = is_main_step_done ? m_main_pipeline->get_processed_tokens_per_iteration() : 0;
     if (num_generated_tokens > 0) {
         raw_perf_counters.m_token_infer_durations.emplace_back(step_microsec_duration);
         raw_perf_counters.m_inference_durations[0] += MicroSeconds(step_microsec_duration);
@@ -247,7 +297,82 @@ void ContinuousBatchingPipeline::SpeculativeDecodingImpl::step() {
     }
 }
 
+ContinuousBatchingPipeline::SpeculativeDecodingImpl::OverlappedStepResult
+ContinuousBatchingPipeline::SpeculativeDecodingImpl::overlapped_step(std::map<int64_t, UpdateRequestResult>& update_sequence_info) {
+    std::set<uint64_t> draft_request_ids, main_request_ids;
+    for (const auto& draft_request : m_draft_pipeline->get_generated_requests()) {
+        const uint64_t request_id = draft_request.first;
+        if (m_draft_turn_requests.count(request_id)) {
+            draft_request_ids.insert(request_id);
+        } else {
+            main_request_ids.insert(request_id);
+        }
+    }
+    // requests added at once stay in the same turns, leaving one of the models idle. When no request is left for
+    // the main model, only the first half of the requests is drafted, and the halves alternate afterwards
+    if (main_request_ids.empty() && draft_request_ids.size() > 1) {
+        draft_request_ids.erase(std::next(draft_request_ids.begin(), (draft_request_ids.size() + 1) / 2), draft_request_ids.end());
+    }
+
+    // requests out of a model's turn are paused, so its step skips them
+    auto draft_pause_states = m_draft_pipeline->pause_requests([&draft_request_ids](uint64_t request_id) {
+        return !draft_request_ids.count(request_id);
+    });
+    auto main_pause_states = m_main_pipeline->pause_requests([&main_request_ids](uint64_t request_id) {
+        return !main_request_ids.count(request_id);
+    });
+
+    OverlappedStepResult result;
+    std::future<size_t> draft_future;
+    if (!draft_request_ids.empty()) {
+        draft_future = std::async(std::launch::async, [this, &result]() {
+            const auto draft_start = std::chrono::steady_clock::now();
+            size_t num_steps = m_draft_pipeline->multistep();
+            result.draft_duration = PerfMetrics::get_microsec(std::chrono::steady_clock::now() - draft_start);
+            return num_steps;
+        });
+    }
+    try {
+        if (!main_request_ids.empty()) {
+            const auto main_start = std::chrono::steady_clock::now();
+            m_main_pipeline->step();
+            result.main_duration = PerfMetrics::get_microsec(std::chrono::steady_clock::now() - main_start);
+            result.is_main_step_done = true;
+        }
+    } catch (...) {
+        // the draft model must not outlive the step
+        if (draft_future.valid()) {
+            draft_future.wait();
+        }
+        throw;
+    }
+    if (draft_future.valid()) {
+        result.num_draft_steps = draft_future.get();
+    }
+    ContinuousBatchingForSpeculativeDecodingImpl::restore_pause_states(draft_pause_states);
+    ContinuousBatchingForSpeculativeDecodingImpl::restore_pause_states(main_pause_states);
 
+    // put candidates to model KV cache, they are validated in the next step
+    for (const auto& candidate : m_draft_pipeline->get_generated_requests()) {
+        if (draft_request_ids.count(candidate.first)) {
+            m_candidates_to_validate[candidate.first] = m_main_pipeline->update_request(candidate.first, candidate.second, false);
+            m_draft_turn_requests.erase(candidate.first);
+        }
+    }
+    for (const auto& checked_sequence : m_main_pipeline->get_generated_requests()) {
+        if (!main_request_ids.count(checked_sequence.first)) {
+            continue;
+        }
+        auto update_result = m_draft_pipeline->update_request(checked_sequence.first, checked_sequence.second, true);
+        auto candidates_it = m_candidates_to_validate.find(checked_sequence.first);
+        if (candidates_it != m_candidates_to_validate.end()) {
+            update_sequence_info[checked_sequence.first] = {candidates_it->second.inserted_tokens_cnt, update_result.removed_tokens_cnt};
+            m_candidates_to_validate.erase(candidates_it);
+        }
+        m_draft_turn_requests.insert(checked_sequence.first);
+    }
+    return result;
+}
 
 std::vector<EncodedGenerationResult>
 ContinuousBatchingPipeline::SpeculativeDecodingImpl::generate(const std::vector<ov::Tensor>& input_ids,
@@ -299,6 +424,8 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::get_speculative_decoding_me
 void ContinuousBatchingPipeline::SpeculativeDecodingImpl::drop_requests() {
     m_draft_pipeline->finish_request();
     m_main_pipeline->finish_request();
+    m_draft_turn_requests.clear();
+    m_candidates_to_validate.clear();
 }
 
 
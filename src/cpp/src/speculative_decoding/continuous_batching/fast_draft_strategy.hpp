@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <set>
+
 #include "openvino/genai/continuous_batching_pipeline.hpp"
 #include "continuous_batching/pipeline_impl.hpp"
 #include "openvino/genai/speculative_decoding/perf_metrics.hpp"
@@ -11,6 +13,9 @@
 #include "utils.hpp"
 
 namespace ov::genai {
+// extracts a speculative decoding option, which is not a plugin property, and removes it from properties
+bool extract_speculative_decoding_option(ov::AnyMap& properties, const std::string& name);
+
 struct GenerateStrategy {
     std::function<void(size_t,
                        const ov::Tensor& in_ids,
@@ -153,6 +158,25 @@ protected:
     std::mutex m_draft_generations_mutex;
     std::map<uint64_t, GenerationHandle> m_draft_generations;
 
+    // set by the "adaptive_num_assistant_tokens" property, chooses the number of candidates per request
+    std::shared_ptr<DraftLengthController> m_draft_length_controller;
+    // set by the "speculative_decoding_overlap" property: the draft model generates candidates for some requests
+    // while the main model validates the others, so every request alternates between the draft and the main turns
+    bool m_is_overlap_enabled = false;
+    // requests whose next turn is the draft one, the others are validated or prefilled by the main model next
+    std::set<uint64_t> m_draft_turn_requests;
+    // results of placing the candidates into the main model for requests waiting for validation
+    std::map<uint64_t, UpdateRequestResult> m_candidates_to_validate;
+
+    struct OverlappedStepResult {
+        size_t num_draft_steps = 0;
+        // in microseconds
+        float draft_duration = 0.f, main_duration = 0.f;
+        bool is_main_step_done = false;
+    };
+    // runs the draft and the main models concurrently on the requests of their turns and exchanges the results
+    OverlappedStepResult overlapped_step(std::map<int64_t, UpdateRequestResult>& update_sequence_info);
+
     void drop_requests();
     bool is_requests_empty();
     std::vector<SequenceGroup::Ptr> get_awaiting_requests();
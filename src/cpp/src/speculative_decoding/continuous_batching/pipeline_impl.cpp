@@ -363,7 +363,34 @@ ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::pull_a
     m_awaiting_requests.clear();
 }
 
-void ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::multistep() {
+std::vector<std::pair<SequenceGroup::Ptr, bool>>
+ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::pause_requests(const std::function<bool(uint64_t)>& to_pause) {
+    std::vector<std::pair<SequenceGroup::Ptr, bool>> pause_states;
+    for (auto& request : m_requests) {
+        if (to_pause(request->get_request_id())) {
+            pause_states.emplace_back(request, request->is_generation_paused());
+            request->pause_generation(true);
+        }
+    }
+    return pause_states;
+}
+
+void ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::restore_pause_states(
+    const std::vector<std::pair<SequenceGroup::Ptr, bool>>& pause_states) {
+    for (const auto& [request, is_paused] : pause_states) {
+        request->pause_generation(is_paused);
+    }
+}
+
+size_t ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::get_num_assistant_tokens(const SequenceGroup::CPtr& request) const {
+    const size_t num_assistant_tokens = request->get_sampling_parameters().num_assistant_tokens;
+    if (!m_draft_length_controller) {
+        return num_assistant_tokens;
+    }
+    return m_draft_length_controller->get_num_candidates(request->get_request_id(), num_assistant_tokens);
+}
+
+size_t ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::multistep() {
     bool to_generate = true;
     size_t generated_tokens_cnt = 0;
 
@@ -397,7 +424,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::m
                 request->pause_generation(true);
             } else if (request->get_num_processed_tokens() == 0 && sampling_params.num_return_sequences > 1) {
                 request->pause_generation(true);
-            } else if (sampling_params.num_assistant_tokens <= generated_tokens_cnt && sampling_params.assistant_confidence_threshold == 0.f) {
+            } else if (get_num_assistant_tokens(request) <= generated_tokens_cnt && sampling_params.assistant_confidence_threshold == 0.f) {
                 request->pause_generation(true);
             } else if (request->get_max_new_tokens() == 0) {
                 request->pause_generation(true);
@@ -411,5 +438,6 @@ void ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::m
     }
     if (eagle_mode_enabled)
         m_model_runner->enable_hidden_state_import(true);
+    return generated_tokens_cnt;
 }
 }
@@ -6,6 +6,7 @@
 #include "continuous_batching/pipeline_impl.hpp"
 #include "openvino/genai/continuous_batching_pipeline.hpp"
 #include "update_request_structs.hpp"
+#include "speculative_decoding/draft_length_controller.hpp"
 
 namespace ov::genai {
 class ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl : public ContinuousBatchingPipeline::ContinuousBatchingImpl {
@@ -22,7 +23,8 @@ public:
                                                  const ov::AnyMap& plugin_config,
                                                  bool is_validation_mode_enabled);
 
-    void multistep();
+    // returns the number of performed steps
+    size_t multistep();
 
     void finish_request(int64_t request_id = -1);
     void pull_awaiting_requests(bool is_pause_request = false);
@@ -34,10 +36,27 @@ public:
 
     UpdateRequestResult init_request_by_candidate(uint64_t request_id, const GeneratedSequences& candidates);
 
+    /**
+     * @brief Sets the controller choosing the number of candidates per request in `multistep` instead of `num_assistant_tokens`.
+     */
+    void set_draft_length_controller(std::shared_ptr<DraftLengthController> draft_length_controller) {
+        m_draft_length_controller = std::move(draft_length_controller);
+    }
+
+    /**
+     * @brief Pauses generation of the requests for which `to_pause` returns true, so the next step skips them.
+     * @return The paused requests with their previous pause states to be passed to `restore_pause_states` after the step.
+     */
+    std::vector<std::pair<SequenceGroup::Ptr, bool>> pause_requests(const std::function<bool(uint64_t)>& to_pause);
+    static void restore_pause_states(const std::vector<std::pair<SequenceGroup::Ptr, bool>>& pause_states);
+
     RawPerfMetrics raw_perf_metrics;
 
 protected:
     void finish_request(SequenceGroup::Ptr request);
+    size_t get_num_assistant_tokens(const SequenceGroup::CPtr& request) const;
+
+    std::shared_ptr<DraftLengthController> m_draft_length_controller;
     void _pull_awaiting_requests() override {};
     bool eagle_mode_enabled = false;
 };
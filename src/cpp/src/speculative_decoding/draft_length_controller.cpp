@@ -0,0 +1,79 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "speculative_decoding/draft_length_controller.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "openvino/core/except.hpp"
+
+namespace ov::genai {
+
+DraftLengthController::DraftLengthController(float decay) : m_decay(decay) {
+    OPENVINO_ASSERT(decay >= 0.f && decay < 1.f, "Decay of the draft length statistics must be in [0, 1), got ", decay);
+}
+
+void DraftLengthController::update_acceptance(uint64_t request_id, size_t num_candidates, size_t num_accepted) {
+    if (num_candidates == 0) {
+        return;
+    }
+    OPENVINO_ASSERT(num_accepted <= num_candidates, "Number of accepted candidates cannot exceed the number of candidates");
+    AcceptanceStatistics& statistics = m_statistics[request_id];
+    statistics.num_accepted = m_decay * statistics.num_accepted + num_accepted;
+    // the candidates after the first rejected one are not checked, so a validation is a truncated geometric trial
+    statistics.num_rejected = m_decay * statistics.num_rejected + (num_accepted < num_candidates ? 1.f : 0.f);
+}
+
+void DraftLengthController::update_cost_ratio(float draft_forward_duration, float main_forward_duration) {
+    if (draft_forward_duration <= 0.f || main_forward_duration <= 0.f) {
+        return;
+    }
+    const float cost_ratio = draft_forward_duration / main_forward_duration;
+    m_cost_ratio = m_cost_ratio < 0.f ? cost_ratio : m_decay * m_cost_ratio + (1.f - m_decay) * cost_ratio;
+}
+
+float DraftLengthController::get_acceptance_probability(uint64_t request_id) const {
+    auto it = m_statistics.find(request_id);
+    if (it == m_statistics.end()) {
+        return -1.f;
+    }
+    const AcceptanceStatistics& statistics = it->second;
+    // maximum likelihood estimation for the truncated geometric trials
+    return statistics.num_accepted / (statistics.num_accepted + statistics.num_rejected);
+}
+
+size_t DraftLengthController::get_num_candidates(uint64_t request_id, size_t num_assistant_tokens) const {
+    const float acceptance_probability = get_acceptance_probability(request_id);
+    if (acceptance_probability < 0.f || m_cost_ratio < 0.f || num_assistant_tokens == 0) {
+        return num_assistant_tokens;
+    }
+    return get_optimal_num_candidates(acceptance_probability, m_cost_ratio, num_assistant_tokens * MAX_NUM_CANDIDATES_FACTOR);
+}
+
+void DraftLengthController::remove_request(uint64_t request_id) {
+    m_statistics.erase(request_id);
+}
+
+size_t DraftLengthController::get_optimal_num_candidates(float acceptance_probability, float cost_ratio, size_t max_num_candidates) {
+    acceptance_probability = std::clamp(acceptance_probability, 0.f, 1.f);
+    size_t best_num_candidates = 1;
+    float best_rate = 0.f;
+    // alpha^(k + 1), updated incrementally
+    float acceptance_power = acceptance_probability;
+    for (size_t num_candidates = 1; num_candidates <= std::max<size_t>(max_num_candidates, 1); ++num_candidates) {
+        acceptance_power *= acceptance_probability;
+        // expected number of tokens per validation: accepted candidates and the token generated by the main model
+        const float expected_num_tokens = acceptance_probability == 1.f
+            ? static_cast<float>(num_candidates + 1)
+            : (1.f - acceptance_power) / (1.f - acceptance_probability);
+        const float rate = expected_num_tokens / (cost_ratio * num_candidates + 1.f);
+        if (rate > best_rate) {
+            best_rate = rate;
+            best_num_candidates = num_candidates;
+        }
+    }
+    return best_num_candidates;
+}
+
+}  // namespace ov::genai
@@ -0,0 +1,70 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+
+namespace ov::genai {
+
+/**
+ * @brief Chooses the number of candidates the draft model generates for every request in speculative decoding.
+ * Candidates are modelled as accepted independently with a per-request probability `alpha`, estimated from the
+ * observed accepted candidates and rejections with exponential decay, so the estimate follows changes of the text.
+ * With `c` being the ratio of a draft forward duration to a main forward duration, k candidates yield
+ * (1 - alpha^(k + 1)) / (1 - alpha) tokens per (c * k + 1) units of time, and the k maximizing this rate is chosen.
+ */
+class DraftLengthController {
+public:
+    // the number of candidates is limited by this factor of the configured `num_assistant_tokens`
+    static constexpr size_t MAX_NUM_CANDIDATES_FACTOR = 2;
+
+    /**
+     * @param decay Weight of the previous statistics when a new observation is added, in [0, 1).
+     */
+    explicit DraftLengthController(float decay = 0.8f);
+
+    /**
+     * @brief Registers the result of a validation of `num_candidates` candidates, `num_accepted` of which matched the main model.
+     */
+    void update_acceptance(uint64_t request_id, size_t num_candidates, size_t num_accepted);
+
+    /**
+     * @brief Registers the duration of a draft model forward and a main model forward of the same step.
+     */
+    void update_cost_ratio(float draft_forward_duration, float main_forward_duration);
+
+    /**
+     * @return The number of candidates to generate for the request. `num_assistant_tokens` is returned until
+     * both the acceptance of the request and the cost ratio are observed.
+     */
+    size_t get_num_candidates(uint64_t request_id, size_t num_assistant_tokens) const;
+
+    /**
+     * @return The estimated probability of a candidate of the request to be accepted, or a negative value if unknown.
+     */
+    float get_acceptance_probability(uint64_t request_id) const;
+
+    void remove_request(uint64_t request_id);
+
+    /**
+     * @return The number of candidates in [1, max_num_candidates] maximizing the expected number of tokens per unit of time.
+     */
+    static size_t get_optimal_num_candidates(float acceptance_probability, float cost_ratio, size_t max_num_candidates);
+
+private:
+    struct AcceptanceStatistics {
+        // decayed sums of accepted candidates and of rejections
+        float num_accepted = 0.f;
+        float num_rejected = 0.f;
+    };
+
+    float m_decay;
+    // negative until the first observation
+    float m_cost_ratio = -1.f;
+    std::map<uint64_t, AcceptanceStatistics> m_statistics;
+};
+
+}  // namespace ov::genai
@@ -4,14 +4,36 @@
 #include "openvino/genai/text_streamer.hpp"
 
 namespace {
-bool is_incomplete(std::string& text) {
+bool is_incomplete(const std::string& text) {
     // MSVC with /utf-8 fails to compile � directly with newline in string literal error.
     constexpr char replacement[] = "\xef\xbf\xbd";
     return text.size() >= 3 && text.compare(text.size() - 3, 3, replacement) == 0;
 }
 
+bool ends_with_partial_code_point(const std::string& text) {
+    // finds the lead byte of the last UTF-8 sequence and checks that all its continuation bytes are present
+    size_t num_continuation_bytes = 0;
+    for (auto it = text.rbegin(); it != text.rend() && num_continuation_bytes < 4; ++it) {
+        const auto byte = static_cast<unsigned char>(*it);
+        if ((byte & 0xC0) != 0x80) {
+            const size_t sequence_len = byte < 0x80 ? 1 : byte >= 0xF0 ? 4 : byte >= 0xE0 ? 3 : 2;
+            return num_continuation_bytes + 1 < sequence_len;
+        }
+        ++num_continuation_bytes;
+    }
+    return num_continuation_bytes > 0;
+}
+
 constexpr size_t delay_n_tokens = 3;
 
+// Number of already decoded tokens re-decoded together with the new ones. They provide the context
+// for tokenizers which handle the first token of a sequence differently (e.g. strip the leading space).
+constexpr size_t prefix_n_tokens = delay_n_tokens;
+
+// The window decoded for a new token is reused as the prefix window for the next one, until it grows above this size
+// and is shrunk back to prefix_n_tokens
+constexpr size_t max_window_n_tokens = 16;
+
 }  // namespace
 
 namespace ov {
@@ -28,7 +50,7 @@ TextStreamer::TextStreamer(const Tokenizer& tokenizer,
 StreamingStatus TextStreamer::write(int64_t token) {
     std::stringstream res;
     m_tokens_cache.push_back(token);
-    std::string text = m_tokenizer.decode(m_tokens_cache, m_additional_detokenization_params);
+    std::string text = decode_cache(m_tokens_cache.size());
     m_decoded_lengths.push_back(text.length());
 
     if (!text.empty() && '\n' == text.back() && text.size() > m_printed_len) {
@@ -36,9 +58,7 @@ StreamingStatus TextStreamer::write(int64_t token) {
         res << std::string_view{text.data() + m_printed_len, text.size() - m_printed_len};
 
         auto res_status = run_callback_if_needed(res.str());
-        m_tokens_cache.clear();
-        m_decoded_lengths.clear();
-        m_printed_len = 0;
+        reset_cache();
         return res_status;
     }
 
@@ -52,10 +72,12 @@ StreamingStatus TextStreamer::write(int64_t token) {
     // e.g. when apostrophe removing regex had worked after adding new tokens.
     // Printing several last tokens is delayed.
     if (m_decoded_lengths.size() < delay_n_tokens) {
+        update_decoded_prefix(text);
         return run_callback_if_needed(res.str());
     }
 
     compute_decoded_length_for_position(m_decoded_lengths.size() - delay_n_tokens);
+    update_decoded_prefix(text);
 
     auto print_until = m_decoded_lengths[m_decoded_lengths.size() - delay_n_tokens];
 
@@ -79,8 +101,7 @@ void TextStreamer::compute_decoded_length_for_position(size_t cache_position) {
         return;
     }
 
-    auto cache_for_position = std::vector(m_tokens_cache.begin(), m_tokens_cache.begin() + cache_position + 1);
-    std::string text_for_position = m_tokenizer.decode(cache_for_position, m_additional_detokenization_params);
+    std::string text_for_position = decode_cache(cache_position + 1);
 
     if (is_incomplete(text_for_position)) {
         m_decoded_lengths[cache_position] = -1;
@@ -89,6 +110,65 @@ void TextStreamer::compute_decoded_length_for_position(size_t cache_position) {
     }
 };
 
+std::string TextStreamer::decode_cache(size_t cache_end) {
+    if (cache_end > m_read_offset) {
+        // Decode only the new tokens together with a few already decoded ones
+        std::vector<int64_t> window(m_tokens_cache.begin() + m_prefix_offset, m_tokens_cache.begin() + cache_end);
+        std::string window_text = m_tokenizer.decode(window, m_additional_detokenization_params);
+        // The new tokens must not change the text decoded for the prefix window, e.g. by cleanup regexes.
+        // Otherwise the window is not enough to detokenize them and the whole cache is decoded.
+        if (window_text.compare(0, m_prefix_text.size(), m_prefix_text) == 0) {
+            std::string text = m_text;
+            text.append(window_text, m_prefix_text.size());
+            if (cache_end == m_tokens_cache.size()) {
+                m_window_text = std::move(window_text);
+                m_window_end = cache_end;
+            }
+            return text;
+        }
+    }
+    auto cache = std::vector(m_tokens_cache.begin(), m_tokens_cache.begin() + cache_end);
+    return m_tokenizer.decode(cache, m_additional_detokenization_params);
+}
+
+void TextStreamer::update_decoded_prefix(const std::string& text) {
+    // The next tokens may complete the last character differently, so such text is not cached,
+    // and the next tokens are decoded together with the current ones
+    if (is_incomplete(text) || ends_with_partial_code_point(text)) {
+        return;
+    }
+
+    const size_t cache_size = m_tokens_cache.size();
+    if (m_window_end == cache_size && cache_size - m_prefix_offset <= max_window_n_tokens) {
+        // the window is already decoded for the last token
+        m_prefix_text = std::move(m_window_text);
+    } else {
+        m_prefix_offset = cache_size > prefix_n_tokens ? cache_size - prefix_n_tokens : 0;
+        if (m_prefix_offset == 0) {
+            m_prefix_text = text;
+        } else {
+            std::vector<int64_t> prefix(m_tokens_cache.begin() + m_prefix_offset, m_tokens_cache.end());
+            m_prefix_text = m_tokenizer.decode(prefix, m_additional_detokenization_params);
+        }
+    }
+    m_text = text;
+    m_read_offset = cache_size;
+    m_window_text.clear();
+    m_window_end = 0;
+}
+
+void TextStreamer::reset_cache() {
+    m_tokens_cache.clear();
+    m_decoded_lengths.clear();
+    m_printed_len = 0;
+    m_text.clear();
+    m_prefix_text.clear();
+    m_window_text.clear();
+    m_prefix_offset = 0;
+    m_read_offset = 0;
+    m_window_end = 0;
+}
+
 StreamingStatus TextStreamer::write(const std::vector<int64_t>& tokens) {
     if (tokens.empty()) {
         return StreamingStatus::RUNNING;
@@ -124,9 +204,7 @@ void TextStreamer::end() {
     if (text.size() <= m_printed_len)
         return;
     res << std::string_view{text.data() + m_printed_len, text.size() - m_printed_len} << std::flush;
-    m_tokens_cache.clear();
-    m_decoded_lengths.clear();
-    m_printed_len = 0;
+    reset_cache();
     m_subword_callback(res.str());
     return;
 }
@@ -0,0 +1,120 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tokenizer/chat_history_encoder.hpp"
+
+#include <algorithm>
+
+#include "openvino/core/except.hpp"
+#include "utils.hpp"
+
+namespace ov::genai {
+
+void ChatHistoryEncoder::set_incremental(bool is_incremental) {
+    m_is_incremental = is_incremental;
+    reset();
+}
+
+bool ChatHistoryEncoder::is_incremental() const {
+    return m_is_incremental;
+}
+
+TokenizedInputs ChatHistoryEncoder::encode(Tokenizer& tokenizer, const ChatHistory& history, bool add_generation_prompt) {
+    std::string templated_history = tokenizer.apply_chat_template(history, add_generation_prompt);
+    if (!m_is_incremental) {
+        return tokenizer.encode(templated_history, ov::genai::add_special_tokens(false));
+    }
+
+    const bool is_prefix_kept = m_resume_num_tokens > 0 &&
+        templated_history.compare(0, m_resume_num_chars, m_templated_history, 0, m_resume_num_chars) == 0;
+    if (is_prefix_kept) {
+        m_token_ids.resize(m_resume_num_tokens);
+        m_num_reused_tokens = m_resume_num_tokens;
+        if (templated_history.size() > m_resume_num_chars) {
+            ov::Tensor suffix_ids = tokenizer.encode(templated_history.substr(m_resume_num_chars), ov::genai::add_special_tokens(false)).input_ids;
+            const int64_t* suffix_data = suffix_ids.data<int64_t>();
+            m_token_ids.insert(m_token_ids.end(), suffix_data, suffix_data + suffix_ids.get_size());
+        }
+    } else {
+        ov::Tensor input_ids = tokenizer.encode(templated_history, ov::genai::add_special_tokens(false)).input_ids;
+        const int64_t* data = input_ids.data<int64_t>();
+        m_token_ids.assign(data, data + input_ids.get_size());
+        m_num_reused_tokens = 0;
+    }
+    m_templated_history = std::move(templated_history);
+    update_resume_position(tokenizer);
+
+    ov::Tensor input_ids(ov::element::i64, {1, m_token_ids.size()});
+    std::copy(m_token_ids.begin(), m_token_ids.end(), input_ids.data<int64_t>());
+    return {input_ids, ov::genai::utils::init_attention_mask(input_ids)};
+}
+
+size_t ChatHistoryEncoder::get_num_reused_tokens() const {
+    return m_num_reused_tokens;
+}
+
+void ChatHistoryEncoder::reset() {
+    m_templated_history.clear();
+    m_token_ids.clear();
+    m_resume_num_tokens = 0;
+    m_resume_num_chars = 0;
+    m_num_reused_tokens = 0;
+}
+
+void ChatHistoryEncoder::update_resume_position(Tokenizer& tokenizer) {
+    m_resume_num_tokens = 0;
+    m_resume_num_chars = 0;
+    const size_t search_length = std::min(m_token_ids.size(), MAX_RESUME_SEARCH_LENGTH);
+    if (search_length == 0) {
+        return;
+    }
+
+    // every token of the tail is decoded separately, special tokens are decoded to empty strings when skipped
+    const size_t search_begin = m_token_ids.size() - search_length;
+    ov::Tensor tail(ov::element::i64, {search_length, 1}, m_token_ids.data() + search_begin);
+    const std::vector<std::string> tail_texts = tokenizer.decode(tail, ov::genai::skip_special_tokens(true));
+    for (size_t tail_idx = search_length; tail_idx-- > 0;) {
+        const size_t token_position = search_begin + tail_idx;
+        // the first token can't be a resume position, since nothing would be reused
+        if (!tail_texts[tail_idx].empty() || token_position == 0) {
+            continue;
+        }
+        const std::string token_text = tokenizer.decode(std::vector<int64_t>{m_token_ids[token_position]}, ov::genai::skip_special_tokens(false));
+        if (token_text.empty()) {
+            continue;
+        }
+        const size_t num_chars = find_special_token_offset(m_templated_history, m_token_ids, token_position, token_text);
+        if (num_chars != std::string::npos) {
+            m_resume_num_tokens = token_position;
+            m_resume_num_chars = num_chars;
+        }
+        return;
+    }
+}
+
+size_t ChatHistoryEncoder::find_special_token_offset(const std::string& text,
+                                                     const std::vector<int64_t>& token_ids,
+                                                     size_t token_position,
+                                                     const std::string& token_text) {
+    OPENVINO_ASSERT(token_position < token_ids.size(), "Token position ", token_position, " is out of ", token_ids.size(), " token ids");
+    if (token_text.empty()) {
+        return std::string::npos;
+    }
+    const int64_t token_id = token_ids[token_position];
+    const size_t num_token_ids = std::count(token_ids.begin(), token_ids.end(), token_id);
+    const size_t occurrence_idx = std::count(token_ids.begin(), token_ids.begin() + token_position, token_id);
+
+    // the occurrences of the text and of the id must correspond to each other one to one,
+    // otherwise the text of the special token also appears inside of other tokens
+    size_t num_text_occurrences = 0;
+    size_t offset = std::string::npos;
+    for (size_t position = text.find(token_text); position != std::string::npos; position = text.find(token_text, position + token_text.size())) {
+        if (num_text_occurrences == occurrence_idx) {
+            offset = position;
+        }
+        ++num_text_occurrences;
+    }
+    return num_text_occurrences == num_token_ids ? offset : std::string::npos;
+}
+
+}  // namespace ov::genai
@@ -0,0 +1,68 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "openvino/genai/tokenizer.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Applies the chat template to a chat history and tokenizes the result for chat scenarios.
+ * In incremental mode the token ids of the previous call are remembered, and only the text starting from the last
+ * special token of the previous call is tokenized again if the templated history still starts with the same text.
+ * Special tokens are split from the text before tokenization, so the text before a special token is tokenized
+ * independently of the text after it. If the prefix changes, e.g. because the template rewrites earlier turns,
+ * the full templated history is tokenized.
+ */
+class ChatHistoryEncoder {
+public:
+    // the number of the last tokens of the previous call searched for a special token to resume tokenization from
+    static constexpr size_t MAX_RESUME_SEARCH_LENGTH = 64;
+
+    void set_incremental(bool is_incremental);
+
+    bool is_incremental() const;
+
+    /**
+     * @return Token ids of the templated history, encoded without adding special tokens.
+     */
+    TokenizedInputs encode(Tokenizer& tokenizer, const ChatHistory& history, bool add_generation_prompt);
+
+    /**
+     * @return The number of token ids of the last encode() call reused from the previous call.
+     */
+    size_t get_num_reused_tokens() const;
+
+    void reset();
+
+    /**
+     * @brief Finds the position of a special token in the text the token ids were produced from.
+     * @param text Text the token ids were produced from.
+     * @param token_ids Token ids of the text.
+     * @param token_position Position of the special token in the token ids.
+     * @param token_text Text of the special token.
+     * @return The number of characters before the special token, or std::string::npos if the occurrences of the
+     * token text in the text do not match the occurrences of the token id.
+     */
+    static size_t find_special_token_offset(const std::string& text,
+                                            const std::vector<int64_t>& token_ids,
+                                            size_t token_position,
+                                            const std::string& token_text);
+
+private:
+    void update_resume_position(Tokenizer& tokenizer);
+
+    bool m_is_incremental = false;
+    std::string m_templated_history;
+    std::vector<int64_t> m_token_ids;
+    // tokenization is resumed from this special token of the previous call
+    size_t m_resume_num_tokens = 0;
+    size_t m_resume_num_chars = 0;
+    size_t m_num_reused_tokens = 0;
+};
+
+}  // namespace ov::genai
@@ -0,0 +1,88 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tokenizer/encode_cache.hpp"
+
+namespace ov::genai {
+
+namespace {
+
+ov::Tensor copy_tensor(const ov::Tensor& tensor) {
+    ov::Tensor copy(tensor.get_element_type(), tensor.get_shape());
+    tensor.copy_to(copy);
+    return copy;
+}
+
+TokenizedInputs copy_inputs(const TokenizedInputs& inputs) {
+    TokenizedInputs copy{copy_tensor(inputs.input_ids), copy_tensor(inputs.attention_mask), std::nullopt};
+    if (inputs.token_type_ids.has_value()) {
+        copy.token_type_ids = copy_tensor(*inputs.token_type_ids);
+    }
+    return copy;
+}
+
+size_t get_size_in_bytes(const std::string& key, const TokenizedInputs& inputs) {
+    size_t size_in_bytes = key.size() + inputs.input_ids.get_byte_size() + inputs.attention_mask.get_byte_size();
+    if (inputs.token_type_ids.has_value()) {
+        size_in_bytes += inputs.token_type_ids->get_byte_size();
+    }
+    return size_in_bytes;
+}
+
+}  // namespace
+
+EncodeCache::EncodeCache(size_t max_size_in_bytes) : m_max_size_in_bytes(max_size_in_bytes) {}
+
+std::optional<TokenizedInputs> EncodeCache::get(const std::string& key) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_index.find(key);
+    if (it == m_index.end()) {
+        return std::nullopt;
+    }
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    return copy_inputs(it->second->inputs);
+}
+
+void EncodeCache::put(const std::string& key, const TokenizedInputs& inputs) {
+    const size_t size_in_bytes = get_size_in_bytes(key, inputs);
+    if (size_in_bytes > m_max_size_in_bytes) {
+        return;
+    }
+    TokenizedInputs inputs_copy = copy_inputs(inputs);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_index.find(key);
+    if (it != m_index.end()) {
+        // the same prompt may be encoded by several threads at once, the results are the same
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return;
+    }
+    while (m_size_in_bytes + size_in_bytes > m_max_size_in_bytes) {
+        const Entry& least_recently_used = m_entries.back();
+        m_size_in_bytes -= least_recently_used.size_in_bytes;
+        m_index.erase(least_recently_used.key);
+        m_entries.pop_back();
+    }
+    m_entries.push_front({key, std::move(inputs_copy), size_in_bytes});
+    m_index.emplace(m_entries.front().key, m_entries.begin());
+    m_size_in_bytes += size_in_bytes;
+}
+
+size_t EncodeCache::size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+size_t EncodeCache::get_size_in_bytes() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_size_in_bytes;
+}
+
+void EncodeCache::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_index.clear();
+    m_entries.clear();
+    m_size_in_bytes = 0;
+}
+
+}  // namespace ov::genai
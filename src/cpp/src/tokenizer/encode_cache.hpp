@@ -0,0 +1,62 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "openvino/genai/tokenizer.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Least recently used cache of encoded prompts, limited by the total size of the keys and the tensors in bytes.
+ * Keys are expected to contain both the prompt and the tokenization parameters it was encoded with.
+ * Tensors are copied in and out, so neither the cached results nor the returned ones can be modified by the other side.
+ * The cache can be shared by several threads.
+ */
+class EncodeCache {
+public:
+    /**
+     * @param max_size_in_bytes Maximum total size of the cached entries, an entry larger than it is not cached.
+     */
+    explicit EncodeCache(size_t max_size_in_bytes);
+
+    /**
+     * @return A copy of the cached result for the key, or nullopt if it is not cached. A hit makes the entry the most recently used one.
+     */
+    std::optional<TokenizedInputs> get(const std::string& key);
+
+    /**
+     * @brief Caches a copy of the result for the key, evicting the least recently used entries to fit into the size limit.
+     */
+    void put(const std::string& key, const TokenizedInputs& inputs);
+
+    size_t size() const;
+
+    size_t get_size_in_bytes() const;
+
+    void clear();
+
+private:
+    struct Entry {
+        std::string key;
+        TokenizedInputs inputs;
+        size_t size_in_bytes;
+    };
+
+    size_t m_max_size_in_bytes;
+    size_t m_size_in_bytes = 0;
+    // the most recently used entries are at the front
+    std::list<Entry> m_entries;
+    // keys are views of the keys stored in the entries
+    std::unordered_map<std::string_view, std::list<Entry>::iterator> m_index;
+    mutable std::mutex m_mutex;
+};
+
+}  // namespace ov::genai
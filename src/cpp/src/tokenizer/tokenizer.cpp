@@ -84,6 +84,14 @@ TokenizedInputs Tokenizer::encode(const std::vector<std::string>& prompts, const
     return m_pimpl->encode(prompts, tokenization_params);
 }
 
+std::vector<TokenizedInputs> Tokenizer::encode_parallel(const std::vector<std::string>& prompts, const ov::AnyMap& tokenization_params) {
+    check_arguments(tokenization_params, {ov::genai::add_special_tokens.name(),
+                                          ov::genai::max_length.name(),
+                                          ov::genai::pad_to_max_length.name(),
+                                          ov::genai::padding_side.name()});
+    return m_pimpl->encode_parallel(prompts, tokenization_params);
+}
+
 TokenizedInputs Tokenizer::encode(const std::initializer_list<std::string>& text, const ov::AnyMap& tokenization_params) {
     check_arguments(tokenization_params, {ov::genai::add_special_tokens.name(),
                                           ov::genai::max_length.name(),
@@ -3,6 +3,7 @@
 
 #include "tokenizer/tokenizer_impl.hpp"
 
+#include <condition_variable>
 #include <utility>
 
 #include "add_second_input_pass.hpp"
@@ -181,6 +182,10 @@ void Tokenizer::TokenizerImpl::set_state_value(ov::VariableState& state, std::op
 }
 
 void Tokenizer::TokenizerImpl::set_state_if_necessary(CircularBufferQueueElementGuard<ov::InferRequest>& infer_request_guard, const ov::AnyMap& params) {
+    set_state_if_necessary(infer_request_guard.get(), params);
+}
+
+void Tokenizer::TokenizerImpl::set_state_if_necessary(ov::InferRequest& infer_request, const ov::AnyMap& params) {
     if (m_older_than_24_5) {
         // Changing add_special_tokens at runtime was introduced in
         // 24.5. Older tokenizers still allow manipulating their
@@ -215,9 +220,9 @@ void Tokenizer::TokenizerImpl::set_state_if_necessary(CircularBufferQueueElement
 
     std::optional<bool> is_max_length_set_val = max_length_val.has_value();
 
-    ov::AnyMap& state_flags = m_request_to_state_flags[&infer_request_guard.get()];
+    ov::AnyMap& state_flags = m_request_to_state_flags[&infer_request];
 
-    for (auto& state : infer_request_guard.get().query_state()) {
+    for (auto& state : infer_request.query_state()) {
         auto name = state.get_name();
 
         if (name == add_special_tokens.name()) {
@@ -244,6 +249,30 @@ Tokenizer::TokenizerImpl::TokenizerImpl(const std::pair<std::shared_ptr<ov::Mode
     setup_tokenizer(models, properties);
 }
 
+// the key holds the effective tokenization parameters, so omitted parameters share the entries with their default values
+std::string get_encode_cache_key(const std::string& prompt, const ov::AnyMap& tokenization_params) {
+    // These values should be equal to the default values in set_state_if_necessary
+    bool add_special_tokens_flag = true;
+    bool pad_to_max_length_flag = false;
+    std::optional<int32_t> max_length_val;
+    std::optional<std::string> padding_side_val;
+    ov::genai::utils::read_anymap_param(tokenization_params, add_special_tokens.name(), add_special_tokens_flag);
+    ov::genai::utils::read_anymap_param(tokenization_params, pad_to_max_length.name(), pad_to_max_length_flag);
+    ov::genai::utils::read_anymap_param(tokenization_params, max_length.name(), max_length_val);
+    ov::genai::utils::read_anymap_param(tokenization_params, padding_side.name(), padding_side_val);
+
+    std::string key;
+    key.reserve(prompt.size() + 32);
+    key += add_special_tokens_flag ? '1' : '0';
+    key += pad_to_max_length_flag ? '1' : '0';
+    key += max_length_val.has_value() ? std::to_string(*max_length_val) : std::string("-");
+    key += padding_side_val.value_or("-");
+    // the prompt is separated by a character which cannot appear in the parameters
+    key += '\n';
+    key += prompt;
+    return key;
+}
+
 void filter_properties(ov::AnyMap& properties) {
     // Properties allowed for tokenizer/detokenizer on CPU
     std::set<std::string> allowed_argnames = {
@@ -364,6 +393,13 @@ void Tokenizer::TokenizerImpl::setup_tokenizer(const std::pair<std::shared_ptr<o
         properties.erase(it);
     }
 
+    auto encode_cache_size_it = properties.find(ov::genai::encode_cache_size.name());
+    if (encode_cache_size_it != properties.end()) {
+        const size_t encode_cache_size_in_bytes = encode_cache_size_it->second.as<size_t>();
+        m_encode_cache = encode_cache_size_in_bytes > 0 ? std::make_unique<EncodeCache>(encode_cache_size_in_bytes) : nullptr;
+        properties.erase(encode_cache_size_it);
+    }
+
     // Filter properties by leaving only params from the allowlist
     filter_properties(properties);
     
@@ -625,6 +661,14 @@ TokenizedInputs Tokenizer::TokenizerImpl::encode(const std::string& prompt, cons
     OPENVINO_ASSERT(m_ireq_queue_tokenizer, "Either openvino_tokenizer.xml was not provided or it was not loaded correctly. "
                                             "Tokenizer::encode is not available");
 
+    std::string cache_key;
+    if (m_encode_cache) {
+        cache_key = get_encode_cache_key(prompt, tokenization_params);
+        if (auto cached_inputs = m_encode_cache->get(cache_key)) {
+            return std::move(*cached_inputs);
+        }
+    }
+
     CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(m_ireq_queue_tokenizer.get());
     set_state_if_necessary(infer_request_guard, tokenization_params);
     size_t batch_size = 1;
@@ -641,10 +685,14 @@ TokenizedInputs Tokenizer::TokenizerImpl::encode(const std::string& prompt, cons
 
     infer_request_guard.get().infer();
 
-    return get_copied_results(
+    TokenizedInputs result = get_copied_results(
         infer_request_guard.get().get_tensor("input_ids"),
         infer_request_guard.get().get_tensor("attention_mask")
     );
+    if (m_encode_cache) {
+        m_encode_cache->put(cache_key, result);
+    }
+    return result;
 }
 
 TokenizedInputs Tokenizer::TokenizerImpl::encode(const std::vector<std::pair<std::string, std::string>>& prompts_pairs, const ov::AnyMap& tokenization_params) {
@@ -725,6 +773,115 @@ TokenizedInputs Tokenizer::TokenizerImpl::encode(const std::vector<std::string>&
     return {unpadded.input_ids, unpadded.attention_mask};
 }
 
+std::vector<TokenizedInputs> Tokenizer::TokenizerImpl::encode_parallel(const std::vector<std::string>& prompts, const ov::AnyMap& tokenization_params) {
+    OPENVINO_ASSERT(m_ireq_queue_tokenizer, "Either openvino_tokenizer.xml was not provided or it was not loaded correctly. "
+                                            "Tokenizer::encode is not available");
+
+    // shared with the callbacks, which may still be running when a waiting thread is woken up
+    struct EncodeContext {
+        std::vector<TokenizedInputs> results;
+        size_t num_pending = 0;
+        std::exception_ptr error = nullptr;
+        std::mutex mutex;
+        std::condition_variable finished;
+    };
+    auto context = std::make_shared<EncodeContext>();
+    context->results.resize(prompts.size());
+
+    std::vector<std::string> cache_keys(m_encode_cache ? prompts.size() : 0);
+    std::vector<size_t> prompts_to_encode;
+    for (size_t prompt_idx = 0; prompt_idx < prompts.size(); ++prompt_idx) {
+        if (m_encode_cache) {
+            cache_keys[prompt_idx] = get_encode_cache_key(prompts[prompt_idx], tokenization_params);
+            if (auto cached_inputs = m_encode_cache->get(cache_keys[prompt_idx])) {
+                context->results[prompt_idx] = std::move(*cached_inputs);
+                continue;
+            }
+        }
+        prompts_to_encode.push_back(prompt_idx);
+    }
+
+    // every prompt takes the next idle infer request, so the prompts are encoded by all the requests of the queue at once
+    for (size_t prompt_idx : prompts_to_encode) {
+        const int request_idx = m_ireq_queue_tokenizer->get_idle().get();
+        ov::InferRequest& infer_request = m_ireq_queue_tokenizer->get(request_idx);
+        bool is_pending = false;
+        try {
+            set_state_if_necessary(infer_request, tokenization_params);
+            // The use of const_cast here is necessary because the ov::Tensor API does not accept const data pointers.
+            infer_request.set_input_tensor(0, ov::Tensor{ov::element::string, {1}, const_cast<std::string*>(&prompts[prompt_idx])});
+            if (infer_request.get_compiled_model().inputs().size() > 1) {
+                // Set the second input tensor to an empty tensor to avoid errors.
+                infer_request.set_input_tensor(1, ov::Tensor{ov::element::string, {0}});
+            }
+            infer_request.set_callback([this, context, request_idx, prompt_idx](std::exception_ptr exception) {
+                // resetting the callback destroys this lambda, so only the local copies are used after it
+                auto local_context = context;
+                auto queue = m_ireq_queue_tokenizer.get();
+                const int local_request_idx = request_idx;
+                const size_t result_idx = prompt_idx;
+                ov::InferRequest& finished_request = queue->get(local_request_idx);
+                TokenizedInputs result;
+                if (!exception) {
+                    try {
+                        result = get_copied_results(finished_request.get_tensor("input_ids"), finished_request.get_tensor("attention_mask"));
+                    } catch (...) {
+                        exception = std::current_exception();
+                    }
+                }
+                {
+                    std::lock_guard<std::mutex> lock(local_context->mutex);
+                    if (exception) {
+                        local_context->error = local_context->error ? local_context->error : exception;
+                    } else {
+                        local_context->results[result_idx] = std::move(result);
+                    }
+                }
+
+                // the request may be taken by another prompt as soon as it is returned to the queue,
+                // so it is returned only when it is not used anymore
+                finished_request.set_callback({});
+                queue->return_to(local_request_idx);
+
+                // the waiting thread may release the tokenizer once the last request is finished
+                std::lock_guard<std::mutex> lock(local_context->mutex);
+                --local_context->num_pending;
+                local_context->finished.notify_all();
+            });
+            {
+                std::lock_guard<std::mutex> lock(context->mutex);
+                ++context->num_pending;
+            }
+            is_pending = true;
+            infer_request.start_async();
+        } catch (...) {
+            // the callback is not called for a request which failed to start
+            infer_request.set_callback({});
+            m_ireq_queue_tokenizer->return_to(request_idx);
+            std::lock_guard<std::mutex> lock(context->mutex);
+            if (is_pending) {
+                --context->num_pending;
+            }
+            context->error = context->error ? context->error : std::current_exception();
+            break;
+        }
+    }
+
+    std::unique_lock<std::mutex> lock(context->mutex);
+    context->finished.wait(lock, [&context] {
+        return context->num_pending == 0;
+    });
+    if (context->error) {
+        std::rethrow_exception(context->error);
+    }
+    if (m_encode_cache) {
+        for (size_t prompt_idx : prompts_to_encode) {
+            m_encode_cache->put(cache_keys[prompt_idx], context->results[prompt_idx]);
+        }
+    }
+    return std::move(context->results);
+}
+
 TokenizedInputs Tokenizer::TokenizerImpl::get_copied_results(ov::Tensor input_ids, ov::Tensor attention_mask) {
     ov::Tensor input_ids_ = ov::Tensor(input_ids.get_element_type(), input_ids.get_shape());
     ov::Tensor attention_mask_ = ov::Tensor(attention_mask.get_element_type(), attention_mask.get_shape());
@@ -808,8 +965,8 @@ std::string Tokenizer::TokenizerImpl::apply_chat_template(
     OPENVINO_ASSERT(resolved_extra_context.is_object(),
                     "Extra context should be an object-like JsonContainer, got: ", resolved_extra_context.type_name());
 
-    minja::chat_template minja_template(chat_tpl, m_bos_token, m_eos_token);
-    
+    auto minja_template = get_parsed_chat_template(chat_tpl);
+
     minja::chat_template_inputs minja_inputs;
     minja_inputs.messages = history.get_messages();
     if (!resolved_tools.empty()) {
@@ -826,7 +983,7 @@ std::string Tokenizer::TokenizerImpl::apply_chat_template(
     
     std::string result;
     try {
-        result = minja_template.apply(minja_inputs);
+        result = minja_template->apply(minja_inputs);
     } catch (const std::exception& error) {
         OPENVINO_THROW("Minja failed to apply chat template. Possible solutions are\n"
                         "* Provide a simplified chat template with set_chat_template().\n"
@@ -841,6 +998,21 @@ std::string Tokenizer::TokenizerImpl::apply_chat_template(
     return result;
 }
 
+std::shared_ptr<const minja::chat_template> Tokenizer::TokenizerImpl::get_parsed_chat_template(const std::string& chat_template) const {
+    std::lock_guard<std::mutex> lock(m_parsed_chat_templates_mutex);
+    auto it = m_parsed_chat_templates.find(chat_template);
+    if (it != m_parsed_chat_templates.end()) {
+        return it->second;
+    }
+    // templates passed to apply_chat_template() explicitly may differ on every call, so the cache is bounded
+    if (m_parsed_chat_templates.size() >= MAX_NUM_PARSED_CHAT_TEMPLATES) {
+        m_parsed_chat_templates.clear();
+    }
+    auto parsed_template = std::make_shared<const minja::chat_template>(chat_template, m_bos_token, m_eos_token);
+    m_parsed_chat_templates.emplace(chat_template, parsed_template);
+    return parsed_template;
+}
+
 void Tokenizer::TokenizerImpl::set_chat_template(const std::string& chat_template) {
     m_original_chat_template = chat_template;
     m_chat_template = remap_template(chat_template);
@@ -5,6 +5,7 @@
 #include <filesystem>
 #include <fstream>
 #include <memory>
+#include <mutex>
 
 #include "minja/minja.hpp"
 #include "minja/chat-template.hpp"
@@ -14,6 +15,7 @@
 
 #include "gguf_utils/gguf_tokenizer.hpp"
 #include "tokenizer/chat_template_fallback_map.hpp"
+#include "tokenizer/encode_cache.hpp"
 #include "tokenizer/make_tokenizer_stateful.hpp"
 #include "tokenizer/tokenizers_path.hpp"
 #include "circular_buffer_queue.hpp"
@@ -45,11 +47,18 @@ public:
     std::string m_original_chat_template = {};
     std::vector<std::string> m_vocab = {};
     std::shared_ptr<StructuredOutputController> m_structured_output_controller = nullptr;
+    // cache of single prompt encodings, created when `encode_cache_size` property is set
+    std::unique_ptr<EncodeCache> m_encode_cache = nullptr;
+    // minja renders probe conversations to detect template capabilities on parsing, so parsed templates are reused
+    mutable std::mutex m_parsed_chat_templates_mutex;
+    mutable std::unordered_map<std::string, std::shared_ptr<const minja::chat_template>> m_parsed_chat_templates;
+    static constexpr size_t MAX_NUM_PARSED_CHAT_TEMPLATES = 8;
 
     template <typename T>
     void set_state_value(ov::VariableState& state, std::optional<T> value, ov::AnyMap& state_flags);
 
     void set_state_if_necessary(CircularBufferQueueElementGuard<ov::InferRequest>& infer_request_guard, const ov::AnyMap& params);
+    void set_state_if_necessary(ov::InferRequest& infer_request, const ov::AnyMap& params);
 
     TokenizerImpl(const std::filesystem::path& models_path, const ov::AnyMap& properties);
     TokenizerImpl(const std::pair<std::shared_ptr<ov::Model>, std::shared_ptr<ov::Model>>& models, const ov::AnyMap& properties);
@@ -66,6 +75,7 @@ public:
     TokenizedInputs encode(const std::vector<std::pair<std::string, std::string>>& prompts_pairs, const ov::AnyMap& tokenization_params = {});
     TokenizedInputs encode(const std::vector<std::string>& prompts_1, const std::vector<std::string>& prompts_2, const ov::AnyMap& tokenization_params = {});
     TokenizedInputs encode(const std::vector<std::string>& prompts, const ov::AnyMap& tokenization_params = {});
+    std::vector<TokenizedInputs> encode_parallel(const std::vector<std::string>& prompts, const ov::AnyMap& tokenization_params = {});
 
     TokenizedInputs get_copied_results(ov::Tensor input_ids, ov::Tensor attention_mask);
 
@@ -79,6 +89,8 @@ public:
                                     const std::optional<JsonContainer>& tools,
                                     const std::optional<JsonContainer>& extra_context) const;
 
+    std::shared_ptr<const minja::chat_template> get_parsed_chat_template(const std::string& chat_template) const;
+
     void set_chat_template(const std::string& chat_template);
     std::string get_chat_template() const;
     std::string get_original_chat_template() const;
@@ -7,6 +7,7 @@
 #include <variant>
 #include <fstream>
 #include <memory>
+#include <sstream>
 
 #include "openvino/runtime/properties.hpp"
 #include "openvino/op/add.hpp"
@@ -547,6 +548,30 @@ KVAxesPosition get_kv_axes_pos(std::shared_ptr<const ov::Model> model) {
     return kv_pos;
 }
 
+uint64_t get_model_weights_fingerprint(const std::shared_ptr<const ov::Model>& model) {
+    // number of positions sampled from each constant and the number of bytes taken at each of them
+    constexpr size_t num_sampled_chunks = 16, chunk_size = 8;
+    std::stringstream fingerprint;
+    for (const auto& op : model->get_ordered_ops()) {
+        auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op);
+        if (!constant) {
+            continue;
+        }
+        fingerprint << constant->get_element_type() << constant->get_shape() << ';';
+        const size_t byte_size = constant->get_byte_size();
+        const char* data = static_cast<const char*>(constant->get_data_ptr());
+        if (byte_size <= num_sampled_chunks * chunk_size) {
+            fingerprint.write(data, byte_size);
+            continue;
+        }
+        const size_t stride = (byte_size - chunk_size) / (num_sampled_chunks - 1);
+        for (size_t chunk = 0; chunk < num_sampled_chunks; ++chunk) {
+            fingerprint.write(data + chunk * stride, chunk_size);
+        }
+    }
+    return std::hash<std::string>{}(fingerprint.str());
+}
+
 void trim_kv_cache(ov::InferRequest request, CacheState& cache_state, std::optional<AdapterController> adapter_controller) {
     if (cache_state.needs_reset()) {
         if (adapter_controller) {
@@ -584,17 +609,25 @@ void trim_kv_cache(ov::InferRequest request, CacheState& cache_state, std::optio
                         "trim_kv_cache: requested to trim ", cache_state.num_tokens_to_trim,
                         " tokens, but cached sequence length is ", shape[cache_state.seq_length_axis],
                         " for state '", state.get_name(), "'.");
+        if (shape[cache_state.seq_length_axis] == cache_state.num_tokens_to_trim) {
+            state.reset();
+            continue;
+        }
         shape[cache_state.seq_length_axis] -= cache_state.num_tokens_to_trim;
 
         ov::Coordinate new_shape_begin{0, 0, 0, 0};
         ov::Coordinate new_shape_end{shape};
 
-        auto trimmed_tensor = ov::Tensor(old_tensor, new_shape_begin, new_shape_end);
-
-        ov::Tensor new_tensor(old_tensor.get_element_type(), shape);
-        trimmed_tensor.copy_to(new_tensor);
-
-        state.set_state(new_tensor);
+        // A contiguous ROI view of the current state, e.g. when there is a single head, is set as is,
+        // so the kept part of the cache is copied once by the plugin instead of being copied into a compact tensor first.
+        ov::Tensor trimmed_tensor(old_tensor, new_shape_begin, new_shape_end);
+        if (trimmed_tensor.is_continuous()) {
+            state.set_state(trimmed_tensor);
+        } else {
+            ov::Tensor new_tensor(old_tensor.get_element_type(), shape);
+            trimmed_tensor.copy_to(new_tensor);
+            state.set_state(new_tensor);
+        }
     }
 }
 
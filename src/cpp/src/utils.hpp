@@ -187,6 +187,12 @@ struct KVAxesPosition {
 
 KVAxesPosition get_kv_axes_pos(std::shared_ptr<const ov::Model> model);
 
+/**
+ * @brief Computes a fingerprint of the model weights from the types, shapes and a strided sample of the contents of its constants,
+ * so that models sharing the architecture, e.g. different fine-tunes, get different fingerprints without reading all the weights.
+ */
+uint64_t get_model_weights_fingerprint(const std::shared_ptr<const ov::Model>& model);
+
 class CacheState {
     std::vector<int64_t> state;
     CacheTypes cache_types;
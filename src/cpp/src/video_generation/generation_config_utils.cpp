@@ -11,6 +11,9 @@ void validate_generation_config(const VideoGenerationConfig& config) {
     if (config.guidance_scale <= 1.0f && config.negative_prompt != std::nullopt) {
         GENAI_WARN("Guidance scale <= 1.0 ignores negative prompt");
     }
+    if (config.vae_tiling_config) {
+        config.vae_tiling_config->validate();
+    }
 }
 
 void update_generation_config(VideoGenerationConfig& config, const ov::AnyMap& properties) {
@@ -31,6 +34,7 @@ void update_generation_config(VideoGenerationConfig& config, const ov::AnyMap& p
     read_anymap_param(properties, "num_inference_steps", config.num_inference_steps);
     read_anymap_param(properties, "max_sequence_length", config.max_sequence_length);
     read_anymap_param(properties, "taylorseer_config", config.taylorseer_config);
+    read_anymap_param(properties, "vae_tiling_config", config.vae_tiling_config);
 
     read_anymap_param(properties, "adapters", config.adapters);
 
@@ -17,6 +17,7 @@
 #include "openvino/op/constant.hpp"
 
 #include "utils.hpp"
+#include "image_generation/vae_tiling.hpp"
 #include "json_utils.hpp"
 #include "lora/helper.hpp"
 
@@ -24,6 +25,10 @@ using namespace ov::genai;
 
 namespace {
 
+int64_t get_compression_ratio(const AutoencoderKLLTXVideo::Config& config, int64_t patch_size) {
+    return patch_size * std::pow(2, std::accumulate(config.spatio_temporal_scaling.begin(), config.spatio_temporal_scaling.end(), 0));
+}
+
 // for BW compatibility with 2024.6.0
 ov::AnyMap handle_scale_factor(std::shared_ptr<ov::Model> model, const std::string& device, ov::AnyMap properties) {
     auto it = properties.find("WA_INFERENCE_PRECISION_HINT");
@@ -145,16 +150,8 @@ AutoencoderKLLTXVideo& AutoencoderKLLTXVideo::reshape(int64_t batch_size,
     // TODO: for img2video
     // if (m_encoder_model) {...}
 
-    int64_t spatial_compression_ratio =
-        get_config().patch_size *
-        std::pow(
-            2,
-            std::accumulate(get_config().spatio_temporal_scaling.begin(), get_config().spatio_temporal_scaling.end(), 0));
-    int64_t temporal_compression_ratio =
-        get_config().patch_size_t *
-        std::pow(
-            2,
-            std::accumulate(get_config().spatio_temporal_scaling.begin(), get_config().spatio_temporal_scaling.end(), 0));
+    int64_t spatial_compression_ratio = get_compression_ratio(get_config(), get_config().patch_size);
+    int64_t temporal_compression_ratio = get_compression_ratio(get_config(), get_config().patch_size_t);
 
     num_frames = ((num_frames - 1) / temporal_compression_ratio + 1) / m_transformer_patch_size_t;
     height /= (spatial_compression_ratio * m_transformer_patch_size);
@@ -167,12 +164,67 @@ AutoencoderKLLTXVideo& AutoencoderKLLTXVideo::reshape(int64_t batch_size,
     return *this;
 }
 
-ov::Tensor AutoencoderKLLTXVideo::decode(const ov::Tensor& latent) {
+ov::Tensor AutoencoderKLLTXVideo::decode(const ov::Tensor& latent, const std::optional<VAETilingConfig>& tiling_config) {
     OPENVINO_ASSERT(m_decoder_request, "VAE decoder model must be compiled first. Cannot infer non-compiled model");
 
-    m_decoder_request.set_input_tensor(latent);
-    m_decoder_request.infer();
-    return m_decoder_request.get_output_tensor();
+    // [B, C, F, H, W]
+    const ov::Shape latent_shape = latent.get_shape();
+    const size_t spatial_ratio = get_compression_ratio(get_config(), get_config().patch_size);
+    const size_t temporal_ratio = get_compression_ratio(get_config(), get_config().patch_size_t);
+    std::vector<vae_tiling::TileRange> f_tiles, h_tiles, w_tiles;
+    size_t spatial_blend = 0, temporal_blend = 0;
+    if (tiling_config) {
+        tiling_config->validate();
+        const size_t tile_size = tiling_config->tile_size / spatial_ratio, tile_overlap = tiling_config->tile_overlap / spatial_ratio;
+        h_tiles = vae_tiling::split_spatial(latent_shape[3], tile_size, tile_overlap, spatial_ratio);
+        w_tiles = vae_tiling::split_spatial(latent_shape[4], tile_size, tile_overlap, spatial_ratio);
+        spatial_blend = tile_overlap * spatial_ratio;
+
+        // a temporal tile has an extra latent frame, since the first one is decoded into a single frame
+        const size_t temporal_tile_size = tiling_config->temporal_tile_size > 0 ? tiling_config->temporal_tile_size / temporal_ratio + 1 : latent_shape[2];
+        const size_t temporal_tile_overlap = tiling_config->temporal_tile_size > 0 ? tiling_config->temporal_tile_overlap / temporal_ratio + 1 : 0;
+        f_tiles = vae_tiling::split_temporal(latent_shape[2], temporal_tile_size, temporal_tile_overlap, temporal_ratio);
+        temporal_blend = temporal_tile_overlap > 0 ? (temporal_tile_overlap - 1) * temporal_ratio : 0;
+    }
+
+    if (f_tiles.size() <= 1 && h_tiles.size() <= 1 && w_tiles.size() <= 1) {
+        m_decoder_request.set_input_tensor(latent);
+        m_decoder_request.infer();
+        return m_decoder_request.get_output_tensor();
+    }
+
+    OPENVINO_ASSERT(m_decoder_request.get_compiled_model().input(0).get_partial_shape().is_dynamic(),
+                    "Tiled VAE decoding requires VAE decoder with dynamic shapes, while it's reshaped to static shape");
+
+    // decoded tiles are [B, F, H, W, C] u8 videos, which are blended in pixel space
+    const size_t num_frames = (latent_shape[2] - 1) * temporal_ratio + 1;
+    const size_t height = latent_shape[3] * spatial_ratio, width = latent_shape[4] * spatial_ratio;
+    std::optional<vae_tiling::TileBlender> blender;
+    ov::Shape video_shape;
+    for (const auto& f_tile : f_tiles) {
+        for (const auto& h_tile : h_tiles) {
+            for (const auto& w_tile : w_tiles) {
+                m_decoder_request.set_input_tensor(vae_tiling::crop(latent,
+                    {0, 0, f_tile.latent_begin, h_tile.latent_begin, w_tile.latent_begin},
+                    {latent_shape[0], latent_shape[1], f_tile.latent_end, h_tile.latent_end, w_tile.latent_end}));
+                m_decoder_request.infer();
+                ov::Tensor video_tile = m_decoder_request.get_output_tensor();
+
+                if (!blender) {
+                    video_shape = {latent_shape[0], num_frames, height, width, video_tile.get_shape()[4]};
+                    blender.emplace(std::array<size_t, 5>{latent_shape[0], video_shape[4], num_frames, height, width},
+                                    true,
+                                    std::array<size_t, 3>{temporal_blend, spatial_blend, spatial_blend});
+                }
+                blender->add_tile(video_tile,
+                                  f_tile.sample_begin, f_tile.sample_end,
+                                  h_tile.sample_begin, h_tile.sample_end,
+                                  w_tile.sample_begin, w_tile.sample_end);
+            }
+        }
+    }
+
+    return blender->get_output(ov::element::u8, video_shape);
 }
 
 const AutoencoderKLLTXVideo::Config& AutoencoderKLLTXVideo::get_config() const {
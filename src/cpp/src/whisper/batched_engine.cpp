@@ -0,0 +1,473 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "whisper/batched_engine.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <numeric>
+
+#include "openvino/genai/perf_metrics.hpp"
+#include "utils.hpp"
+#include "whisper/logit_processor.hpp"
+#include "whisper/timestamps.hpp"
+#include "whisper/whisper_utils.hpp"
+
+using ov::genai::MicroSeconds;
+
+namespace {
+
+void stream_generated_tokens(const std::shared_ptr<ov::genai::StreamerBase>& streamer,
+                             const ov::genai::GenerationHandle& handle,
+                             const bool return_timestamps) {
+    if (return_timestamps || !streamer || !handle->can_read()) {
+        return;
+    }
+
+    std::unordered_map<uint64_t, ov::genai::GenerationOutput> token = handle->read();
+
+    auto streaming_status = streamer->write(token.begin()->second.generated_ids);
+    if (streaming_status == ov::genai::StreamingStatus::CANCEL) {
+        handle->cancel();
+    } else if (streaming_status == ov::genai::StreamingStatus::STOP) {
+        handle->stop();
+    } else if (streaming_status == ov::genai::StreamingStatus::TOOL_CALL_STOP) {
+        handle->stop(ov::genai::GenerationFinishReason::TOOL_CALL);
+    }
+}
+
+}  // namespace
+
+namespace ov {
+namespace genai {
+
+WhisperStream::WhisperStream(uint64_t request_id,
+                             const WhisperGenerationConfig& config,
+                             const WhisperContextTokens& context_tokens,
+                             const std::shared_ptr<StreamerBase>& streamer)
+    : m_request_id(request_id),
+      m_config(config),
+      m_context_tokens(context_tokens),
+      m_streamer(streamer) {}
+
+uint64_t WhisperStream::get_request_id() const {
+    return m_request_id;
+}
+
+GenerationStatus WhisperStream::get_status() const {
+    return m_status;
+}
+
+bool WhisperStream::has_finished() const {
+    return m_status != GenerationStatus::RUNNING;
+}
+
+void WhisperStream::stop() {
+    m_stop_requested = true;
+}
+
+WhisperGenerateResult& WhisperStream::get_result() {
+    OPENVINO_ASSERT(has_finished(), "Transcription of the stream ", m_request_id, " has not finished");
+    return m_result;
+}
+
+WhisperBatchedEngine::WhisperBatchedEngine(const WhisperConfig& model_config,
+                                           const ov::CompiledModel& encoder,
+                                           std::shared_ptr<WhisperDecoder> decoder,
+                                           WhisperFeatureExtractor& feature_extractor,
+                                           Sampler& sampler,
+                                           size_t max_batch_size)
+    : m_model_config(model_config),
+      m_encoder(encoder.create_infer_request()),
+      m_decoder(decoder),
+      m_feature_extractor(feature_extractor),
+      m_sampler(sampler),
+      m_max_batch_size(max_batch_size) {
+    OPENVINO_ASSERT(m_max_batch_size > 0, "Max batch size of the whisper engine must be greater than 0");
+}
+
+WhisperStream::Ptr WhisperBatchedEngine::add_request(uint64_t request_id,
+                                                     const RawSpeechInput& raw_speech,
+                                                     const WhisperGenerationConfig& config,
+                                                     const WhisperContextTokens& context_tokens,
+                                                     const std::shared_ptr<StreamerBase>& streamer) {
+    OPENVINO_ASSERT(!config.is_beam_search(), "Beam search is not supported by the batched whisper engine");
+    WhisperStream::Ptr stream{new WhisperStream(request_id, config, context_tokens, streamer)};
+
+    const size_t max_new_tokens = config.get_max_new_tokens();
+    WhisperPerfMetrics& perf_metrics = stream->m_result.perf_metrics;
+    perf_metrics.num_input_tokens = 0;
+    perf_metrics.raw_metrics.m_new_token_times.reserve(max_new_tokens);
+    perf_metrics.raw_metrics.m_batch_sizes.reserve(max_new_tokens);
+    perf_metrics.raw_metrics.m_token_infer_durations.reserve(max_new_tokens);
+    perf_metrics.raw_metrics.m_inference_durations = {{MicroSeconds(0.0f)}};
+    perf_metrics.whisper_raw_metrics.word_level_timestamps_processing_durations = {{MicroSeconds(0.0f)}};
+
+    const auto extraction_start = std::chrono::steady_clock::now();
+    stream->m_features = m_feature_extractor.extract(raw_speech);
+    const auto extraction_ms = PerfMetrics::get_microsec(std::chrono::steady_clock::now() - extraction_start);
+    perf_metrics.whisper_raw_metrics.features_extraction_durations.emplace_back(extraction_ms);
+
+    // long-form audio processing requires timestamps to be enabled
+    const bool is_shortform = stream->m_features.n_frames <= m_feature_extractor.nb_max_frames;
+    stream->m_return_timestamps = config.return_timestamps || !is_shortform;
+
+    if (stream->m_features.n_frames == 0) {
+        finish_stream(*stream, GenerationStatus::FINISHED);
+    }
+
+    std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
+    m_awaiting_requests.push_back(stream);
+    return stream;
+}
+
+bool WhisperBatchedEngine::has_non_finished_requests() {
+    std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
+    return !m_awaiting_requests.empty() || !m_requests.empty();
+}
+
+void WhisperBatchedEngine::step() {
+    pull_awaiting_requests();
+
+    // streams are served in the order they were added, so the first ones finish first
+    std::vector<WhisperStream::Ptr> streams;
+    for (const auto& stream : m_requests) {
+        if (stream->has_finished()) {
+            continue;
+        }
+        if (stream->m_stop_requested) {
+            finish_stream(*stream, GenerationStatus::STOP);
+            continue;
+        }
+        streams.push_back(stream);
+        if (streams.size() == m_max_batch_size) {
+            break;
+        }
+    }
+
+    if (!streams.empty()) {
+        ov::Tensor encoder_hidden_states = encode(streams);
+
+        detect_languages(streams, encoder_hidden_states);
+
+        std::vector<std::vector<int64_t>> prompts(streams.size());
+        std::map<size_t, std::vector<size_t>> prompt_len_to_batches;
+        for (size_t batch = 0; batch < streams.size(); batch++) {
+            const WhisperStream& stream = *streams[batch];
+            std::vector<int64_t>& prompt = prompts[batch];
+            prompt = get_prompt_tokens(stream.m_context_tokens, stream.m_config, stream.m_chunk_offset);
+            prompt.insert(prompt.end(), stream.m_sot_tokens.begin(), stream.m_sot_tokens.end());
+            if (!stream.m_return_timestamps) {
+                prompt.push_back(stream.m_config.no_timestamps_token_id);
+            }
+            prompt_len_to_batches[prompt.size()].push_back(batch);
+        }
+
+        for (const auto& [prompt_len, batches] : prompt_len_to_batches) {
+            if (batches.size() == streams.size()) {
+                decode(streams, prompts, encoder_hidden_states);
+                continue;
+            }
+
+            std::vector<WhisperStream::Ptr> batch_streams;
+            std::vector<std::vector<int64_t>> batch_prompts;
+            for (size_t batch : batches) {
+                batch_streams.push_back(streams[batch]);
+                batch_prompts.push_back(prompts[batch]);
+            }
+            decode(batch_streams, batch_prompts, gather_batches(encoder_hidden_states, batches));
+        }
+    }
+
+    m_requests.erase(std::remove_if(m_requests.begin(),
+                                    m_requests.end(),
+                                    [](const WhisperStream::Ptr& stream) {
+                                        return stream->has_finished();
+                                    }),
+                     m_requests.end());
+}
+
+void WhisperBatchedEngine::clear_requests() {
+    {
+        std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
+        m_awaiting_requests.clear();
+    }
+    for (const auto& stream : m_requests) {
+        stream->m_status = GenerationStatus::CANCEL;
+    }
+    m_requests.clear();
+    m_decoder->reset_state();
+}
+
+void WhisperBatchedEngine::pull_awaiting_requests() {
+    std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
+    m_requests.insert(m_requests.end(), m_awaiting_requests.begin(), m_awaiting_requests.end());
+    m_awaiting_requests.clear();
+}
+
+ov::Tensor WhisperBatchedEngine::encode(const std::vector<WhisperStream::Ptr>& streams) {
+    const size_t feature_size = m_feature_extractor.feature_size;
+    const size_t nb_max_frames = m_feature_extractor.nb_max_frames;
+    const size_t chunk_size = feature_size * nb_max_frames;
+
+    ov::Tensor input_features(ov::element::f32, {streams.size(), feature_size, nb_max_frames});
+    for (size_t batch = 0; batch < streams.size(); batch++) {
+        WhisperStream& stream = *streams[batch];
+        const std::vector<float> chunk = stream.m_features.get_data_with_offset(stream.m_chunk_offset, nb_max_frames);
+        OPENVINO_ASSERT(chunk.size() == chunk_size,
+                        "Mel spectrogram required size: ",
+                        feature_size,
+                        " * ",
+                        nb_max_frames,
+                        ". Actual size: ",
+                        chunk.size(),
+                        ".");
+        std::copy(chunk.begin(), chunk.end(), input_features.data<float>() + batch * chunk_size);
+    }
+
+    m_encoder.set_tensor("input_features", input_features);
+
+    const auto infer_start = std::chrono::steady_clock::now();
+    m_encoder.infer();
+    const auto infer_ms = PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start);
+    for (const auto& stream : streams) {
+        stream->m_result.perf_metrics.raw_metrics.m_inference_durations[0] += MicroSeconds(infer_ms);
+    }
+
+    return m_encoder.get_tensor("last_hidden_state");
+}
+
+void WhisperBatchedEngine::detect_languages(const std::vector<WhisperStream::Ptr>& streams,
+                                            const ov::Tensor& encoder_hidden_states) {
+    std::map<int64_t, std::vector<size_t>> decoder_start_token_to_batches;
+    for (size_t batch = 0; batch < streams.size(); batch++) {
+        WhisperStream& stream = *streams[batch];
+        if (!stream.m_sot_tokens.empty()) {
+            continue;
+        }
+        if (requires_language_detection(stream.m_config)) {
+            decoder_start_token_to_batches[stream.m_config.decoder_start_token_id].push_back(batch);
+        } else {
+            stream.m_sot_tokens = get_sot_tokens(stream.m_config);
+        }
+    }
+
+    for (const auto& [decoder_start_token_id, batches] : decoder_start_token_to_batches) {
+        const ov::Tensor hidden_states = batches.size() == streams.size()
+                                             ? encoder_hidden_states
+                                             : gather_batches(encoder_hidden_states, batches);
+        auto [language_tokens, infer_ms] = m_decoder->detect_languages(hidden_states, decoder_start_token_id);
+        for (size_t idx = 0; idx < batches.size(); idx++) {
+            WhisperStream& stream = *streams[batches[idx]];
+            stream.m_sot_tokens = get_sot_tokens(stream.m_config, language_tokens[idx]);
+            stream.m_result.perf_metrics.raw_metrics.m_inference_durations[0] += MicroSeconds(infer_ms);
+        }
+    }
+}
+
+void WhisperBatchedEngine::decode(const std::vector<WhisperStream::Ptr>& streams,
+                                  const std::vector<std::vector<int64_t>>& prompts,
+                                  ov::Tensor encoder_hidden_states) {
+    const size_t batch_size = streams.size();
+    const size_t prompt_len = prompts.at(0).size();
+
+    std::vector<SequenceGroup::Ptr> sequence_groups;
+    std::vector<GenerationHandle> handles;
+    ov::Tensor input_ids = m_decoder->create_host_tensor(ov::element::i64, {batch_size, prompt_len});
+    for (size_t batch = 0; batch < batch_size; batch++) {
+        std::copy(prompts[batch].begin(), prompts[batch].end(), input_ids.data<int64_t>() + batch * prompt_len);
+        auto sequence_group =
+            std::make_shared<SequenceGroup>(m_next_sequence_group_id++, prompts[batch], streams[batch]->m_config, 1);
+        handles.push_back(std::make_shared<GenerationHandleImpl>(sequence_group->get_generation_stream(),
+                                                                 sequence_group->get_sampling_parameters()));
+        sequence_groups.push_back(sequence_group);
+    }
+
+    ov::Tensor beam_idx = m_decoder->create_host_tensor(ov::element::i32, {batch_size});
+    std::iota(beam_idx.data<int32_t>(), beam_idx.data<int32_t>() + batch_size, 0);
+
+    // indices of streams decoded by the current batch
+    std::vector<size_t> rows(batch_size);
+    std::iota(rows.begin(), rows.end(), 0);
+
+    bool initial_step = true;
+    while (!rows.empty()) {
+        const auto infer_start = std::chrono::steady_clock::now();
+        m_decoder->start_async(encoder_hidden_states, input_ids, beam_idx);
+
+        if (!initial_step) {
+            for (size_t row : rows) {
+                stream_generated_tokens(streams[row]->m_streamer, handles[row], streams[row]->m_return_timestamps);
+            }
+        }
+
+        ov::Tensor logits = m_decoder->wait();
+        const auto infer_end = std::chrono::steady_clock::now();
+        const auto infer_ms = PerfMetrics::get_microsec(infer_end - infer_start);
+
+        const size_t output_seq_len = logits.get_shape().at(1);
+        const size_t vocab_size = logits.get_shape().at(2);
+        std::vector<SequenceGroup::Ptr> batch_sequence_groups;
+        for (size_t batch = 0; batch < rows.size(); batch++) {
+            const WhisperStream& stream = *streams[rows[batch]];
+            const SequenceGroup::Ptr& sequence_group = sequence_groups[rows[batch]];
+
+            RawPerfMetrics& raw_metrics = streams[rows[batch]]->m_result.perf_metrics.raw_metrics;
+            raw_metrics.m_inference_durations[0] += MicroSeconds(infer_ms);
+            raw_metrics.m_token_infer_durations.emplace_back(infer_ms);
+            raw_metrics.m_new_token_times.emplace_back(infer_end);
+            raw_metrics.m_batch_sizes.emplace_back(rows.size());
+
+            // streams may have different configs, so logits are processed batch by batch
+            ov::Tensor batch_logits(ov::element::f32,
+                                    {1, output_seq_len, vocab_size},
+                                    logits.data<float>() + batch * output_seq_len * vocab_size);
+            std::map<size_t, std::vector<int64_t>> batch_to_generated_ids;
+            if (!initial_step) {
+                batch_to_generated_ids[0] = sequence_group->get_running_sequences().at(0)->get_generated_ids();
+            }
+            process_whisper_batch_logits(batch_logits,
+                                         stream.m_config,
+                                         stream.m_return_timestamps,
+                                         batch_to_generated_ids);
+
+            sequence_group->schedule_tokens(initial_step ? sequence_group->get_prompt_len() : 1);
+            sequence_group->set_output_seq_len(output_seq_len);
+            batch_sequence_groups.push_back(sequence_group);
+        }
+
+        m_sampler.sample(batch_sequence_groups, logits);
+
+        if (initial_step) {
+            for (size_t row : rows) {
+                stream_generated_tokens(streams[row]->m_streamer, handles[row], streams[row]->m_return_timestamps);
+            }
+            initial_step = false;
+        }
+
+        // finished chunks leave the batch
+        std::vector<size_t> next_rows;
+        std::vector<size_t> next_batches;
+        for (size_t batch = 0; batch < rows.size(); batch++) {
+            const size_t row = rows[batch];
+            WhisperStream& stream = *streams[row];
+            const SequenceGroup::Ptr& sequence_group = sequence_groups[row];
+            if (stream.m_stop_requested) {
+                handles[row]->stop();
+            }
+
+            const bool stopped = sequence_group->handle_stopped() || sequence_group->handle_cancelled();
+            if (!sequence_group->has_finished() && !stopped) {
+                next_rows.push_back(row);
+                next_batches.push_back(batch);
+                continue;
+            }
+
+            stream_generated_tokens(stream.m_streamer, handles[row], stream.m_return_timestamps);
+            const auto& sequence = sequence_group->get_finished_sequences().at(0);
+            finish_chunk(stream, sequence->get_generated_ids(), stopped);
+            m_sampler.clear_request_info(sequence_group->get_request_id());
+        }
+
+        if (next_rows.empty()) {
+            break;
+        }
+
+        // KV cache of the remaining chunks is compacted by beam_idx
+        if (next_rows.size() != rows.size()) {
+            encoder_hidden_states = gather_batches(encoder_hidden_states, next_batches);
+            beam_idx.set_shape({next_rows.size()});
+        }
+        std::copy(next_batches.begin(), next_batches.end(), beam_idx.data<int32_t>());
+
+        input_ids = m_decoder->create_host_tensor(ov::element::i64, {next_rows.size(), 1});
+        for (size_t batch = 0; batch < next_rows.size(); batch++) {
+            const SequenceGroup::Ptr& sequence_group = sequence_groups[next_rows[batch]];
+            input_ids.data<int64_t>()[batch] = sequence_group->get_running_sequences().at(0)->get_generated_ids().back();
+        }
+        rows = std::move(next_rows);
+    }
+
+    m_decoder->reset_state();
+}
+
+void WhisperBatchedEngine::finish_chunk(WhisperStream& stream, const std::vector<int64_t>& chunk_tokens, bool stopped) {
+    // 0.02 by default
+    const float time_precision =
+        static_cast<float>(m_feature_extractor.chunk_length) / m_model_config.max_source_positions;
+    OPENVINO_ASSERT(m_feature_extractor.sampling_rate != 0, "Sampling Rate for Feature Extractor is 0");
+    const float frame_length_in_seconds =
+        static_cast<float>(m_feature_extractor.hop_length) / m_feature_extractor.sampling_rate;
+    const float chunk_time_offset = stream.m_chunk_offset * frame_length_in_seconds;
+
+    RawPerfMetrics& raw_metrics = stream.m_result.perf_metrics.raw_metrics;
+    std::vector<int64_t>& output_tokens = stream.m_result.output_tokens;
+
+    size_t segment_offset = 0;
+    if (stream.m_return_timestamps) {
+        auto extracted_segments = extract_segments(chunk_tokens,
+                                                   stream.m_config,
+                                                   m_feature_extractor.nb_max_frames,
+                                                   time_precision,
+                                                   chunk_time_offset);
+
+        utils::filter_non_segment_metrics(raw_metrics, output_tokens.size(), extracted_segments.segment_ranges);
+
+        stream.m_segments.insert(stream.m_segments.end(),
+                                 extracted_segments.segments.begin(),
+                                 extracted_segments.segments.end());
+
+        output_tokens.insert(output_tokens.end(),
+                             extracted_segments.non_timestamp_tokens.begin(),
+                             extracted_segments.non_timestamp_tokens.end());
+
+        if (stream.m_streamer &&
+            stream.m_streamer->write(extracted_segments.non_timestamp_tokens) != StreamingStatus::RUNNING) {
+            stopped = true;
+        }
+
+        segment_offset = extracted_segments.last_offset;
+    } else {
+        output_tokens.insert(output_tokens.end(), chunk_tokens.begin(), chunk_tokens.end());
+        segment_offset = stream.m_features.n_frames;
+    }
+
+    stream.m_chunk_offset += segment_offset;
+
+    if (stopped) {
+        finish_stream(stream, GenerationStatus::STOP);
+    } else if (stream.m_chunk_offset >= stream.m_features.n_frames) {
+        finish_stream(stream, GenerationStatus::FINISHED);
+    }
+}
+
+void WhisperBatchedEngine::finish_stream(WhisperStream& stream, GenerationStatus status) {
+    if (stream.m_streamer) {
+        stream.m_streamer->end();
+    }
+
+    // if return_timestamps wasn't enabled by user
+    if (stream.m_config.return_timestamps) {
+        stream.m_result.segments = std::move(stream.m_segments);
+    }
+
+    stream.m_status = status;
+}
+
+ov::Tensor WhisperBatchedEngine::gather_batches(const ov::Tensor& tensor, const std::vector<size_t>& batches) {
+    ov::Shape shape = tensor.get_shape();
+    const size_t batch_byte_size = tensor.get_byte_size() / shape.at(0);
+    shape[0] = batches.size();
+
+    ov::Tensor gathered = m_decoder->create_host_tensor(tensor.get_element_type(), shape);
+    const auto* src = static_cast<const uint8_t*>(tensor.data());
+    auto* dst = static_cast<uint8_t*>(gathered.data());
+    for (size_t idx = 0; idx < batches.size(); idx++) {
+        std::memcpy(dst + idx * batch_byte_size, src + batches[idx] * batch_byte_size, batch_byte_size);
+    }
+    return gathered;
+}
+
+}  // namespace genai
+}  // namespace ov
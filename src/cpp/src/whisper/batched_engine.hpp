@@ -0,0 +1,150 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <openvino/openvino.hpp>
+
+#include "openvino/genai/generation_handle.hpp"
+#include "openvino/genai/streamer_base.hpp"
+#include "openvino/genai/whisper_generation_config.hpp"
+#include "openvino/genai/whisper_pipeline.hpp"
+#include "sampling/sampler.hpp"
+#include "whisper/config.hpp"
+#include "whisper/context_tokens.hpp"
+#include "whisper/feature_extractor.hpp"
+#include "whisper/models/decoder.hpp"
+#include "whisper/whisper.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * @brief Handle of an audio stream added to WhisperBatchedEngine.
+ * The stream is transcribed chunk by chunk, the result is available once the stream has finished.
+ */
+class WhisperStream {
+public:
+    using Ptr = std::shared_ptr<WhisperStream>;
+
+    uint64_t get_request_id() const;
+
+    GenerationStatus get_status() const;
+
+    bool has_finished() const;
+
+    /**
+     * @brief Stops transcription of the stream, chunks decoded so far are kept in the result.
+     */
+    void stop();
+
+    /**
+     * @return Tokens, segments and metrics of the stream, which must have finished.
+     */
+    WhisperGenerateResult& get_result();
+
+private:
+    friend class WhisperBatchedEngine;
+
+    WhisperStream(uint64_t request_id,
+                  const WhisperGenerationConfig& config,
+                  const WhisperContextTokens& context_tokens,
+                  const std::shared_ptr<StreamerBase>& streamer);
+
+    uint64_t m_request_id;
+    WhisperGenerationConfig m_config;
+    WhisperContextTokens m_context_tokens;
+    std::shared_ptr<StreamerBase> m_streamer;
+
+    WhisperFeatures m_features;
+    bool m_return_timestamps = false;
+    // prepared once for the whole stream, the language is detected from its first chunk
+    std::vector<int64_t> m_sot_tokens;
+    size_t m_chunk_offset = 0;
+    std::vector<Segment> m_segments;
+    WhisperGenerateResult m_result;
+
+    std::atomic<GenerationStatus> m_status{GenerationStatus::RUNNING};
+    std::atomic<bool> m_stop_requested{false};
+};
+
+/**
+ * @brief Transcribes many audio streams at once.
+ * Each step takes the next 30 seconds chunk of up to max_batch_size streams, encodes the chunks with a single encoder
+ * inference and detects languages of the new streams with a single decoder inference. The chunks are decoded
+ * together, one decoder inference per token for all of them, chunks with different prompt lengths are decoded in
+ * separate batches. A chunk which has finished leaves the batch, and KV cache of the others is compacted by beam_idx.
+ * The stateful decoder shares cache_position between the batches and has no attention mask, so a new chunk can't
+ * join a batch being decoded and waits for the next step.
+ * Timestamps, language detection and streaming of each stream are handled as in whisper_generate.
+ * Greedy and multinomial sampling are supported.
+ */
+class WhisperBatchedEngine {
+public:
+    WhisperBatchedEngine(const WhisperConfig& model_config,
+                         const ov::CompiledModel& encoder,
+                         std::shared_ptr<WhisperDecoder> decoder,
+                         WhisperFeatureExtractor& feature_extractor,
+                         Sampler& sampler,
+                         size_t max_batch_size);
+
+    /**
+     * @brief Extracts features of the audio and adds the stream to be transcribed by the next steps.
+     * @param config Validated generation config of the stream, beam search is not supported.
+     */
+    WhisperStream::Ptr add_request(uint64_t request_id,
+                                   const RawSpeechInput& raw_speech,
+                                   const WhisperGenerationConfig& config,
+                                   const WhisperContextTokens& context_tokens,
+                                   const std::shared_ptr<StreamerBase>& streamer);
+
+    bool has_non_finished_requests();
+
+    /**
+     * @brief Encodes and decodes the next chunk of up to max_batch_size streams.
+     */
+    void step();
+
+    /**
+     * @brief Drops all streams, e.g. after a step has thrown an exception.
+     */
+    void clear_requests();
+
+private:
+    void pull_awaiting_requests();
+
+    ov::Tensor encode(const std::vector<WhisperStream::Ptr>& streams);
+
+    void detect_languages(const std::vector<WhisperStream::Ptr>& streams, const ov::Tensor& encoder_hidden_states);
+
+    void decode(const std::vector<WhisperStream::Ptr>& streams,
+                const std::vector<std::vector<int64_t>>& prompts,
+                ov::Tensor encoder_hidden_states);
+
+    // extracts segments of a decoded chunk and moves the stream to its next chunk
+    void finish_chunk(WhisperStream& stream, const std::vector<int64_t>& chunk_tokens, bool stopped);
+
+    void finish_stream(WhisperStream& stream, GenerationStatus status);
+
+    ov::Tensor gather_batches(const ov::Tensor& tensor, const std::vector<size_t>& batches);
+
+    WhisperConfig m_model_config;
+    ov::InferRequest m_encoder;
+    std::shared_ptr<WhisperDecoder> m_decoder;
+    WhisperFeatureExtractor& m_feature_extractor;
+    Sampler& m_sampler;
+    size_t m_max_batch_size;
+    uint64_t m_next_sequence_group_id = 0;
+
+    std::vector<WhisperStream::Ptr> m_requests;
+    std::mutex m_awaiting_requests_mutex;
+    std::vector<WhisperStream::Ptr> m_awaiting_requests;
+};
+
+}  // namespace genai
+}  // namespace ov
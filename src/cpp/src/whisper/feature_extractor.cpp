@@ -40,91 +40,41 @@ static bool hann_window(const size_t length, const bool periodic, std::vector<fl
     return true;
 }
 
-// naive Discrete Fourier Transform
-// input is real-valued
-// output is complex-valued
-static void dft(const std::vector<float>& in,
-                std::vector<float>& out,
-                const std::vector<float>& sin_vals,
-                const std::vector<float>& cos_vals,
-                const size_t n_fft) {
-    int N = in.size();
-
-    out.resize(N * 2);
-    const int sin_cos_step = n_fft / N;
-
-    for (int k = 0; k < N; k++) {
-        float re = 0;
-        float im = 0;
-
-        for (int n = 0; n < N; n++) {
-            int idx = (k * n * sin_cos_step) % (n_fft);  // t = 2*M_PI*k*n/N
-            re += in[n] * cos_vals[idx];                 // cos(t)
-            im -= in[n] * sin_vals[idx];                 // sin(t)
+// computes log10 mel energies of a frame multiplied by the Hanning window, out[j * out_stride] for mel filter j
+void log_mel_frame(const float* fft_in,
+                   std::vector<float>& power,
+                   ov::genai::RealFFT::Workspace& workspace,
+                   const ov::genai::RealFFT& fft,
+                   const std::vector<float>& mel_filter,
+                   const std::vector<std::pair<size_t, size_t>>& mel_filter_ranges,
+                   const size_t feature_size,
+                   float* out,
+                   const size_t out_stride) {
+    const size_t n_fft = fft.get_num_bins();
+
+    // modulus^2 of the complex FFT bins
+    fft.power_spectrum(fft_in, power.data(), workspace);
+
+    // mel spectrogram
+    for (size_t j = 0; j < feature_size; j++) {
+        // the triangular filter is zero outside of its range
+        const auto [begin, end] = mel_filter_ranges[j];
+        const float* filter = mel_filter.data() + j * n_fft;
+        double sum = 0.0;
+
+        // unroll loop (suggested by GH user @lunixbochs)
+        size_t k = begin;
+        for (; k + 4 <= end; k += 4) {
+            sum += power[k + 0] * filter[k + 0] + power[k + 1] * filter[k + 1] +
+                   power[k + 2] * filter[k + 2] + power[k + 3] * filter[k + 3];
         }
 
-        out[k * 2 + 0] = re;
-        out[k * 2 + 1] = im;
-    }
-}
-
-// Cooley-Tukey FFT
-// input is real-valued
-// output is complex-valued
-static void fft(const std::vector<float>& in,
-                std::vector<float>& out,
-                const std::vector<float>& sin_vals,
-                const std::vector<float>& cos_vals,
-                const size_t n_fft) {
-    out.resize(in.size() * 2);
-
-    int N = in.size();
-
-    if (N == 1) {
-        out[0] = in[0];
-        out[1] = 0;
-        return;
-    }
-
-    if (N % 2 == 1) {
-        dft(in, out, sin_vals, cos_vals, n_fft);
-        return;
-    }
-
-    std::vector<float> even;
-    std::vector<float> odd;
-
-    even.reserve(N / 2);
-    odd.reserve(N / 2);
-
-    for (int i = 0; i < N; i++) {
-        if (i % 2 == 0) {
-            even.push_back(in[i]);
-        } else {
-            odd.push_back(in[i]);
+        // handle the range remainder
+        for (; k < end; k++) {
+            sum += power[k] * filter[k];
         }
-    }
-
-    std::vector<float> even_fft;
-    std::vector<float> odd_fft;
-
-    fft(even, even_fft, sin_vals, cos_vals, n_fft);
-    fft(odd, odd_fft, sin_vals, cos_vals, n_fft);
-
-    const int sin_cos_step = n_fft / N;
-    for (int k = 0; k < N / 2; k++) {
-        int idx = k * sin_cos_step;  // t = 2*M_PI*k/N
-        float re = cos_vals[idx];    // cos(t)
-        float im = -sin_vals[idx];   // sin(t)
-
-        float re_odd = odd_fft[2 * k + 0];
-        float im_odd = odd_fft[2 * k + 1];
-
-        out[2 * k + 0] = even_fft[2 * k + 0] + re * re_odd - im * im_odd;
-        out[2 * k + 1] = even_fft[2 * k + 1] + re * im_odd + im * re_odd;
 
-        out[2 * (k + N / 2) + 0] = even_fft[2 * k + 0] - re * re_odd + im * im_odd;
-        out[2 * (k + N / 2) + 1] = even_fft[2 * k + 1] - re * im_odd - im * re_odd;
+        out[j * out_stride] = log10(std::max(sum, 1e-10));
     }
 }
 
@@ -136,11 +86,12 @@ static void log_mel_spectrogram_worker_thread(int ith,
                                               int frame_step,
                                               int n_threads,
                                               const std::vector<float>& mel_filter,
+                                              const std::vector<std::pair<size_t, size_t>>& mel_filter_ranges,
                                               WhisperFeatures& features,
-                                              const std::vector<float>& sin_vals,
-                                              const std::vector<float>& cos_vals) {
+                                              const ov::genai::RealFFT& fft) {
     std::vector<float> fft_in(frame_size, 0.0);
-    std::vector<float> fft_out(2 * frame_size);
+    std::vector<float> power(fft.get_num_bins());
+    ov::genai::RealFFT::Workspace workspace = fft.create_workspace();
     int n_fft = 1 + (frame_size / 2);
     int i = ith;
 
@@ -159,38 +110,18 @@ static void log_mel_spectrogram_worker_thread(int ith,
             std::fill(fft_in.begin() + (n_samples - offset), fft_in.end(), 0.0);
         }
 
-        // FFT
-        fft(fft_in, fft_out, sin_vals, cos_vals, frame_size);
-
-        // Calculate modulus^2 of complex numbers
-        // Use pow(fft_out[2 * j + 0], 2) + pow(fft_out[2 * j + 1], 2) causes inference quality problem? Interesting.
-        for (int j = 0; j < n_fft; j++) {
-            fft_out[j] = (fft_out[2 * j + 0] * fft_out[2 * j + 0] + fft_out[2 * j + 1] * fft_out[2 * j + 1]);
-        }
-
-        // mel spectrogram
-        for (int j = 0; j < features.feature_size; j++) {
-            double sum = 0.0;
-
-            // unroll loop (suggested by GH user @lunixbochs)
-            int k = 0;
-            for (k = 0; k < n_fft - 3; k += 4) {
-                sum += fft_out[k + 0] * mel_filter[j * n_fft + k + 0] + fft_out[k + 1] * mel_filter[j * n_fft + k + 1] +
-                       fft_out[k + 2] * mel_filter[j * n_fft + k + 2] + fft_out[k + 3] * mel_filter[j * n_fft + k + 3];
-            }
-
-            // handle n_fft remainder
-            for (; k < n_fft; k++) {
-                sum += fft_out[k] * mel_filter[j * n_fft + k];
-            }
-
-            sum = log10(std::max(sum, 1e-10));
-
-            features.data[j * features.n_frames + i] = sum;
-        }
+        log_mel_frame(fft_in.data(),
+                      power,
+                      workspace,
+                      fft,
+                      mel_filter,
+                      mel_filter_ranges,
+                      features.feature_size,
+                      features.data.data() + i,
+                      features.n_frames);
     }
 
-    // Otherwise fft_out are all zero
+    // Otherwise fft_in are all zero
     double sum = log10(1e-10);
     for (; i < features.n_frames; i += n_threads) {
         for (int j = 0; j < features.feature_size; j++) {
@@ -302,19 +233,6 @@ std::vector<std::vector<float>> mel_filter_bank(const int64_t num_frequency_bins
     return mel_filters;
 }
 
-// In FFT, we frequently use sine and cosine operations with the same values.
-// We can use precalculated values to speed up the process.
-void fill_sin_cos_table(std::vector<float>& sin_vals, std::vector<float>& cos_vals, const size_t n_fft) {
-    sin_vals.resize(n_fft);
-    cos_vals.resize(n_fft);
-
-    for (size_t i = 0; i < n_fft; i++) {
-        double theta = (2 * M_PI * i) / n_fft;
-        sin_vals[i] = sinf(theta);
-        cos_vals[i] = cosf(theta);
-    }
-}
-
 std::vector<float> pad(const std::vector<float>& raw_speech,
                        const size_t minimum_length,
                        const size_t reflect_pad_size) {
@@ -337,6 +255,26 @@ std::vector<float> pad(const std::vector<float>& raw_speech,
     return padded_raw_speech;
 }
 
+// clamping and normalization
+void normalize_log_mel(std::vector<float>& data) {
+    double mmax = -1e20;
+    for (size_t i = 0; i < data.size(); i++) {
+        if (data[i] > mmax) {
+            mmax = data[i];
+        }
+    }
+
+    mmax -= 8.0;
+
+    for (size_t i = 0; i < data.size(); i++) {
+        if (data[i] < mmax) {
+            data[i] = mmax;
+        }
+
+        data[i] = (data[i] + 4.0) / 4.0;
+    }
+}
+
 WhisperFeatures mel_spectrogram_convert_audio(const std::vector<float>& raw_speech,
                                               const size_t sampling_rate,
                                               const size_t feature_size,
@@ -344,8 +282,8 @@ WhisperFeatures mel_spectrogram_convert_audio(const std::vector<float>& raw_spee
                                               const size_t hop_length,
                                               const size_t n_threads,
                                               const std::vector<float>& mel_filter,
-                                              const std::vector<float>& sin_vals,
-                                              const std::vector<float>& cos_vals) {
+                                              const std::vector<std::pair<size_t, size_t>>& mel_filter_ranges,
+                                              const ov::genai::RealFFT& fft) {
     // Hanning window (Use cosf to eliminate difference)
     // ref: https://pytorch.org/docs/stable/generated/torch.hann_window.html
     // ref: https://github.com/openai/whisper/blob/main/whisper/audio.py#L147
@@ -375,9 +313,9 @@ WhisperFeatures mel_spectrogram_convert_audio(const std::vector<float>& raw_spee
                                       hop_length,
                                       n_threads,
                                       std::cref(mel_filter),
+                                      std::cref(mel_filter_ranges),
                                       std::ref(features),
-                                      std::cref(sin_vals),
-                                      std::cref(cos_vals));
+                                      std::cref(fft));
         }
 
         // main thread
@@ -389,34 +327,33 @@ WhisperFeatures mel_spectrogram_convert_audio(const std::vector<float>& raw_spee
                                           hop_length,
                                           n_threads,
                                           mel_filter,
+                                          mel_filter_ranges,
                                           features,
-                                          sin_vals,
-                                          cos_vals);
+                                          fft);
 
         for (int iw = 0; iw < n_threads - 1; ++iw) {
             workers[iw].join();
         }
     }
 
-    // clamping and normalization
-    double mmax = -1e20;
-    for (int i = 0; i < features.feature_size * features.n_frames; i++) {
-        if (features.data[i] > mmax) {
-            mmax = features.data[i];
-        }
-    }
-
-    mmax -= 8.0;
+    normalize_log_mel(features.data);
 
-    for (int i = 0; i < features.feature_size * features.n_frames; i++) {
-        if (features.data[i] < mmax) {
-            features.data[i] = mmax;
-        }
+    return features;
+}
 
-        features.data[i] = (features.data[i] + 4.0) / 4.0;
+// a sample of a stream at the position, reflected before the first sample and zero after the last one
+float get_stream_sample(const ov::genai::WhisperIncrementalFeatures& features, int64_t position) {
+    if (position < 0) {
+        position = -position;
     }
-
-    return features;
+    if (position >= static_cast<int64_t>(features.n_samples)) {
+        return 0.f;
+    }
+    OPENVINO_ASSERT(position >= static_cast<int64_t>(features.samples_offset),
+                    "Sample ",
+                    position,
+                    " of the stream has been discarded");
+    return features.samples[position - features.samples_offset];
 }
 
 }  // namespace
@@ -441,9 +378,18 @@ std::vector<float> WhisperFeatures::get_data_with_offset(const size_t frame_offs
     return offset_data;
 }
 
+void WhisperIncrementalFeatures::discard_frames(const size_t frame_offset) {
+    const size_t discarded_frame_offset = std::min(frame_offset, n_frames);
+    if (discarded_frame_offset <= frames_offset) {
+        return;
+    }
+    log_mel.erase(log_mel.begin(), log_mel.begin() + (discarded_frame_offset - frames_offset) * feature_size);
+    frames_offset = discarded_frame_offset;
+}
+
 WhisperFeatureExtractor::WhisperFeatureExtractor(const std::filesystem::path& preprocessor_json_path) {
     init_parameters(preprocessor_json_path);
-    fill_sin_cos_table(sin_vals, cos_vals, n_fft);
+    fft = std::make_shared<const RealFFT>(n_fft);
     init_mel_filter();
 }
 
@@ -478,6 +424,22 @@ void WhisperFeatureExtractor::init_mel_filter() {
             mel_filter[col * mel_data.size() + row] = mel_data[row][col];
         }
     }
+
+    // non-zero ranges of the filters, the rest of the frequency bins are skipped in the spectrogram computation
+    const size_t num_bins = mel_data.size();
+    mel_filter_ranges.resize(mel_data[0].size());
+    for (size_t col = 0; col < mel_data[0].size(); col++) {
+        const float* filter = mel_filter.data() + col * num_bins;
+        size_t begin = 0;
+        while (begin < num_bins && filter[begin] == 0.f) {
+            begin++;
+        }
+        size_t end = num_bins;
+        while (end > begin && filter[end - 1] == 0.f) {
+            end--;
+        }
+        mel_filter_ranges[col] = {begin, end};
+    }
 }
 
 WhisperFeatures WhisperFeatureExtractor::extract(const std::vector<float>& raw_speech) {
@@ -489,8 +451,101 @@ WhisperFeatures WhisperFeatureExtractor::extract(const std::vector<float>& raw_s
                                          hop_length,
                                          n_threads,
                                          mel_filter,
-                                         sin_vals,
-                                         cos_vals);
+                                         mel_filter_ranges,
+                                         *fft);
+}
+
+void WhisperFeatureExtractor::extract_incremental(const std::vector<float>& raw_speech,
+                                                  WhisperIncrementalFeatures& features) {
+    features.feature_size = feature_size;
+    features.samples.insert(features.samples.end(), raw_speech.begin(), raw_speech.end());
+    features.n_samples += raw_speech.size();
+
+    std::vector<float> hann;
+    hann_window(n_fft, true, hann);
+    std::vector<float> fft_in(n_fft);
+    std::vector<float> power(fft->get_num_bins());
+    RealFFT::Workspace workspace = fft->create_workspace();
+
+    // a frame is centered at its first sample and depends on reflect_pad_size samples at both sides of it
+    const size_t reflect_pad_size = n_fft / 2;
+    for (; features.n_frames * hop_length + reflect_pad_size < features.n_samples; features.n_frames++) {
+        const int64_t frame_begin = static_cast<int64_t>(features.n_frames * hop_length) - reflect_pad_size;
+        for (size_t j = 0; j < n_fft; j++) {
+            fft_in[j] = hann[j] * get_stream_sample(features, frame_begin + j);
+        }
+
+        features.log_mel.resize(features.log_mel.size() + feature_size);
+        log_mel_frame(fft_in.data(),
+                      power,
+                      workspace,
+                      *fft,
+                      mel_filter,
+                      mel_filter_ranges,
+                      feature_size,
+                      features.log_mel.data() + features.log_mel.size() - feature_size,
+                      1);
+    }
+
+    // samples before the first incomplete frame aren't needed anymore
+    const size_t next_frame_begin = features.n_frames * hop_length;
+    if (next_frame_begin > reflect_pad_size + features.samples_offset) {
+        const size_t samples_offset = next_frame_begin - reflect_pad_size;
+        features.samples.erase(features.samples.begin(),
+                               features.samples.begin() + (samples_offset - features.samples_offset));
+        features.samples_offset = samples_offset;
+    }
+}
+
+std::vector<float> WhisperFeatureExtractor::get_window(const WhisperIncrementalFeatures& features,
+                                                       const size_t frame_offset) {
+    OPENVINO_ASSERT(frame_offset >= features.frames_offset,
+                    "Frame ",
+                    frame_offset,
+                    " of the stream has been discarded");
+
+    std::vector<float> window(feature_size * nb_max_frames);
+    std::vector<float> fft_in(n_fft);
+    std::vector<float> power(fft->get_num_bins());
+    RealFFT::Workspace workspace = fft->create_workspace();
+    std::vector<float> hann;
+
+    const size_t reflect_pad_size = n_fft / 2;
+    for (size_t idx = 0; idx < nb_max_frames; idx++) {
+        const size_t frame = frame_offset + idx;
+        if (frame < features.n_frames) {
+            const float* log_mel = features.log_mel.data() + (frame - features.frames_offset) * feature_size;
+            for (size_t j = 0; j < feature_size; j++) {
+                window[j * nb_max_frames + idx] = log_mel[j];
+            }
+        } else if (frame * hop_length < features.n_samples + reflect_pad_size) {
+            // the frame isn't complete yet, the samples after the last one are zero
+            if (hann.empty()) {
+                hann_window(n_fft, true, hann);
+            }
+            const int64_t frame_begin = static_cast<int64_t>(frame * hop_length) - reflect_pad_size;
+            for (size_t j = 0; j < n_fft; j++) {
+                fft_in[j] = hann[j] * get_stream_sample(features, frame_begin + j);
+            }
+            log_mel_frame(fft_in.data(),
+                          power,
+                          workspace,
+                          *fft,
+                          mel_filter,
+                          mel_filter_ranges,
+                          feature_size,
+                          window.data() + idx,
+                          nb_max_frames);
+        } else {
+            for (size_t j = 0; j < feature_size; j++) {
+                window[j * nb_max_frames + idx] = log10(1e-10);
+            }
+        }
+    }
+
+    normalize_log_mel(window);
+
+    return window;
 }
 
 }  // namespace genai
@@ -4,9 +4,12 @@
 #pragma once
 
 #include <filesystem>
+#include <memory>
+#include <utility>
 #include <vector>
 
 #include "openvino/genai/visibility.hpp"
+#include "whisper/fft.hpp"
 
 namespace ov {
 namespace genai {
@@ -36,6 +39,34 @@ struct WhisperFeatures {
     std::vector<float> get_data_with_offset(const size_t frame_offset, const size_t min_frames);
 };
 
+/**
+ * @brief Log-mel spectrogram of an audio stream computed incrementally by WhisperFeatureExtractor as samples arrive.
+ * A frame is computed once all of its samples are known and is never recomputed. Clamping and normalization depend
+ * on the maximum over the window passed to the encoder and are applied by WhisperFeatureExtractor::get_window().
+ */
+struct WhisperIncrementalFeatures {
+    size_t feature_size = 0;
+
+    // total number of samples of the stream
+    size_t n_samples = 0;
+
+    // frames [0, n_frames) of the stream are complete
+    size_t n_frames = 0;
+
+    // samples of the stream starting from samples_offset, the incomplete frames depend on
+    std::vector<float> samples;
+    size_t samples_offset = 0;
+
+    // log10 mel energies of the complete frames starting from frames_offset, flattened [frames, feature_size]
+    std::vector<float> log_mel;
+    size_t frames_offset = 0;
+
+    /**
+     * @brief Releases complete frames before frame_offset, which won't be passed to the encoder anymore.
+     */
+    void discard_frames(const size_t frame_offset);
+};
+
 class WhisperFeatureExtractor {
 public:
     size_t feature_size = 80;
@@ -56,10 +87,24 @@ public:
      */
     WhisperFeatures extract(const std::vector<float>& raw_speech);
 
+    /**
+     * @brief Appends samples to the stream and computes the log-mel frames which have become complete
+     */
+    void extract_incremental(const std::vector<float>& raw_speech, WhisperIncrementalFeatures& features);
+
+    /**
+     * @brief Create a normalized window of frames [frame_offset, frame_offset + nb_max_frames) of the stream,
+     * flattened [feature_size, nb_max_frames]. Incomplete frames are computed with zeros after the last sample,
+     * frames after the end of the stream are padding.
+     */
+    std::vector<float> get_window(const WhisperIncrementalFeatures& features, const size_t frame_offset);
+
 private:
-    std::vector<float> sin_vals;
-    std::vector<float> cos_vals;
+    // the FFT plan with precomputed twiddles for n_fft, shared by the spectrogram worker threads
+    std::shared_ptr<const RealFFT> fft;
     std::vector<float> mel_filter;
+    // [begin, end) ranges of the frequency bins where the mel filters are non-zero
+    std::vector<std::pair<size_t, size_t>> mel_filter_ranges;
 
     void init_mel_filter();
     void init_parameters(const std::filesystem::path& preprocessor_json_path);
@@ -0,0 +1,313 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#ifdef _WIN32
+#    define _USE_MATH_DEFINES
+#endif
+
+#include "whisper/fft.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+#include <utility>
+
+#include "openvino/core/except.hpp"
+
+namespace {
+
+std::vector<size_t> factorize(size_t size) {
+    std::vector<size_t> radices;
+    while (size % 4 == 0) {
+        radices.push_back(4);
+        size /= 4;
+    }
+    while (size % 2 == 0) {
+        radices.push_back(2);
+        size /= 2;
+    }
+    for (size_t factor = 3; size > 1; factor += 2) {
+        while (size % factor == 0) {
+            radices.push_back(factor);
+            size /= factor;
+        }
+    }
+    return radices;
+}
+
+// exp(-2 * pi * i * numerator / denominator), computed in double precision
+std::pair<float, float> unit_root(size_t numerator, size_t denominator) {
+    const double angle = -2.0 * M_PI * static_cast<double>(numerator) / static_cast<double>(denominator);
+    return {static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle))};
+}
+
+}  // namespace
+
+namespace ov {
+namespace genai {
+
+RealFFT::RealFFT(size_t size) : m_size(size), m_complex_size(size % 2 == 0 ? size / 2 : size) {
+    OPENVINO_ASSERT(size > 0, "FFT size must be positive");
+
+    size_t stride = 1;
+    for (size_t radix : factorize(m_complex_size)) {
+        Stage stage;
+        stage.radix = radix;
+        stage.stride = stride;
+        stage.twiddle_re.resize((radix - 1) * stride);
+        stage.twiddle_im.resize((radix - 1) * stride);
+        for (size_t r = 1; r < radix; ++r) {
+            for (size_t k = 0; k < stride; ++k) {
+                std::tie(stage.twiddle_re[(r - 1) * stride + k], stage.twiddle_im[(r - 1) * stride + k]) = unit_root(r * k, stride * radix);
+            }
+        }
+        stage.root_re.resize(radix);
+        stage.root_im.resize(radix);
+        for (size_t r = 0; r < radix; ++r) {
+            std::tie(stage.root_re[r], stage.root_im[r]) = unit_root(r, radix);
+        }
+        m_max_radix = std::max(m_max_radix, radix);
+        m_stages.push_back(std::move(stage));
+        stride *= radix;
+    }
+
+    if (m_size % 2 == 0) {
+        m_split_re.resize(get_num_bins());
+        m_split_im.resize(get_num_bins());
+        for (size_t k = 0; k < get_num_bins(); ++k) {
+            std::tie(m_split_re[k], m_split_im[k]) = unit_root(k, m_size);
+        }
+    }
+}
+
+size_t RealFFT::get_size() const {
+    return m_size;
+}
+
+size_t RealFFT::get_num_bins() const {
+    return m_size / 2 + 1;
+}
+
+RealFFT::Workspace RealFFT::create_workspace() const {
+    Workspace workspace;
+    workspace.re.resize(m_complex_size);
+    workspace.im.resize(m_complex_size);
+    workspace.tmp_re.resize(m_complex_size);
+    workspace.tmp_im.resize(m_complex_size);
+    workspace.bins_re.resize(get_num_bins());
+    workspace.bins_im.resize(get_num_bins());
+    workspace.butterfly_re.resize(m_max_radix);
+    workspace.butterfly_im.resize(m_max_radix);
+    return workspace;
+}
+
+void RealFFT::transform(const float* input, float* out_re, float* out_im, Workspace& workspace) const {
+    float* re = workspace.re.data();
+    float* im = workspace.im.data();
+    const size_t num_bins = get_num_bins();
+
+    if (m_size % 2 == 1) {
+        std::copy_n(input, m_size, re);
+        std::fill_n(im, m_size, 0.f);
+        complex_transform(workspace);
+        std::copy_n(workspace.re.data(), num_bins, out_re);
+        std::copy_n(workspace.im.data(), num_bins, out_im);
+        return;
+    }
+
+    // even and odd samples form the real and imaginary parts of a sequence of half the size
+    const size_t half_size = m_complex_size;
+    for (size_t n = 0; n < half_size; ++n) {
+        re[n] = input[2 * n];
+        im[n] = input[2 * n + 1];
+    }
+    complex_transform(workspace);
+    re = workspace.re.data();
+    im = workspace.im.data();
+
+    // Z[k] = E[k] + i * O[k], where E and O are the transforms of the even and odd samples:
+    // E[k] = (Z[k] + conj(Z[M - k])) / 2, O[k] = -i * (Z[k] - conj(Z[M - k])) / 2 and X[k] = E[k] + W^k * O[k]
+    for (size_t k = 0; k < num_bins; ++k) {
+        const size_t direct = k == half_size ? 0 : k;
+        const size_t mirrored = k == 0 ? 0 : half_size - k;
+        const float even_re = 0.5f * (re[direct] + re[mirrored]);
+        const float even_im = 0.5f * (im[direct] - im[mirrored]);
+        const float odd_re = 0.5f * (im[direct] + im[mirrored]);
+        const float odd_im = -0.5f * (re[direct] - re[mirrored]);
+        out_re[k] = even_re + m_split_re[k] * odd_re - m_split_im[k] * odd_im;
+        out_im[k] = even_im + m_split_re[k] * odd_im + m_split_im[k] * odd_re;
+    }
+}
+
+void RealFFT::power_spectrum(const float* input, float* power, Workspace& workspace) const {
+    float* bins_re = workspace.bins_re.data();
+    float* bins_im = workspace.bins_im.data();
+    transform(input, bins_re, bins_im, workspace);
+    for (size_t k = 0; k < get_num_bins(); ++k) {
+        power[k] = bins_re[k] * bins_re[k] + bins_im[k] * bins_im[k];
+    }
+}
+
+void RealFFT::complex_transform(Workspace& workspace) const {
+    // stages ping-pong between the buffers, the result is moved back to re and im
+    bool is_result_in_tmp = false;
+    for (const Stage& stage : m_stages) {
+        if (is_result_in_tmp) {
+            run_stage(stage, workspace.tmp_re.data(), workspace.tmp_im.data(), workspace.re.data(), workspace.im.data(), workspace);
+        } else {
+            run_stage(stage, workspace.re.data(), workspace.im.data(), workspace.tmp_re.data(), workspace.tmp_im.data(), workspace);
+        }
+        is_result_in_tmp = !is_result_in_tmp;
+    }
+    if (is_result_in_tmp) {
+        std::swap(workspace.re, workspace.tmp_re);
+        std::swap(workspace.im, workspace.tmp_im);
+    }
+}
+
+void RealFFT::run_stage(const Stage& stage, const float* in_re, const float* in_im, float* out_re, float* out_im, Workspace& workspace) const {
+    const size_t radix = stage.radix;
+    const size_t stride = stage.stride;
+    // input r of butterfly j is at j + r * distance, output r is at (j / stride) * stride * radix + j % stride + r * stride
+    const size_t distance = m_complex_size / radix;
+    const size_t num_blocks = distance / stride;
+    const float* twiddle_re = stage.twiddle_re.data();
+    const float* twiddle_im = stage.twiddle_im.data();
+
+    for (size_t block = 0; block < num_blocks; ++block) {
+        const size_t in_offset = block * stride;
+        const size_t out_offset = block * stride * radix;
+
+        if (radix == 2) {
+            const float* a_re = in_re + in_offset;
+            const float* a_im = in_im + in_offset;
+            const float* b_re = a_re + distance;
+            const float* b_im = a_im + distance;
+            float* x0_re = out_re + out_offset;
+            float* x0_im = out_im + out_offset;
+            float* x1_re = x0_re + stride;
+            float* x1_im = x0_im + stride;
+            for (size_t k = 0; k < stride; ++k) {
+                const float t_re = b_re[k] * twiddle_re[k] - b_im[k] * twiddle_im[k];
+                const float t_im = b_re[k] * twiddle_im[k] + b_im[k] * twiddle_re[k];
+                x0_re[k] = a_re[k] + t_re;
+                x0_im[k] = a_im[k] + t_im;
+                x1_re[k] = a_re[k] - t_re;
+                x1_im[k] = a_im[k] - t_im;
+            }
+        } else if (radix == 4) {
+            const float* w1_re = twiddle_re;
+            const float* w1_im = twiddle_im;
+            const float* w2_re = twiddle_re + stride;
+            const float* w2_im = twiddle_im + stride;
+            const float* w3_re = twiddle_re + 2 * stride;
+            const float* w3_im = twiddle_im + 2 * stride;
+            const float* a0_re = in_re + in_offset;
+            const float* a0_im = in_im + in_offset;
+            const float* a1_re = a0_re + distance;
+            const float* a1_im = a0_im + distance;
+            const float* a2_re = a1_re + distance;
+            const float* a2_im = a1_im + distance;
+            const float* a3_re = a2_re + distance;
+            const float* a3_im = a2_im + distance;
+            float* x0_re = out_re + out_offset;
+            float* x0_im = out_im + out_offset;
+            float* x1_re = x0_re + stride;
+            float* x1_im = x0_im + stride;
+            float* x2_re = x1_re + stride;
+            float* x2_im = x1_im + stride;
+            float* x3_re = x2_re + stride;
+            float* x3_im = x2_im + stride;
+            for (size_t k = 0; k < stride; ++k) {
+                const float b1_re = a1_re[k] * w1_re[k] - a1_im[k] * w1_im[k];
+                const float b1_im = a1_re[k] * w1_im[k] + a1_im[k] * w1_re[k];
+                const float b2_re = a2_re[k] * w2_re[k] - a2_im[k] * w2_im[k];
+                const float b2_im = a2_re[k] * w2_im[k] + a2_im[k] * w2_re[k];
+                const float b3_re = a3_re[k] * w3_re[k] - a3_im[k] * w3_im[k];
+                const float b3_im = a3_re[k] * w3_im[k] + a3_im[k] * w3_re[k];
+
+                const float t0_re = a0_re[k] + b2_re, t0_im = a0_im[k] + b2_im;
+                const float t1_re = a0_re[k] - b2_re, t1_im = a0_im[k] - b2_im;
+                const float t2_re = b1_re + b3_re, t2_im = b1_im + b3_im;
+                const float t3_re = b1_re - b3_re, t3_im = b1_im - b3_im;
+
+                x0_re[k] = t0_re + t2_re;
+                x0_im[k] = t0_im + t2_im;
+                x2_re[k] = t0_re - t2_re;
+                x2_im[k] = t0_im - t2_im;
+                // multiplication by -i and i
+                x1_re[k] = t1_re + t3_im;
+                x1_im[k] = t1_im - t3_re;
+                x3_re[k] = t1_re - t3_im;
+                x3_im[k] = t1_im + t3_re;
+            }
+        } else if (radix == 5) {
+            // Whisper's n_fft of 400 is transformed as 200 = 4 * 2 * 5 * 5 complex values
+            const float c1 = stage.root_re[1], c2 = stage.root_re[2];
+            const float s1 = -stage.root_im[1], s2 = -stage.root_im[2];
+            for (size_t k = 0; k < stride; ++k) {
+                const size_t in_idx = in_offset + k;
+                float x_re[5], x_im[5];
+                x_re[0] = in_re[in_idx];
+                x_im[0] = in_im[in_idx];
+                for (size_t r = 1; r < 5; ++r) {
+                    const float a_re = in_re[in_idx + r * distance];
+                    const float a_im = in_im[in_idx + r * distance];
+                    const float w_re = twiddle_re[(r - 1) * stride + k];
+                    const float w_im = twiddle_im[(r - 1) * stride + k];
+                    x_re[r] = a_re * w_re - a_im * w_im;
+                    x_im[r] = a_re * w_im + a_im * w_re;
+                }
+                const float t1_re = x_re[1] + x_re[4], t1_im = x_im[1] + x_im[4];
+                const float t2_re = x_re[2] + x_re[3], t2_im = x_im[2] + x_im[3];
+                const float t3_re = x_re[1] - x_re[4], t3_im = x_im[1] - x_im[4];
+                const float t4_re = x_re[2] - x_re[3], t4_im = x_im[2] - x_im[3];
+                const float a1_re = x_re[0] + c1 * t1_re + c2 * t2_re, a1_im = x_im[0] + c1 * t1_im + c2 * t2_im;
+                const float a2_re = x_re[0] + c2 * t1_re + c1 * t2_re, a2_im = x_im[0] + c2 * t1_im + c1 * t2_im;
+                const float b1_re = s1 * t3_re + s2 * t4_re, b1_im = s1 * t3_im + s2 * t4_im;
+                const float b2_re = s2 * t3_re - s1 * t4_re, b2_im = s2 * t3_im - s1 * t4_im;
+
+                const size_t out_idx = out_offset + k;
+                out_re[out_idx] = x_re[0] + t1_re + t2_re;
+                out_im[out_idx] = x_im[0] + t1_im + t2_im;
+                // X[1] = a1 - i * b1, X[4] = a1 + i * b1, X[2] = a2 - i * b2, X[3] = a2 + i * b2
+                out_re[out_idx + stride] = a1_re + b1_im;
+                out_im[out_idx + stride] = a1_im - b1_re;
+                out_re[out_idx + 4 * stride] = a1_re - b1_im;
+                out_im[out_idx + 4 * stride] = a1_im + b1_re;
+                out_re[out_idx + 2 * stride] = a2_re + b2_im;
+                out_im[out_idx + 2 * stride] = a2_im - b2_re;
+                out_re[out_idx + 3 * stride] = a2_re - b2_im;
+                out_im[out_idx + 3 * stride] = a2_im + b2_re;
+            }
+        } else {
+            float* v_re = workspace.butterfly_re.data();
+            float* v_im = workspace.butterfly_im.data();
+            for (size_t k = 0; k < stride; ++k) {
+                const size_t in_idx = in_offset + k;
+                v_re[0] = in_re[in_idx];
+                v_im[0] = in_im[in_idx];
+                for (size_t r = 1; r < radix; ++r) {
+                    const float a_re = in_re[in_idx + r * distance];
+                    const float a_im = in_im[in_idx + r * distance];
+                    const float w_re = twiddle_re[(r - 1) * stride + k];
+                    const float w_im = twiddle_im[(r - 1) * stride + k];
+                    v_re[r] = a_re * w_re - a_im * w_im;
+                    v_im[r] = a_re * w_im + a_im * w_re;
+                }
+                for (size_t q = 0; q < radix; ++q) {
+                    float sum_re = 0.f, sum_im = 0.f;
+                    for (size_t r = 0, root_idx = 0; r < radix; ++r, root_idx = (root_idx + q) % radix) {
+                        sum_re += v_re[r] * stage.root_re[root_idx] - v_im[r] * stage.root_im[root_idx];
+                        sum_im += v_re[r] * stage.root_im[root_idx] + v_im[r] * stage.root_re[root_idx];
+                    }
+                    out_re[out_offset + k + q * stride] = sum_re;
+                    out_im[out_offset + k + q * stride] = sum_im;
+                }
+            }
+        }
+    }
+}
+
+}  // namespace genai
+}  // namespace ov
@@ -0,0 +1,78 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace ov {
+namespace genai {
+
+/**
+ * @brief Forward DFT of real-valued frames of a fixed size, computing only the size / 2 + 1 non-redundant bins.
+ * A frame of even size is transformed as a complex sequence of half the size, which is factorized into radices 4, 2
+ * and odd primes and transformed by an iterative Stockham FFT, so neither recursion nor bit reversal is needed.
+ * Twiddle factors of all the stages are precomputed on construction. A plan is created once per n_fft and is shared
+ * by the threads, each of them providing its own Workspace. Real and imaginary parts are stored in separate
+ * arrays, so the innermost loops are unit-stride and get vectorized by the compiler.
+ */
+class RealFFT {
+public:
+    struct Workspace {
+        std::vector<float> re, im;
+        std::vector<float> tmp_re, tmp_im;
+        std::vector<float> bins_re, bins_im;
+        // inputs of a butterfly of a generic radix
+        std::vector<float> butterfly_re, butterfly_im;
+    };
+
+    explicit RealFFT(size_t size);
+
+    size_t get_size() const;
+
+    size_t get_num_bins() const;
+
+    Workspace create_workspace() const;
+
+    /**
+     * @brief Computes bins [0, size / 2] of the DFT of the frame.
+     * @param input The frame of `size` values.
+     * @param out_re Real parts of the bins, get_num_bins() values.
+     * @param out_im Imaginary parts of the bins, get_num_bins() values.
+     */
+    void transform(const float* input, float* out_re, float* out_im, Workspace& workspace) const;
+
+    /**
+     * @brief Computes squared magnitudes of bins [0, size / 2] of the DFT of the frame.
+     * @param power Squared magnitudes, get_num_bins() values.
+     */
+    void power_spectrum(const float* input, float* power, Workspace& workspace) const;
+
+private:
+    struct Stage {
+        size_t radix;
+        // product of the radices of the previous stages
+        size_t stride;
+        // twiddles of input r > 0 of butterfly k are stored at (r - 1) * stride + k
+        std::vector<float> twiddle_re, twiddle_im;
+        // roots of unity of the radix, used by the generic butterfly
+        std::vector<float> root_re, root_im;
+    };
+
+    // transforms workspace.re and workspace.im in place
+    void complex_transform(Workspace& workspace) const;
+
+    void run_stage(const Stage& stage, const float* in_re, const float* in_im, float* out_re, float* out_im, Workspace& workspace) const;
+
+    size_t m_size;
+    // the size of the complex sequence the frame is transformed as
+    size_t m_complex_size;
+    size_t m_max_radix = 1;
+    std::vector<Stage> m_stages;
+    // exp(-2 * pi * i * k / size) for the bins, used to split the transform of the complex sequence for even sizes
+    std::vector<float> m_split_re, m_split_im;
+};
+
+}  // namespace genai
+}  // namespace ov
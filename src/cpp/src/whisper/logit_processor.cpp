@@ -113,5 +113,26 @@ void process_whisper_timestamp_logits(ov::Tensor& logits,
     }
 }
 
+void process_whisper_batch_logits(ov::Tensor logits,
+                                  const ov::genai::WhisperGenerationConfig& config,
+                                  const bool return_timestamps,
+                                  const std::map<size_t, std::vector<int64_t>>& batch_to_generated_ids) {
+    const bool initial_step = batch_to_generated_ids.empty();
+    const size_t batch_size = logits.get_shape().at(0);
+
+    for (size_t batch = 0; batch < batch_size; batch++) {
+        if (initial_step) {
+            ov::genai::do_suppress_tokens(logits, batch, config.begin_suppress_tokens);
+        }
+
+        ov::genai::do_suppress_tokens(logits, batch, config.suppress_tokens);
+
+        if (return_timestamps) {
+            const auto& generated_ids = initial_step ? std::vector<int64_t>{} : batch_to_generated_ids.at(batch);
+            ov::genai::process_whisper_timestamp_logits(logits, batch, config, generated_ids, initial_step);
+        }
+    }
+}
+
 }  // namespace genai
 }  // namespace ov
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <map>
 #include <openvino/openvino.hpp>
 
 #include "openvino/genai/whisper_generation_config.hpp"
@@ -18,5 +19,14 @@ void process_whisper_timestamp_logits(ov::Tensor& logits,
                                       const std::vector<int64_t>& generated_tokens,
                                       bool initial_step = false);
 
+/**
+ * @brief Suppresses tokens and applies the timestamp rules to the logits of every batch.
+ * @param batch_to_generated_ids Tokens generated by every batch so far, empty for the initial step.
+ */
+void process_whisper_batch_logits(ov::Tensor logits,
+                                  const ov::genai::WhisperGenerationConfig& config,
+                                  const bool return_timestamps,
+                                  const std::map<size_t, std::vector<int64_t>>& batch_to_generated_ids);
+
 }  // namespace genai
 }  // namespace ov
@@ -4,6 +4,7 @@
 #include "decoder.hpp"
 
 #include <filesystem>
+#include <numeric>
 
 #include "statefull_decoder.hpp"
 #include "whisper/whisper_utils.hpp"
@@ -23,27 +24,38 @@ std::shared_ptr<WhisperDecoder> WhisperDecoder::from_path(const std::filesystem:
 
 std::pair<int64_t, float> WhisperDecoder::detect_language(const ov::Tensor& encoder_hidden_state,
                                                           const int64_t decoder_start_token_id) {
-    Tensor input_ids_tensor = create_host_tensor(ov::element::i64, {1, 1});
-    input_ids_tensor.data<int64_t>()[0] = decoder_start_token_id;
+    auto [language_tokens, infer_ms] = detect_languages(encoder_hidden_state, decoder_start_token_id);
+    return {language_tokens.at(0), infer_ms};
+}
+
+std::pair<std::vector<int64_t>, float> WhisperDecoder::detect_languages(const ov::Tensor& encoder_hidden_states,
+                                                                        const int64_t decoder_start_token_id) {
+    const size_t batch_size = encoder_hidden_states.get_shape().at(0);
+
+    Tensor input_ids_tensor = create_host_tensor(ov::element::i64, {batch_size, 1});
+    std::fill_n(input_ids_tensor.data<int64_t>(), batch_size, decoder_start_token_id);
 
-    Tensor beam_idx_tensor = create_host_tensor(ov::element::i32, {1});
-    beam_idx_tensor.data<int32_t>()[0] = 0;
+    Tensor beam_idx_tensor = create_host_tensor(ov::element::i32, {batch_size});
+    std::iota(beam_idx_tensor.data<int32_t>(), beam_idx_tensor.data<int32_t>() + batch_size, 0);
 
     const auto infer_start = std::chrono::steady_clock::now();
-    start_async(encoder_hidden_state, input_ids_tensor, beam_idx_tensor);
+    start_async(encoder_hidden_states, input_ids_tensor, beam_idx_tensor);
 
     auto output_tensor = wait();
     const auto infer_ms = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start);
 
-    int64_t output_token = ov::genai::utils::argmax(output_tensor, 0);
+    std::vector<int64_t> output_tokens(batch_size);
+    for (size_t batch = 0; batch < batch_size; batch++) {
+        output_tokens[batch] = ov::genai::utils::argmax(output_tensor, batch);
+    }
 
     reset_state();
 
-    return {output_token, infer_ms};
+    return {output_tokens, infer_ms};
 }
 
 /**
- * Encoder hidden states expected to be with batch 1
+ * Encoder hidden states expected to be with batch 1 or with requested batch_size
  * Expand encoder hidden state tensor from batch 1 to requested batch_size.
  * Set new encoder hidden states tensor to infer request.
  */
@@ -56,6 +68,12 @@ void WhisperDecoder::_set_encoder_hidden_states_tensor(const Tensor& encoder_hid
         return;
     }
 
+    // hidden states of different chunks decoded together, already batched
+    if (encoder_hidden_state.get_shape().at(0) == batch_size) {
+        request.set_tensor("encoder_hidden_states", encoder_hidden_state);
+        return;
+    }
+
     OPENVINO_ASSERT(encoder_hidden_state.get_shape().at(0) == 1);
 
     if (batch_size == 1) {
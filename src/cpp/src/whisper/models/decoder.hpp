@@ -20,6 +20,14 @@ public:
 
     std::pair<int64_t, float> detect_language(const Tensor& encoder_hidden_state, const int64_t decoder_start_token_id);
 
+    /**
+     * @brief Detects languages of several audio chunks with a single decoder inference.
+     * @param encoder_hidden_states Encoder hidden states of the chunks, one batch per chunk.
+     * @return Language token ids of the chunks and the inference duration in microseconds.
+     */
+    std::pair<std::vector<int64_t>, float> detect_languages(const Tensor& encoder_hidden_states,
+                                                            const int64_t decoder_start_token_id);
+
     virtual void start_async(const Tensor& encoder_hidden_state, const Tensor& input_ids, const Tensor& beam_idx) = 0;
 
     virtual Tensor wait() = 0;
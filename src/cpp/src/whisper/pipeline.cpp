@@ -11,6 +11,7 @@
 #include "openvino/genai/text_streamer.hpp"
 #include "openvino/genai/whisper_pipeline.hpp"
 #include "utils.hpp"
+#include "whisper/batched_engine.hpp"
 #include "whisper/config.hpp"
 #include "whisper/context_tokens.hpp"
 #include "whisper/feature_extractor.hpp"
@@ -18,6 +19,7 @@
 #include "whisper/models/decoder.hpp"
 #include "whisper/pipeline_base.hpp"
 #include "whisper/pipeline_static.hpp"
+#include "whisper/streaming.hpp"
 #include "whisper/whisper.hpp"
 #include "whisper/word_level_timestamps.hpp"
 
@@ -72,6 +74,9 @@ namespace genai {
 
 class WhisperPipeline::WhisperPipelineStatefulImpl : public WhisperPipeline::WhisperPipelineImplBase {
 public:
+    // the number of audio chunks encoded and decoded together by generate_batch
+    static constexpr size_t DEFAULT_MAX_BATCH_SIZE = 8;
+
     WhisperPipelineStatefulImpl(const std::filesystem::path& models_path,
                                 const std::string& device,
                                 const ov::AnyMap& properties)
@@ -80,6 +85,9 @@ public:
         ov::AnyMap properties_copy = properties;
         m_generation_config.update_generation_config(properties_copy);
         erase_whisper_generation_config_keys(properties_copy);
+        const size_t max_batch_size =
+            utils::pop_or_default(properties_copy, "WHISPER_MAX_BATCH_SIZE", DEFAULT_MAX_BATCH_SIZE);
+        const bool encoder_lookahead = utils::pop_or_default(properties_copy, "WHISPER_ENCODER_LOOKAHEAD", false);
 
         ov::Core core = utils::singleton_core();
         ov::CompiledModel compiled_model;
@@ -98,6 +106,9 @@ public:
 
         ov::genai::utils::print_compiled_model_properties(compiled_model, "whisper encoder model");
         m_encoder = init_model(compiled_model);
+        if (encoder_lookahead) {
+            m_lookahead_encoder = init_model(compiled_model);
+        }
 
         const bool decompose_cross_attention_spda_ops = m_generation_config.word_timestamps;
         m_decoder =
@@ -113,21 +124,22 @@ public:
         }
 
         m_sampler.set_seed(m_generation_config.rng_seed);
+
+        if (device != "NPU") {
+            m_engine = std::make_unique<WhisperBatchedEngine>(m_model_config,
+                                                              m_encoder.get_compiled_model(),
+                                                              m_decoder,
+                                                              m_feature_extractor,
+                                                              m_sampler,
+                                                              max_batch_size);
+        }
     }
 
     WhisperDecodedResults generate(const RawSpeechInput& raw_speech_input,
                                    OptionalWhisperGenerationConfig generation_config,
                                    const std::shared_ptr<StreamerBase> streamer) override {
         auto start_time = std::chrono::steady_clock::now();
-        WhisperGenerationConfig config = (generation_config.has_value()) ? *generation_config : m_generation_config;
-
-        // If stop_token_ids were not provided, take value from default m_generation_config
-        if (config.stop_token_ids.empty())
-            config.stop_token_ids = m_generation_config.stop_token_ids;
-        // If eos_token_id was not provided, take value from default m_generation_config
-        if (config.eos_token_id == -1)
-            config.set_eos_token_id(m_generation_config.eos_token_id);
-        config.validate();
+        WhisperGenerationConfig config = resolve_generation_config(generation_config);
 
         auto [context_tokens, tokenization_duration_microseconds] = prepare_context_tokens(config, m_tokenizer);
 
@@ -140,7 +152,100 @@ public:
                                                            m_feature_extractor,
                                                            streamer,
                                                            m_sampler,
-                                                           m_tokenizer);
+                                                           m_tokenizer,
+                                                           m_lookahead_encoder ? &m_lookahead_encoder : nullptr);
+        return decode_result(generate_result, tokenization_duration_microseconds, start_time);
+    }
+
+    std::vector<WhisperDecodedResults> generate_batch(
+        const std::vector<RawSpeechInput>& raw_speech_inputs,
+        const std::vector<WhisperGenerationConfig>& generation_configs,
+        const std::vector<std::shared_ptr<StreamerBase>>& streamers) override {
+        auto start_time = std::chrono::steady_clock::now();
+        std::vector<WhisperGenerationConfig> configs;
+        configs.reserve(generation_configs.size());
+        for (const auto& generation_config : generation_configs) {
+            configs.push_back(resolve_generation_config(generation_config));
+        }
+
+        // beam search and word level timestamps are supported by whisper_generate only
+        const bool is_batched = m_engine && std::none_of(configs.begin(), configs.end(), [](const auto& config) {
+            return config.is_beam_search() || config.word_timestamps;
+        });
+        if (!is_batched) {
+            return WhisperPipelineImplBase::generate_batch(raw_speech_inputs, configs, streamers);
+        }
+
+        std::vector<WhisperStream::Ptr> streams;
+        std::vector<float> tokenization_durations;
+        try {
+            for (size_t idx = 0; idx < raw_speech_inputs.size(); idx++) {
+                auto [context_tokens, tokenization_duration_microseconds] =
+                    prepare_context_tokens(configs[idx], m_tokenizer);
+                tokenization_durations.push_back(tokenization_duration_microseconds);
+                streams.push_back(
+                    m_engine->add_request(idx, raw_speech_inputs[idx], configs[idx], context_tokens, streamers[idx]));
+            }
+
+            while (m_engine->has_non_finished_requests()) {
+                m_engine->step();
+            }
+        } catch (...) {
+            m_engine->clear_requests();
+            throw;
+        }
+
+        std::vector<WhisperDecodedResults> results;
+        results.reserve(streams.size());
+        for (size_t idx = 0; idx < streams.size(); idx++) {
+            results.push_back(decode_result(streams[idx]->get_result(), tokenization_durations[idx], start_time));
+        }
+        return results;
+    }
+
+    void start_streaming(OptionalWhisperGenerationConfig generation_config, float min_update_interval) override {
+        WhisperGenerationConfig config = resolve_generation_config(generation_config);
+        auto [context_tokens, tokenization_duration_microseconds] = prepare_context_tokens(config, m_tokenizer);
+
+        m_streaming_session = std::make_unique<WhisperStreamingSession>(config,
+                                                                        context_tokens,
+                                                                        m_model_config,
+                                                                        m_encoder,
+                                                                        m_decoder,
+                                                                        m_feature_extractor,
+                                                                        m_sampler,
+                                                                        m_tokenizer,
+                                                                        min_update_interval);
+    }
+
+    WhisperStreamingUpdate push_audio(const RawSpeechInput& raw_speech_input) override {
+        OPENVINO_ASSERT(m_streaming_session, "Whisper streaming session isn't started, call start_streaming() first");
+        return m_streaming_session->push_audio(raw_speech_input);
+    }
+
+    WhisperStreamingUpdate finish_streaming() override {
+        OPENVINO_ASSERT(m_streaming_session, "Whisper streaming session isn't started, call start_streaming() first");
+        auto streaming_session = std::move(m_streaming_session);
+        return streaming_session->finish();
+    }
+
+private:
+    WhisperGenerationConfig resolve_generation_config(const OptionalWhisperGenerationConfig& generation_config) {
+        WhisperGenerationConfig config = (generation_config.has_value()) ? *generation_config : m_generation_config;
+
+        // If stop_token_ids were not provided, take value from default m_generation_config
+        if (config.stop_token_ids.empty())
+            config.stop_token_ids = m_generation_config.stop_token_ids;
+        // If eos_token_id was not provided, take value from default m_generation_config
+        if (config.eos_token_id == -1)
+            config.set_eos_token_id(m_generation_config.eos_token_id);
+        config.validate();
+        return config;
+    }
+
+    WhisperDecodedResults decode_result(WhisperGenerateResult& generate_result,
+                                        float tokenization_duration_microseconds,
+                                        std::chrono::steady_clock::time_point start_time) {
         auto decode_start_time = std::chrono::steady_clock::now();
         WhisperDecodedResults result{std::vector{m_tokenizer.decode(generate_result.output_tokens)}, std::vector{1.f}};
         generate_result.perf_metrics.raw_metrics.detokenization_durations.emplace_back(
@@ -176,10 +281,14 @@ public:
         return result;
     }
 
-private:
     ov::InferRequest m_encoder;
+    // encodes the next window of long-form audio while the current one is decoded, created if WHISPER_ENCODER_LOOKAHEAD is set
+    ov::InferRequest m_lookahead_encoder;
     std::shared_ptr<ov::genai::WhisperDecoder> m_decoder;
     Sampler m_sampler;
+    // batches several audio inputs, not created for NPU, which compiles the encoder with static batch 1
+    std::unique_ptr<WhisperBatchedEngine> m_engine;
+    std::unique_ptr<WhisperStreamingSession> m_streaming_session;
 };
 
 std::pair<std::string, Any> generation_config(const WhisperGenerationConfig& config) {
@@ -227,6 +336,47 @@ ov::genai::WhisperDecodedResults ov::genai::WhisperPipeline::generate(const RawS
     return m_impl->generate(raw_speech_input, config, base_streamer);
 }
 
+std::vector<ov::genai::WhisperDecodedResults> ov::genai::WhisperPipeline::generate(
+    const std::vector<RawSpeechInput>& raw_speech_inputs,
+    const std::vector<WhisperGenerationConfig>& generation_configs,
+    const std::vector<StreamerVariant>& streamers) {
+    OPENVINO_ASSERT(generation_configs.empty() || generation_configs.size() == raw_speech_inputs.size(),
+                    "The number of generation configs ",
+                    generation_configs.size(),
+                    " must match the number of raw speech inputs ",
+                    raw_speech_inputs.size());
+    OPENVINO_ASSERT(streamers.empty() || streamers.size() == raw_speech_inputs.size(),
+                    "The number of streamers ",
+                    streamers.size(),
+                    " must match the number of raw speech inputs ",
+                    raw_speech_inputs.size());
+
+    std::vector<WhisperGenerationConfig> configs = generation_configs;
+    if (configs.empty()) {
+        configs.assign(raw_speech_inputs.size(), m_impl->m_generation_config);
+    }
+
+    std::vector<std::shared_ptr<StreamerBase>> base_streamers(raw_speech_inputs.size());
+    for (size_t idx = 0; idx < streamers.size(); idx++) {
+        base_streamers[idx] = utils::create_streamer(streamers[idx], m_impl->m_tokenizer);
+    }
+
+    return m_impl->generate_batch(raw_speech_inputs, configs, base_streamers);
+}
+
+void ov::genai::WhisperPipeline::start_streaming(OptionalWhisperGenerationConfig generation_config,
+                                                float min_update_interval) {
+    m_impl->start_streaming(generation_config, min_update_interval);
+}
+
+ov::genai::WhisperStreamingUpdate ov::genai::WhisperPipeline::push_audio(const RawSpeechInput& raw_speech_input) {
+    return m_impl->push_audio(raw_speech_input);
+}
+
+ov::genai::WhisperStreamingUpdate ov::genai::WhisperPipeline::finish_streaming() {
+    return m_impl->finish_streaming();
+}
+
 ov::genai::WhisperGenerationConfig ov::genai::WhisperPipeline::get_generation_config() const {
     return m_impl->m_generation_config;
 }
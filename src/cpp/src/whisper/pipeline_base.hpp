@@ -30,6 +30,34 @@ public:
                                            OptionalWhisperGenerationConfig generation_config,
                                            const std::shared_ptr<StreamerBase> streamer) = 0;
 
+    /**
+     * @brief Transcribes several audio inputs, one after another unless the pipeline batches them.
+     * @param streamers Streamers of the inputs, nullptr if the input isn't streamed.
+     */
+    virtual std::vector<WhisperDecodedResults> generate_batch(
+        const std::vector<RawSpeechInput>& raw_speech_inputs,
+        const std::vector<WhisperGenerationConfig>& generation_configs,
+        const std::vector<std::shared_ptr<StreamerBase>>& streamers) {
+        std::vector<WhisperDecodedResults> results;
+        results.reserve(raw_speech_inputs.size());
+        for (size_t idx = 0; idx < raw_speech_inputs.size(); idx++) {
+            results.push_back(generate(raw_speech_inputs[idx], generation_configs[idx], streamers[idx]));
+        }
+        return results;
+    }
+
+    virtual void start_streaming(OptionalWhisperGenerationConfig generation_config, float min_update_interval) {
+        OPENVINO_THROW("Streaming of pushed audio is not supported by this Whisper pipeline");
+    }
+
+    virtual WhisperStreamingUpdate push_audio(const RawSpeechInput& raw_speech_input) {
+        OPENVINO_THROW("Streaming of pushed audio is not supported by this Whisper pipeline");
+    }
+
+    virtual WhisperStreamingUpdate finish_streaming() {
+        OPENVINO_THROW("Streaming of pushed audio is not supported by this Whisper pipeline");
+    }
+
     virtual ~WhisperPipelineImplBase() = default;
 };
 
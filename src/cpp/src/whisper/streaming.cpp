@@ -0,0 +1,213 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "whisper/streaming.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+#include "whisper/timestamps.hpp"
+
+namespace ov {
+namespace genai {
+
+WhisperStreamingSession::WhisperStreamingSession(const WhisperGenerationConfig& config,
+                                                 const WhisperContextTokens& context_tokens,
+                                                 const WhisperConfig& model_config,
+                                                 ov::InferRequest& encoder,
+                                                 std::shared_ptr<WhisperDecoder> decoder,
+                                                 WhisperFeatureExtractor& feature_extractor,
+                                                 Sampler& sampler,
+                                                 Tokenizer& tokenizer,
+                                                 float min_update_interval)
+    : m_config(config),
+      m_context_tokens(context_tokens),
+      m_model_config(model_config),
+      m_encoder(encoder),
+      m_decoder(decoder),
+      m_feature_extractor(feature_extractor),
+      m_sampler(sampler),
+      m_tokenizer(tokenizer) {
+    OPENVINO_ASSERT(!m_config.is_beam_search(), "Beam search is not supported by Whisper streaming");
+    OPENVINO_ASSERT(!m_config.word_timestamps, "Word level timestamps are not supported by Whisper streaming");
+    OPENVINO_ASSERT(min_update_interval >= 0.f, "min_update_interval must be non-negative, got ", min_update_interval);
+    OPENVINO_ASSERT(m_feature_extractor.sampling_rate != 0, "Sampling Rate for Feature Extractor is 0");
+    m_min_update_samples = static_cast<size_t>(std::lround(min_update_interval * m_feature_extractor.sampling_rate));
+}
+
+WhisperStreamingUpdate WhisperStreamingSession::push_audio(const RawSpeechInput& raw_speech) {
+    OPENVINO_ASSERT(!m_is_finished, "Audio can't be pushed to a finished Whisper streaming session");
+    m_feature_extractor.extract_incremental(raw_speech, m_features);
+
+    WhisperStreamingUpdate update;
+    if (m_features.n_samples - m_last_update_samples >= m_min_update_samples && m_features.n_samples > 0) {
+        process_window(update, false);
+    }
+    return update;
+}
+
+WhisperStreamingUpdate WhisperStreamingSession::finish() {
+    OPENVINO_ASSERT(!m_is_finished, "Whisper streaming session has already been finished");
+    m_is_finished = true;
+
+    WhisperStreamingUpdate update;
+    process_window(update, true);
+    return update;
+}
+
+void WhisperStreamingSession::process_window(WhisperStreamingUpdate& update, bool is_finished) {
+    m_last_update_samples = m_features.n_samples;
+
+    const size_t nb_max_frames = m_feature_extractor.nb_max_frames;
+    // 0.02 by default
+    const float time_precision = static_cast<float>(m_feature_extractor.chunk_length) / m_model_config.max_source_positions;
+    const float frame_length_in_seconds =
+        static_cast<float>(m_feature_extractor.hop_length) / m_feature_extractor.sampling_rate;
+
+    while (m_window_offset < get_num_audio_frames()) {
+        const size_t num_window_frames = get_num_audio_frames() - m_window_offset;
+        const bool is_window_full = num_window_frames >= nb_max_frames;
+        const float window_time_offset = m_window_offset * frame_length_in_seconds;
+        const float audio_duration = get_audio_duration();
+
+        RawPerfMetrics raw_metrics;
+        raw_metrics.m_inference_durations = {{MicroSeconds(0.0f)}};
+        const std::vector<int64_t> tokens = decode_window_tokens(raw_metrics);
+        auto extracted_segments = extract_segments(tokens, m_config, nb_max_frames, time_precision, window_time_offset);
+        std::vector<Segment>& segments = extracted_segments.segments;
+
+        if (is_window_full || is_finished) {
+            // the segment has started but has no closing timestamp, it lasts till the end of the window
+            for (auto& segment : segments) {
+                if (segment.m_end < 0.f) {
+                    segment.m_end = std::min(window_time_offset + m_feature_extractor.chunk_length, audio_duration);
+                }
+            }
+
+            // the window moves by the last timestamp as in whisper_generate, a finished stream is consumed entirely
+            size_t segment_offset = std::min(num_window_frames, nb_max_frames);
+            if (is_window_full && extracted_segments.last_offset > 0) {
+                segment_offset = std::min(extracted_segments.last_offset, nb_max_frames);
+            }
+            finalize_segments(update, segments.begin(), segments.end(), m_window_offset + segment_offset);
+            m_hypothesis_tokens.clear();
+
+            if (!is_finished && get_num_audio_frames() - m_window_offset < nb_max_frames) {
+                break;
+            }
+            continue;
+        }
+
+        // local agreement of the two last updates
+        const std::vector<int64_t> hypothesis_tokens = get_text_tokens(segments.begin(), segments.end());
+        const size_t num_agreed_tokens =
+            std::mismatch(hypothesis_tokens.begin(),
+                          hypothesis_tokens.end(),
+                          m_hypothesis_tokens.begin(),
+                          m_hypothesis_tokens.end())
+                .first -
+            hypothesis_tokens.begin();
+
+        auto final_segments_end = segments.cbegin();
+        size_t num_final_tokens = 0;
+        for (; final_segments_end != segments.cend(); ++final_segments_end) {
+            const size_t num_segment_tokens = get_text_tokens(final_segments_end, std::next(final_segments_end)).size();
+            // a segment ending after the pushed audio is a hallucination on the padding
+            const bool is_closed = final_segments_end->m_end >= 0.f && final_segments_end->m_end <= audio_duration;
+            if (!is_closed || num_final_tokens + num_segment_tokens > num_agreed_tokens) {
+                break;
+            }
+            num_final_tokens += num_segment_tokens;
+        }
+
+        if (final_segments_end != segments.cbegin()) {
+            const float final_end = std::prev(final_segments_end)->m_end;
+            const size_t frame_offset =
+                m_window_offset + static_cast<size_t>(std::lround((final_end - window_time_offset) / frame_length_in_seconds));
+            finalize_segments(update, segments.cbegin(), final_segments_end, frame_offset);
+        }
+
+        m_hypothesis_tokens.assign(hypothesis_tokens.begin() + num_final_tokens, hypothesis_tokens.end());
+        if (!m_hypothesis_tokens.empty()) {
+            update.partial_chunk =
+                WhisperDecodedResultChunk{final_segments_end->m_start, audio_duration, m_tokenizer.decode(m_hypothesis_tokens)};
+        }
+        break;
+    }
+}
+
+std::vector<int64_t> WhisperStreamingSession::decode_window_tokens(RawPerfMetrics& raw_metrics) {
+    std::vector<float> window = m_feature_extractor.get_window(m_features, m_window_offset);
+    ov::Tensor hidden_state_tensor = encode_window(m_encoder,
+                                                   window,
+                                                   m_feature_extractor.feature_size,
+                                                   m_feature_extractor.nb_max_frames,
+                                                   raw_metrics);
+
+    if (m_sot_tokens.empty()) {
+        int64_t language_token_id = 0;
+        if (requires_language_detection(m_config)) {
+            language_token_id = m_decoder->detect_language(hidden_state_tensor, m_config.decoder_start_token_id).first;
+        }
+        m_sot_tokens = get_sot_tokens(m_config, language_token_id);
+    }
+
+    // the final text replaces the initial prompt once there is some
+    WhisperContextTokens context_tokens = m_context_tokens;
+    if (!m_final_tokens.empty()) {
+        context_tokens.initial_prompt = m_final_tokens;
+    }
+    std::vector<int64_t> prompt_tokens = get_prompt_tokens(context_tokens, m_config, 0);
+    prompt_tokens.insert(prompt_tokens.end(), m_sot_tokens.begin(), m_sot_tokens.end());
+
+    return decode_window(m_decoder, prompt_tokens, hidden_state_tensor, m_sampler, m_config, true, raw_metrics);
+}
+
+void WhisperStreamingSession::finalize_segments(WhisperStreamingUpdate& update,
+                                                std::vector<Segment>::const_iterator begin,
+                                                std::vector<Segment>::const_iterator end,
+                                                size_t frame_offset) {
+    for (auto segment = begin; segment != end; ++segment) {
+        const std::vector<int64_t> text_tokens = get_text_tokens(segment, std::next(segment));
+        if (text_tokens.empty()) {
+            continue;
+        }
+        update.final_chunks.push_back(
+            WhisperDecodedResultChunk{segment->m_start, segment->m_end, m_tokenizer.decode(text_tokens)});
+        m_final_tokens.insert(m_final_tokens.end(), text_tokens.begin(), text_tokens.end());
+    }
+
+    if (m_final_tokens.size() > MAX_PREVIOUS_TEXT_TOKENS) {
+        m_final_tokens.erase(m_final_tokens.begin(), m_final_tokens.end() - MAX_PREVIOUS_TEXT_TOKENS);
+    }
+
+    m_window_offset = std::max(m_window_offset, std::min(frame_offset, get_num_audio_frames()));
+    m_features.discard_frames(m_window_offset);
+}
+
+std::vector<int64_t> WhisperStreamingSession::get_text_tokens(std::vector<Segment>::const_iterator begin,
+                                                              std::vector<Segment>::const_iterator end) const {
+    std::vector<int64_t> text_tokens;
+    for (auto segment = begin; segment != end; ++segment) {
+        // special and timestamp tokens follow the text tokens in Whisper vocabularies
+        std::copy_if(segment->m_tokens.begin(),
+                     segment->m_tokens.end(),
+                     std::back_inserter(text_tokens),
+                     [this](int64_t token) {
+                         return token < m_config.eos_token_id;
+                     });
+    }
+    return text_tokens;
+}
+
+size_t WhisperStreamingSession::get_num_audio_frames() const {
+    return m_features.n_samples / m_feature_extractor.hop_length;
+}
+
+float WhisperStreamingSession::get_audio_duration() const {
+    return static_cast<float>(m_features.n_samples) / m_feature_extractor.sampling_rate;
+}
+
+}  // namespace genai
+}  // namespace ov
@@ -0,0 +1,100 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <openvino/openvino.hpp>
+
+#include "openvino/genai/tokenizer.hpp"
+#include "openvino/genai/whisper_generation_config.hpp"
+#include "openvino/genai/whisper_pipeline.hpp"
+#include "sampling/sampler.hpp"
+#include "whisper/config.hpp"
+#include "whisper/context_tokens.hpp"
+#include "whisper/feature_extractor.hpp"
+#include "whisper/models/decoder.hpp"
+#include "whisper/whisper.hpp"
+
+namespace ov {
+namespace genai {
+
+/**
+ * @brief Transcribes audio pushed piece by piece.
+ * Log-mel frames are computed incrementally as samples arrive. Once min_update_interval of new audio has been pushed,
+ * the window of up to 30 seconds starting after the final chunks is encoded and decoded with timestamps again.
+ * Leading segments of the window become final by local agreement: when their tokens are a common prefix of the
+ * tokens decoded by two consecutive updates, and they end before the pushed audio ends. The window then starts at
+ * the end of the last final segment and its frames before are released. The tail of the final tokens is passed as
+ * the previous text prompt of the next windows. Once the window is full, or the stream is finished, its segments
+ * become final as in whisper_generate and the window moves by the last timestamp.
+ */
+class WhisperStreamingSession {
+public:
+    // the number of last final tokens passed as the previous text prompt of a window
+    static constexpr size_t MAX_PREVIOUS_TEXT_TOKENS = 64;
+
+    /**
+     * @param config Validated generation config of the session, beam search is not supported.
+     * @param min_update_interval The minimal duration of new audio in seconds, which triggers decoding of the window.
+     */
+    WhisperStreamingSession(const WhisperGenerationConfig& config,
+                            const WhisperContextTokens& context_tokens,
+                            const WhisperConfig& model_config,
+                            ov::InferRequest& encoder,
+                            std::shared_ptr<WhisperDecoder> decoder,
+                            WhisperFeatureExtractor& feature_extractor,
+                            Sampler& sampler,
+                            Tokenizer& tokenizer,
+                            float min_update_interval);
+
+    WhisperStreamingUpdate push_audio(const RawSpeechInput& raw_speech);
+
+    WhisperStreamingUpdate finish();
+
+private:
+    // decodes the window, all of its segments become final if the window is full or the stream is finished
+    void process_window(WhisperStreamingUpdate& update, bool is_finished);
+
+    std::vector<int64_t> decode_window_tokens(RawPerfMetrics& raw_metrics);
+
+    // makes segments final and moves the window to frame_offset
+    void finalize_segments(WhisperStreamingUpdate& update,
+                           std::vector<Segment>::const_iterator begin,
+                           std::vector<Segment>::const_iterator end,
+                           size_t frame_offset);
+
+    // text tokens of the segments without timestamps and special tokens
+    std::vector<int64_t> get_text_tokens(std::vector<Segment>::const_iterator begin,
+                                         std::vector<Segment>::const_iterator end) const;
+
+    size_t get_num_audio_frames() const;
+
+    float get_audio_duration() const;
+
+    WhisperGenerationConfig m_config;
+    WhisperContextTokens m_context_tokens;
+    WhisperConfig m_model_config;
+    ov::InferRequest& m_encoder;
+    std::shared_ptr<WhisperDecoder> m_decoder;
+    WhisperFeatureExtractor& m_feature_extractor;
+    Sampler& m_sampler;
+    Tokenizer& m_tokenizer;
+    size_t m_min_update_samples;
+
+    WhisperIncrementalFeatures m_features;
+    size_t m_last_update_samples = 0;
+    // the first frame of the window, the audio before it is transcribed by the final chunks
+    size_t m_window_offset = 0;
+    // prepared once for the whole stream, the language is detected from the first window
+    std::vector<int64_t> m_sot_tokens;
+    std::vector<int64_t> m_final_tokens;
+    // text tokens of the non final segments decoded by the previous update
+    std::vector<int64_t> m_hypothesis_tokens;
+    bool m_is_finished = false;
+};
+
+}  // namespace genai
+}  // namespace ov
@@ -6,6 +6,7 @@
 #include <iostream>
 #include <openvino/openvino.hpp>
 #include <thread>
+#include <utility>
 
 #include "openvino/genai/perf_metrics.hpp"
 #include "openvino/genai/streamer_base.hpp"
@@ -27,27 +28,6 @@ using ov::genai::MicroSeconds;
 
 namespace {
 
-void process_whisper_logits(ov::Tensor logits,
-                            const ov::genai::WhisperGenerationConfig& config,
-                            const bool return_timestamps,
-                            const std::map<size_t, std::vector<int64_t>>& batch_to_generated_ids) {
-    const bool initial_step = batch_to_generated_ids.empty();
-    const size_t batch_size = logits.get_shape().at(0);
-
-    for (size_t batch = 0; batch < batch_size; batch++) {
-        if (initial_step) {
-            ov::genai::do_suppress_tokens(logits, batch, config.begin_suppress_tokens);
-        }
-
-        ov::genai::do_suppress_tokens(logits, batch, config.suppress_tokens);
-
-        if (return_timestamps) {
-            const auto& generated_ids = initial_step ? std::vector<int64_t>{} : batch_to_generated_ids.at(batch);
-            ov::genai::process_whisper_timestamp_logits(logits, batch, config, generated_ids, initial_step);
-        }
-    }
-}
-
 std::pair<ov::genai::EncodedResults, bool> decode(std::shared_ptr<ov::genai::WhisperDecoder> decoder,
                                                   const std::vector<int64_t>& input_ids,
                                                   const ov::Tensor& encoder_hidden_state,
@@ -96,7 +76,7 @@ std::pair<ov::genai::EncodedResults, bool> decode(std::shared_ptr<ov::genai::Whi
     raw_metrics.m_new_token_times.emplace_back(infer_end);
     raw_metrics.m_batch_sizes.emplace_back(batch_size);
 
-    process_whisper_logits(logits, config, return_timestamps, {});
+    ov::genai::process_whisper_batch_logits(logits, config, return_timestamps, {});
 
     // sample last token only
     int64_t output_sequence_len = logits.get_shape().at(1);
@@ -168,7 +148,7 @@ std::pair<ov::genai::EncodedResults, bool> decode(std::shared_ptr<ov::genai::Whi
         raw_metrics.m_new_token_times.emplace_back(infer_end);
         raw_metrics.m_batch_sizes.emplace_back(total_num_tokens);
 
-        process_whisper_logits(logits, config, return_timestamps, batch_to_generated_ids);
+        ov::genai::process_whisper_batch_logits(logits, config, return_timestamps, batch_to_generated_ids);
 
         sampler.sample({sequence_group}, logits);
     }
@@ -201,11 +181,10 @@ std::pair<ov::genai::EncodedResults, bool> decode(std::shared_ptr<ov::genai::Whi
     return {results, (sequence_group->handle_stopped() || sequence_group->handle_cancelled())};
 }
 
-ov::Tensor encode(ov::InferRequest& request,
-                  std::vector<float>& mel_data,
-                  const size_t feature_size,
-                  const size_t nb_max_frames,
-                  ov::genai::RawPerfMetrics& raw_metrics) {
+void set_input_features(ov::InferRequest& request,
+                        std::vector<float>& mel_data,
+                        const size_t feature_size,
+                        const size_t nb_max_frames) {
     OPENVINO_ASSERT(mel_data.size() == feature_size * nb_max_frames,
                     "Mel spectrogram required size: ",
                     feature_size,
@@ -217,39 +196,127 @@ ov::Tensor encode(ov::InferRequest& request,
     ov::Tensor input_tensor(ov::element::f32, {1, feature_size, nb_max_frames}, mel_data.data());
 
     request.set_tensor("input_features", input_tensor);
+}
+
+void reset_input_features(ov::InferRequest& request, const size_t feature_size, const size_t nb_max_frames) {
+    auto devices = request.get_compiled_model().get_property(ov::execution_devices);
+    OPENVINO_ASSERT(devices.size() > 0, "No execution devices found!");
+    size_t batch_size = (devices[0] == "NPU") ? 1 : 0;
+    request.set_tensor("input_features", ov::Tensor(ov::element::f32, {batch_size, feature_size, nb_max_frames}));
+}
+
+ov::Tensor encode(ov::InferRequest& request,
+                  std::vector<float>& mel_data,
+                  const size_t feature_size,
+                  const size_t nb_max_frames,
+                  ov::genai::RawPerfMetrics& raw_metrics) {
+    set_input_features(request, mel_data, feature_size, nb_max_frames);
 
     const auto infer_start = std::chrono::steady_clock::now();
     request.infer();
     const auto infer_ms = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start);
     raw_metrics.m_inference_durations[0] += MicroSeconds(infer_ms);
 
-    // reset input tensor
-    auto devices = request.get_compiled_model().get_property(ov::execution_devices);
-    OPENVINO_ASSERT(devices.size() > 0, "No execution devices found!");
-    size_t batch_size = (devices[0] == "NPU") ? 1 : 0;
-    request.set_tensor("input_features", ov::Tensor(ov::element::f32, {batch_size, feature_size, nb_max_frames}));
+    reset_input_features(request, feature_size, nb_max_frames);
 
     return request.get_tensor("last_hidden_state");
 }
 
+/**
+ * @brief Speculatively encodes the window following the one being decoded on a second encoder request.
+ * The window is taken at the nominal offset of the next chunk, which is reused if the decoded chunk ends at its
+ * boundary. The input features are kept alive until the inference has finished.
+ */
+class EncoderLookahead {
+public:
+    EncoderLookahead(const size_t feature_size, const size_t nb_max_frames)
+        : m_feature_size(feature_size),
+          m_nb_max_frames(nb_max_frames) {}
+
+    ~EncoderLookahead() {
+        if (m_request) {
+            try {
+                m_request->wait();
+                reset_input_features(*m_request, m_feature_size, m_nb_max_frames);
+            } catch (...) {
+            }
+        }
+    }
+
+    bool is_running() const {
+        return m_request != nullptr;
+    }
+
+    void start(ov::InferRequest& request, std::vector<float> input_features, const size_t chunk_offset) {
+        OPENVINO_ASSERT(!is_running(), "Encoder lookahead is already running");
+        m_input_features = std::move(input_features);
+        set_input_features(request, m_input_features, m_feature_size, m_nb_max_frames);
+        request.start_async();
+        m_request = &request;
+        m_chunk_offset = chunk_offset;
+    }
+
+    /**
+     * @brief Waits for the inference, only the time the caller is blocked is added to the inference duration.
+     * @return Offset of the encoded window.
+     */
+    size_t wait(ov::genai::RawPerfMetrics& raw_metrics) {
+        OPENVINO_ASSERT(is_running(), "Encoder lookahead isn't running");
+        ov::InferRequest& request = *m_request;
+        m_request = nullptr;
+
+        const auto wait_start = std::chrono::steady_clock::now();
+        request.wait();
+        const auto wait_ms = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - wait_start);
+        raw_metrics.m_inference_durations[0] += MicroSeconds(wait_ms);
+
+        reset_input_features(request, m_feature_size, m_nb_max_frames);
+        return m_chunk_offset;
+    }
+
+private:
+    size_t m_feature_size;
+    size_t m_nb_max_frames;
+    ov::InferRequest* m_request = nullptr;
+    std::vector<float> m_input_features;
+    size_t m_chunk_offset = 0;
+};
+
 std::vector<int64_t> prepare_sot_tokens(ov::Tensor& encoder_hidden_state,
                                         std::shared_ptr<ov::genai::WhisperDecoder> decoder,
                                         const ov::genai::WhisperGenerationConfig& config,
                                         ov::genai::RawPerfMetrics& raw_metrics) {
+    int64_t language_token_id = 0;
+    if (ov::genai::requires_language_detection(config)) {
+        auto [language_token, infer_ms] = decoder->detect_language(encoder_hidden_state, config.decoder_start_token_id);
+        language_token_id = language_token;
+        raw_metrics.m_inference_durations[0] += MicroSeconds(infer_ms);
+    }
+
+    return ov::genai::get_sot_tokens(config, language_token_id);
+}
+
+}  // namespace
+
+namespace ov {
+namespace genai {
+
+bool requires_language_detection(const WhisperGenerationConfig& config) {
+    return config.is_multilingual && !config.language.has_value();
+}
+
+std::vector<int64_t> get_sot_tokens(const WhisperGenerationConfig& config, const int64_t detected_language_token_id) {
     if (!config.is_multilingual) {
         return std::vector<int64_t>{config.decoder_start_token_id};
     }
 
-    int64_t language_token_id = 0;
+    int64_t language_token_id = detected_language_token_id;
     if (config.language.has_value()) {
+        language_token_id = 0;
         std::string language = *config.language;
         if (config.lang_to_id.count(language)) {
             language_token_id = config.lang_to_id.at(language);
         }
-    } else {
-        auto [language_token, infer_ms] = decoder->detect_language(encoder_hidden_state, config.decoder_start_token_id);
-        language_token_id = language_token;
-        raw_metrics.m_inference_durations[0] += MicroSeconds(infer_ms);
     }
 
     int64_t task_token_id = config.transcribe_token_id;
@@ -260,10 +327,34 @@ std::vector<int64_t> prepare_sot_tokens(ov::Tensor& encoder_hidden_state,
     return std::vector<int64_t>{config.decoder_start_token_id, language_token_id, task_token_id};
 }
 
-}  // namespace
+ov::Tensor encode_window(ov::InferRequest& encoder,
+                         std::vector<float>& mel_data,
+                         const size_t feature_size,
+                         const size_t nb_max_frames,
+                         RawPerfMetrics& raw_metrics) {
+    return encode(encoder, mel_data, feature_size, nb_max_frames, raw_metrics);
+}
 
-namespace ov {
-namespace genai {
+std::vector<int64_t> decode_window(std::shared_ptr<WhisperDecoder> decoder,
+                                   const std::vector<int64_t>& prompt_tokens,
+                                   const ov::Tensor& encoder_hidden_state,
+                                   Sampler& sampler,
+                                   const WhisperGenerationConfig& config,
+                                   const bool return_timestamps,
+                                   RawPerfMetrics& raw_metrics) {
+    SequenceGroup::Ptr sequence_group = std::make_shared<SequenceGroup>(0, prompt_tokens, config, 1);
+    auto [result, cancelled] = decode(decoder,
+                                      prompt_tokens,
+                                      encoder_hidden_state,
+                                      nullptr,
+                                      sampler,
+                                      sequence_group,
+                                      return_timestamps,
+                                      config,
+                                      raw_metrics);
+    decoder->reset_state();
+    return result.tokens[0];
+}
 
 WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig& config,
                                        const ov::genai::WhisperConfig& model_config,
@@ -274,7 +365,8 @@ WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig&
                                        WhisperFeatureExtractor& feature_extractor,
                                        const std::shared_ptr<StreamerBase> streamer,
                                        Sampler& sampler,
-                                       Tokenizer& tokenizer) {
+                                       Tokenizer& tokenizer,
+                                       ov::InferRequest* lookahead_encoder) {
     size_t max_new_tokens = config.get_max_new_tokens();
 
     WhisperGenerateResult result;
@@ -308,16 +400,34 @@ WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig&
     const float frame_length_in_seconds =
         static_cast<float>(feature_extractor.hop_length) / feature_extractor.sampling_rate;
 
+    // the chunk is encoded by the first request, the next one is encoded by the second request meanwhile
+    ov::InferRequest* chunk_encoder = &encoder;
+    EncoderLookahead lookahead(feature_extractor.feature_size, feature_extractor.nb_max_frames);
+
     for (size_t chunk_offset = 0; chunk_offset < input_features.n_frames; chunk_offset += segment_offset) {
         const float chunk_time_offset = chunk_offset * frame_length_in_seconds;
 
-        auto input_features_chunk = input_features.get_data_with_offset(chunk_offset, feature_extractor.nb_max_frames);
+        ov::Tensor hidden_state_tensor;
+        if (lookahead.is_running() && lookahead.wait(raw_metrics) == chunk_offset) {
+            std::swap(chunk_encoder, lookahead_encoder);
+            hidden_state_tensor = chunk_encoder->get_tensor("last_hidden_state");
+        } else {
+            auto input_features_chunk =
+                input_features.get_data_with_offset(chunk_offset, feature_extractor.nb_max_frames);
+
+            hidden_state_tensor = encode(*chunk_encoder,
+                                         input_features_chunk,
+                                         feature_extractor.feature_size,
+                                         feature_extractor.nb_max_frames,
+                                         raw_metrics);
+        }
 
-        ov::Tensor hidden_state_tensor = encode(encoder,
-                                                input_features_chunk,
-                                                feature_extractor.feature_size,
-                                                feature_extractor.nb_max_frames,
-                                                raw_metrics);
+        const size_t next_chunk_offset = chunk_offset + feature_extractor.nb_max_frames;
+        if (lookahead_encoder && next_chunk_offset < input_features.n_frames) {
+            lookahead.start(*lookahead_encoder,
+                            input_features.get_data_with_offset(next_chunk_offset, feature_extractor.nb_max_frames),
+                            next_chunk_offset);
+        }
 
         // prepare sot_tokens just once for whole input
         if (sot_tokens.empty()) {
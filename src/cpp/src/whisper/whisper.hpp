@@ -31,6 +31,46 @@ struct WhisperGenerateResult {
     WhisperPerfMetrics perf_metrics;
 };
 
+/**
+ * @brief Whether the language token of the sot tokens has to be detected from the audio.
+ */
+bool requires_language_detection(const WhisperGenerationConfig& config);
+
+/**
+ * @brief Prepares the start of transcript tokens: decoder start, language and task tokens.
+ * @param detected_language_token_id Language token used if requires_language_detection() is true for the config.
+ */
+std::vector<int64_t> get_sot_tokens(const WhisperGenerationConfig& config, const int64_t detected_language_token_id = 0);
+
+/**
+ * @brief Encodes a window of log-mel frames.
+ * @param mel_data Flattened [feature_size, nb_max_frames] log-mel spectrogram of the window.
+ * @return Encoder hidden states, valid until the next inference of the encoder.
+ */
+ov::Tensor encode_window(ov::InferRequest& encoder,
+                         std::vector<float>& mel_data,
+                         const size_t feature_size,
+                         const size_t nb_max_frames,
+                         RawPerfMetrics& raw_metrics);
+
+/**
+ * @brief Decodes tokens of an encoded window without streaming and resets the decoder state.
+ * @param prompt_tokens Context and sot tokens the decoding starts from.
+ * @return Generated tokens including timestamps if return_timestamps is true.
+ */
+std::vector<int64_t> decode_window(std::shared_ptr<WhisperDecoder> decoder,
+                                   const std::vector<int64_t>& prompt_tokens,
+                                   const ov::Tensor& encoder_hidden_state,
+                                   Sampler& sampler,
+                                   const WhisperGenerationConfig& config,
+                                   const bool return_timestamps,
+                                   RawPerfMetrics& raw_metrics);
+
+/**
+ * @brief Transcribes the audio by 30 seconds chunks.
+ * @param lookahead_encoder Optional second request of the encoder. If set, the window following the chunk being
+ * decoded is encoded on it at the nominal offset of the next chunk, and is reused if the chunk ends at its boundary.
+ */
 WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig& config,
                                        const ov::genai::WhisperConfig& model_config,
                                        const WhisperContextTokens& context_tokens,
@@ -40,7 +80,8 @@ WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig&
                                        WhisperFeatureExtractor& feature_extractor,
                                        const std::shared_ptr<StreamerBase> streamer,
                                        Sampler& sampler,
-                                       Tokenizer& tokenizer);
+                                       Tokenizer& tokenizer,
+                                       ov::InferRequest* lookahead_encoder = nullptr);
 
 }  // namespace genai
 }  // namespace ov
@@ -359,6 +359,25 @@ export type GenericGenerationConfig = {
   stop_token_ids?: Set<Uint>;
 };
 
+export type SchedulingGenerationConfig = {
+  /** priority class of the request, requests with higher values are scheduled and kept running first.
+   * Used by continuous batching pipelines only.
+   *
+   * @type Uses `number` whenever possible; if an integer value is too large for `number`, `bigint` is returned.
+   * Maximum value is `2^32 - 1` on 32-bit systems and `2^64 - 1` on 64-bit systems. */
+  priority?: Uint;
+  /** time to first token target in milliseconds, 0 means no target.
+   *
+   * @type Uses `number` whenever possible; if an integer value is too large for `number`, `bigint` is returned.
+   * Maximum value is `2^32 - 1` on 32-bit systems and `2^64 - 1` on 64-bit systems. */
+  ttft_deadline_ms?: Uint;
+  /** time per output token target in milliseconds, 0 means no target.
+   *
+   * @type Uses `number` whenever possible; if an integer value is too large for `number`, `bigint` is returned.
+   * Maximum value is `2^32 - 1` on 32-bit systems and `2^64 - 1` on 64-bit systems. */
+  tpot_deadline_ms?: Uint;
+};
+
 export type StructuredOutputGenerationConfig = {
   /** This object is used to store the configuration for structured generation, which includes
    * the JSON schema and other related parameters. */
@@ -375,6 +394,7 @@ export type GenerationConfig = GenericGenerationConfig &
   RandomSamplingsGenerationConfig &
   CDPrunerGenerationConfig &
   AssistingGenerationConfig &
+  SchedulingGenerationConfig &
   StructuredOutputGenerationConfig &
   ParserGenerationConfig;
 
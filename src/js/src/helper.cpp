@@ -1369,6 +1369,11 @@ Napi::Value cpp_to_js<ov::genai::GenerationConfig, Napi::Value>(const Napi::Env&
     // set to true if chat template should be applied for non-chat scenarios, set to false otherwise
     obj.Set("apply_chat_template", Napi::Boolean::New(env, config.apply_chat_template));
 
+    // Scheduling parameters
+    obj.Set("priority", cpp_to_js<size_t, Napi::Value>(env, config.priority));
+    obj.Set("ttft_deadline_ms", cpp_to_js<size_t, Napi::Value>(env, config.ttft_deadline_ms));
+    obj.Set("tpot_deadline_ms", cpp_to_js<size_t, Napi::Value>(env, config.tpot_deadline_ms));
+
     return obj;
 }
 
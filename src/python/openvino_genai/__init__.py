@@ -47,6 +47,7 @@ from .py_openvino_genai import (
 # LLM pipeline
 from .py_openvino_genai import (
     LLMPipeline,
+    SessionState,
     draft_model,
 )
 
@@ -95,8 +96,10 @@ from .py_openvino_genai import (
     CppStdGenerator,
     TorchGenerator,
     ImageGenerationPerfMetrics,
+    ImageGenerationResult,
     RawImageGenerationPerfMetrics,
     TaylorSeerCacheConfig,
+    VAETilingConfig,
 )
 
 # Video generation
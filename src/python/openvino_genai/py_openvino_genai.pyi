@@ -5,7 +5,7 @@ from __future__ import annotations
 import collections.abc
 import openvino._pyopenvino
 import typing
-__all__: list[str] = ['Adapter', 'AdapterConfig', 'AdaptiveRKVConfig', 'AggregationMode', 'AutoencoderKL', 'AutoencoderKLLTXVideo', 'CLIPTextModel', 'CLIPTextModelWithProjection', 'CacheEvictionConfig', 'ChatHistory', 'ContinuousBatchingPipeline', 'CppStdGenerator', 'DecodedResults', 'DeepSeekR1ReasoningIncrementalParser', 'DeepSeekR1ReasoningParser', 'EncodedGenerationResult', 'EncodedResults', 'ExtendedPerfMetrics', 'FluxTransformer2DModel', 'GenerationConfig', 'GenerationFinishReason', 'GenerationHandle', 'GenerationOutput', 'GenerationResult', 'GenerationStatus', 'Generator', 'Image2ImagePipeline', 'ImageGenerationConfig', 'ImageGenerationPerfMetrics', 'IncrementalParser', 'InpaintingPipeline', 'KVCrushAnchorPointMode', 'KVCrushConfig', 'LLMPipeline', 'LTXVideoTransformer3DModel', 'Llama3JsonToolParser', 'Llama3PythonicToolParser', 'MeanStdPair', 'Parser', 'PerfMetrics', 'Phi4ReasoningIncrementalParser', 'Phi4ReasoningParser', 'PipelineMetrics', 'RawImageGenerationPerfMetrics', 'RawPerfMetrics', 'ReasoningIncrementalParser', 'ReasoningParser', 'SD3Transformer2DModel', 'SDPerModelsPerfMetrics', 'SDPerfMetrics', 'Scheduler', 'SchedulerConfig', 'SparseAttentionConfig', 'SparseAttentionMode', 'SpeechGenerationConfig', 'SpeechGenerationPerfMetrics', 'StopCriteria', 'StreamerBase', 'StreamingStatus', 'StructuralTagItem', 'StructuralTagsConfig', 'StructuredOutputConfig', 'SummaryStats', 'T5EncoderModel', 'TaylorSeerCacheConfig', 'Text2ImagePipeline', 'Text2SpeechDecodedResults', 'Text2SpeechPipeline', 'Text2VideoPipeline', 'TextEmbeddingPipeline', 'TextParserStreamer', 'TextRerankPipeline', 'TextStreamer', 'TokenizedInputs', 'Tokenizer', 'TorchGenerator', 'UNet2DConditionModel', 'VLLMParserWrapper', 'VLMDecodedResults', 'VLMPerfMetrics', 'VLMPipeline', 'VLMRawPerfMetrics', 'VideoGenerationConfig', 'VideoGenerationPerfMetrics', 'VideoGenerationResult', 'WhisperDecodedResultChunk', 'WhisperDecodedResults', 'WhisperGenerationConfig', 'WhisperPerfMetrics', 'WhisperPipeline', 'WhisperRawPerfMetrics', 'WhisperWordTiming', 'draft_model', 'get_version']
+__all__: list[str] = ['Adapter', 'AdapterConfig', 'AdaptiveRKVConfig', 'AggregationMode', 'AutoencoderKL', 'AutoencoderKLLTXVideo', 'CLIPTextModel', 'CLIPTextModelWithProjection', 'CacheEvictionConfig', 'ChatHistory', 'ContinuousBatchingPipeline', 'CppStdGenerator', 'DecodedResults', 'DeepSeekR1ReasoningIncrementalParser', 'DeepSeekR1ReasoningParser', 'EncodedGenerationResult', 'EncodedResults', 'ExtendedPerfMetrics', 'FluxTransformer2DModel', 'GenerationConfig', 'GenerationFinishReason', 'GenerationHandle', 'GenerationOutput', 'GenerationResult', 'GenerationStatus', 'Generator', 'Image2ImagePipeline', 'ImageGenerationConfig', 'ImageGenerationPerfMetrics', 'ImageGenerationResult', 'IncrementalParser', 'InpaintingPipeline', 'KVCrushAnchorPointMode', 'KVCrushConfig', 'LLMPipeline', 'LTXVideoTransformer3DModel', 'Llama3JsonToolParser', 'Llama3PythonicToolParser', 'MeanStdPair', 'Parser', 'PerfMetrics', 'Phi4ReasoningIncrementalParser', 'Phi4ReasoningParser', 'PipelineMetrics', 'PriorityClassMetrics', 'RawImageGenerationPerfMetrics', 'RawPerfMetrics', 'ReasoningIncrementalParser', 'ReasoningParser', 'SD3Transformer2DModel', 'SDPerModelsPerfMetrics', 'SDPerfMetrics', 'Scheduler', 'SchedulerConfig', 'SessionState', 'SparseAttentionConfig', 'SparseAttentionMode', 'SpeechGenerationConfig', 'SpeechGenerationPerfMetrics', 'StopCriteria', 'StreamerBase', 'StreamingStatus', 'StructuralTagItem', 'StructuralTagsConfig', 'StructuredOutputConfig', 'SummaryStats', 'T5EncoderModel', 'TaylorSeerCacheConfig', 'Text2ImagePipeline', 'Text2SpeechDecodedResults', 'Text2SpeechPipeline', 'Text2VideoPipeline', 'TextEmbeddingPipeline', 'TextParserStreamer', 'TextRerankPipeline', 'TextStreamer', 'TokenizedInputs', 'Tokenizer', 'TorchGenerator', 'UNet2DConditionModel', 'VAETilingConfig', 'VLLMParserWrapper', 'VLMDecodedResults', 'VLMPerfMetrics', 'VLMPipeline', 'VLMRawPerfMetrics', 'VideoGenerationConfig', 'VideoGenerationPerfMetrics', 'VideoGenerationResult', 'WhisperDecodedResultChunk', 'WhisperDecodedResults', 'WhisperGenerationConfig', 'WhisperPerfMetrics', 'WhisperPipeline', 'WhisperRawPerfMetrics', 'WhisperStreamingUpdate', 'WhisperWordTiming', 'draft_model', 'get_version']
 class Adapter:
     """
     Immutable LoRA Adapter that carries the adaptation matrices and serves as unique adapter identifier.
@@ -299,9 +299,9 @@ class AutoencoderKL:
                         device (str): Device to run the model on (e.g., CPU, GPU).
                         kwargs: Device properties.
         """
-    def decode(self, latent: openvino._pyopenvino.Tensor) -> openvino._pyopenvino.Tensor:
+    def decode(self, latent: openvino._pyopenvino.Tensor, tiling_config: VAETilingConfig | None = None) -> openvino._pyopenvino.Tensor:
         ...
-    def encode(self, image: openvino._pyopenvino.Tensor, generator: Generator) -> openvino._pyopenvino.Tensor:
+    def encode(self, image: openvino._pyopenvino.Tensor, generator: Generator, tiling_config: VAETilingConfig | None = None) -> openvino._pyopenvino.Tensor:
         ...
     def export_model(self, export_path: os.PathLike | str | bytes) -> None:
         """
@@ -383,10 +383,11 @@ class AutoencoderKLLTXVideo:
                         device (str): Device to run the model on (e.g., CPU, GPU).
                         kwargs: Device properties.
         """
-    def decode(self, latent: openvino._pyopenvino.Tensor) -> openvino._pyopenvino.Tensor:
+    def decode(self, latent: openvino._pyopenvino.Tensor, tiling_config: VAETilingConfig | None = None) -> openvino._pyopenvino.Tensor:
         """
                         Decodes latent video to pixel space.
                         latent (ov.Tensor): Latent video tensor.
+                        tiling_config (VAETilingConfig | None): Enables decoding by overlapping spatial and temporal tiles.
                         Returns: Decoded video tensor.
         """
     def get_config(self) -> AutoencoderKLLTXVideo.Config:
@@ -1071,6 +1072,11 @@ class GenerationConfig:
         top_k:              the number of highest probability vocabulary tokens to keep for top-k-filtering.
         do_sample:          whether or not to use multinomial random sampling that add up to `top_p` or higher are kept.
         num_return_sequences: the number of sequences to generate from a single prompt.
+    
+        Scheduling parameters (continuous batching only):
+        priority:           priority class of the request, requests with higher values are scheduled and kept running first.
+        ttft_deadline_ms:   time to first token target in milliseconds, 0 means no target.
+        tpot_deadline_ms:   time per output token target in milliseconds, 0 means no target.
     """
     adapters: openvino_genai.py_openvino_genai.AdapterConfig | None
     apply_chat_template: bool
@@ -1207,6 +1213,12 @@ class GenerationConfig:
     def presence_penalty(self, arg0: typing.SupportsFloat) -> None:
         ...
     @property
+    def priority(self) -> int:
+        ...
+    @priority.setter
+    def priority(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
     def pruning_ratio(self) -> int:
         ...
     @pruning_ratio.setter
@@ -1260,6 +1272,18 @@ class GenerationConfig:
     @top_p.setter
     def top_p(self, arg0: typing.SupportsFloat) -> None:
         ...
+    @property
+    def tpot_deadline_ms(self) -> int:
+        ...
+    @tpot_deadline_ms.setter
+    def tpot_deadline_ms(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def ttft_deadline_ms(self) -> int:
+        ...
+    @ttft_deadline_ms.setter
+    def ttft_deadline_ms(self, arg0: typing.SupportsInt) -> None:
+        ...
 class GenerationFinishReason:
     """
     Members:
@@ -1547,6 +1571,7 @@ class ImageGenerationConfig:
     prompt_2: str | None
     prompt_3: str | None
     taylorseer_config: openvino_genai.py_openvino_genai.TaylorSeerCacheConfig | None
+    vae_tiling_config: openvino_genai.py_openvino_genai.VAETilingConfig | None
     def __init__(self) -> None:
         ...
     def update_generation_config(self, **kwargs) -> None:
@@ -1708,6 +1733,16 @@ class IncrementalParser:
         """
         Set the current streaming status of the parser.
         """
+class ImageGenerationResult:
+    """
+    Image(s) generated for a prompt of a batched generate() call.
+    """
+    @property
+    def image(self) -> openvino._pyopenvino.Tensor:
+        ...
+    @property
+    def perf_metrics(self) -> ImageGenerationPerfMetrics:
+        ...
 class InpaintingPipeline:
     """
     This class is used for generation with inpainting models.
@@ -1960,6 +1995,11 @@ class LLMPipeline:
             top_k:              the number of highest probability vocabulary tokens to keep for top-k-filtering.
             do_sample:          whether or not to use multinomial random sampling that add up to `top_p` or higher are kept.
             num_return_sequences: the number of sequences to generate from a single prompt.
+        
+            Scheduling parameters (continuous batching only):
+            priority:           priority class of the request, requests with higher values are scheduled and kept running first.
+            ttft_deadline_ms:   time to first token target in milliseconds, 0 means no target.
+            tpot_deadline_ms:   time per output token target in milliseconds, 0 means no target.
         """
     @typing.overload
     def __init__(self, models_path: os.PathLike | str | bytes, tokenizer: Tokenizer, device: str, config: collections.abc.Mapping[str, typing.Any] = {}, **kwargs) -> None:
@@ -2057,11 +2097,24 @@ class LLMPipeline:
             top_k:              the number of highest probability vocabulary tokens to keep for top-k-filtering.
             do_sample:          whether or not to use multinomial random sampling that add up to `top_p` or higher are kept.
             num_return_sequences: the number of sequences to generate from a single prompt.
+        
+            Scheduling parameters (continuous batching only):
+            priority:           priority class of the request, requests with higher values are scheduled and kept running first.
+            ttft_deadline_ms:   time to first token target in milliseconds, 0 means no target.
+            tpot_deadline_ms:   time per output token target in milliseconds, 0 means no target.
         """
     def get_generation_config(self) -> GenerationConfig:
         ...
     def get_tokenizer(self) -> Tokenizer:
         ...
+    def restore_session(self, session: SessionState) -> None:
+        """
+        Restores a chat session saved by save_session() of this pipeline, replacing the current one. Restoring an empty SessionState starts a new chat.
+        """
+    def save_session(self) -> SessionState:
+        """
+        Saves the current chat session: the chat history and a copy of the KV cache. Supported by the stateful pipeline only.
+        """
     def set_generation_config(self, config: GenerationConfig) -> None:
         ...
     def start_chat(self, system_message: str = '') -> None:
@@ -2299,6 +2352,9 @@ class PipelineMetrics:
           This value represents reserved/allocated memory for the KV cache and does not
           distinguish between used and unused portions in dynamic KV cache configurations.
         :type kv_cache_size_in_bytes: int
+    
+        :param priority_classes: Latency statistics per priority class, keyed by GenerationConfig.priority.
+        :type priority_classes: dict[int, PriorityClassMetrics]
     """
     def __init__(self) -> None:
         ...
@@ -2315,11 +2371,57 @@ class PipelineMetrics:
     def max_cache_usage(self) -> float:
         ...
     @property
+    def priority_classes(self) -> dict[int, PriorityClassMetrics]:
+        ...
+    @property
     def requests(self) -> int:
         ...
     @property
     def scheduled_requests(self) -> int:
         ...
+class PriorityClassMetrics:
+    """
+    
+        Latency statistics of the requests sharing the same GenerationConfig.priority, aggregated throughout the lifetime of the pipeline.
+    
+        :param requests: Number of requests of the class to be processed by the pipeline.
+        :type requests: int
+    
+        :param finished_requests: Number of requests of the class which finished generation.
+        :type finished_requests: int
+    
+        :param avg_ttft: Average time to first token of the finished requests in milliseconds.
+        :type avg_ttft: float
+    
+        :param avg_tpot: Average time per output token of the finished requests in milliseconds.
+        :type avg_tpot: float
+    
+        :param ttft_deadline_misses: Number of finished requests which produced the first token later than their ttft_deadline_ms.
+        :type ttft_deadline_misses: int
+    
+        :param tpot_deadline_misses: Number of generation steps of the finished requests which produced tokens later than tpot_deadline_ms after the previous ones.
+        :type tpot_deadline_misses: int
+    """
+    def __init__(self) -> None:
+        ...
+    @property
+    def avg_tpot(self) -> float:
+        ...
+    @property
+    def avg_ttft(self) -> float:
+        ...
+    @property
+    def finished_requests(self) -> int:
+        ...
+    @property
+    def requests(self) -> int:
+        ...
+    @property
+    def tpot_deadline_misses(self) -> int:
+        ...
+    @property
+    def ttft_deadline_misses(self) -> int:
+        ...
 class RawImageGenerationPerfMetrics:
     """
     
@@ -2633,6 +2735,9 @@ class SchedulerConfig:
         cache_size:                 total size of KV cache in GB.
         block_size:                 block size for KV cache.
         dynamic_split_fuse:         whether to split prompt / generate to different scheduling phases.
+        max_prompt_chunk_size:      Maximum number of prompt tokens scheduled for a single request per step, 0 means unlimited.
+        fair_prompt_chunking:       Whether to share the prompt tokens budget of a step equally between waiting prompts.
+        num_reserved_decode_tokens: Number of batched tokens per step prompts cannot take while some requests are generating.
     
         vLLM-like settings:
         max_num_seqs:               max number of scheduled sequences (you can think of it as "max batch size").
@@ -2642,6 +2747,11 @@ class SchedulerConfig:
             This results in more RAM usage, maximum RAM usage is determined by cache_size or num_kv_blocks parameters.
             When turned off only KV-cache required for batch calculation is kept in memory and
             when a sequence has finished generation its cache is released.
+        num_swap_kv_blocks:         Number of KV blocks in host memory for swapping out preempted sequences instead of recomputing them.
+        swap_min_num_tokens:        Minimal number of processed tokens for a preempted sequence to be swapped out.
+        persistent_prefix_cache_path: Path to a file persisting prefix cache KV blocks across pipeline restarts.
+        persistent_prefix_cache_size: Size budget of the persistent prefix cache file in GB.
+        priority_aging_interval_ms: Waiting time in milliseconds after which the effective priority of a request grows by one.
         use_cache_eviction:         Whether to use cache eviction during generation.
         cache_eviction_config       Cache eviction configuration struct.
         use_sparse_attention        Whether to use sparse attention during prefill.
@@ -2650,6 +2760,8 @@ class SchedulerConfig:
     cache_eviction_config: CacheEvictionConfig
     dynamic_split_fuse: bool
     enable_prefix_caching: bool
+    fair_prompt_chunking: bool
+    persistent_prefix_cache_path: str
     sparse_attention_config: SparseAttentionConfig
     use_cache_eviction: bool
     use_sparse_attention: bool
@@ -2676,11 +2788,77 @@ class SchedulerConfig:
     def max_num_seqs(self, arg0: typing.SupportsInt) -> None:
         ...
     @property
+    def max_prompt_chunk_size(self) -> int:
+        ...
+    @max_prompt_chunk_size.setter
+    def max_prompt_chunk_size(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
     def num_kv_blocks(self) -> int:
         ...
     @num_kv_blocks.setter
     def num_kv_blocks(self, arg0: typing.SupportsInt) -> None:
         ...
+    @property
+    def num_reserved_decode_tokens(self) -> int:
+        ...
+    @num_reserved_decode_tokens.setter
+    def num_reserved_decode_tokens(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def num_swap_kv_blocks(self) -> int:
+        ...
+    @num_swap_kv_blocks.setter
+    def num_swap_kv_blocks(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def persistent_prefix_cache_size(self) -> int:
+        ...
+    @persistent_prefix_cache_size.setter
+    def persistent_prefix_cache_size(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def priority_aging_interval_ms(self) -> int:
+        ...
+    @priority_aging_interval_ms.setter
+    def priority_aging_interval_ms(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def swap_min_num_tokens(self) -> int:
+        ...
+    @swap_min_num_tokens.setter
+    def swap_min_num_tokens(self, arg0: typing.SupportsInt) -> None:
+        ...
+class SessionState:
+    """
+    Snapshot of a chat session of LLMPipeline: the chat history and the KV cache of the model. Copies share the same snapshot.
+    """
+    def __init__(self) -> None:
+        """
+        Creates an empty session. Restoring it starts a new chat.
+        """
+    def compress(self) -> None:
+        """
+        Stores f32 KV cache tensors in f16, halving the memory of the snapshot at a small accuracy cost.
+        """
+    def get_restore_duration(self) -> float:
+        """
+        Duration of the last restore of the session in milliseconds, 0 if it was not restored yet.
+        """
+    def get_save_duration(self) -> float:
+        """
+        Duration of the snapshot creation in milliseconds.
+        """
+    def get_size_in_bytes(self) -> int:
+        """
+        The number of bytes of the KV cache tensors of the snapshot, either in memory or in the file.
+        """
+    def is_spilled(self) -> bool:
+        ...
+    def spill(self, path: os.PathLike | str | bytes) -> None:
+        """
+        Writes the KV cache tensors to a file and releases their memory. The file must exist while the session is used.
+        """
 class SparseAttentionConfig:
     """
     
@@ -3533,6 +3711,7 @@ class Text2ImagePipeline:
         
                         Use `blob_path` property to load previously exported models.
         """
+    @typing.overload
     def generate(self, prompt: str, **kwargs) -> openvino._pyopenvino.Tensor:
         """
             Generates images for text-to-image models.
@@ -3563,6 +3742,24 @@ class Text2ImagePipeline:
             :return: ov.Tensor with resulting images
             :rtype: ov.Tensor
         """
+    @typing.overload
+    def generate(self, prompts: collections.abc.Sequence[str], properties: collections.abc.Sequence[collections.abc.Mapping[str, typing.Any]] = []) -> list[ImageGenerationResult]:
+        """
+            Generates images for several prompts, e.g. for requests of concurrent users.
+            For Stable Diffusion and Latent Consistency models, requests of the same image size and guidance mode are denoised
+            together: a single UNet inference per denoising step for all requests at the same timestep. Each request keeps its
+            own generation parameters, random generator and callback. Prompts are generated one after another by other models,
+            by a reshaped pipeline, on NPU or if 'adapters' are passed to requests.
+        
+            :param prompts: prompts to generate images from
+            :type prompts: list[str]
+        
+            :param properties: generation parameters of each prompt, see generate() with a single prompt. The pipeline generation config is used if not set.
+            :type properties: list[dict]
+        
+            :return: images and performance metrics of each prompt, the image is empty if generation was stopped by callback
+            :rtype: list[ImageGenerationResult]
+        """
     def get_generation_config(self) -> ImageGenerationConfig:
         ...
     def get_performance_metrics(self) -> ImageGenerationPerfMetrics:
@@ -4016,6 +4213,20 @@ class Tokenizer:
         Returns:
          TokenizedInputs object containing input_ids and attention_mask tensors.
         """
+    def encode_parallel(self, prompts: collections.abc.Sequence[str], add_special_tokens: bool = True, pad_to_max_length: bool = False, max_length: typing.SupportsInt | None = None, padding_side: str | None = None) -> list[TokenizedInputs]:
+        """
+        
+        Encodes every prompt separately, running the prompts on all the tokenizer infer requests asynchronously.
+        Unlike encode of a list of prompts, the results are not padded to the longest prompt.
+        Args:
+         'prompts' - list of prompts to encode
+         'add_special_tokens' - whether to add special tokens like BOS, EOS, PAD. Default is True.
+         'pad_to_max_length' - whether to pad the sequence to the maximum length. Default is False.
+         'max_length' - maximum length of the sequence. If None (default), the value will be taken from the IR (where default value from original HF/GGUF model is stored).
+         'padding_side' - side to pad the sequence, can be 'left' or 'right'. If None (default), the value will be taken from the IR (where default value from original HF/GGUF model is stored).
+        Returns:
+         List of TokenizedInputs objects in the order of prompts.
+        """
     def get_bos_token(self) -> str:
         ...
     def get_bos_token_id(self) -> int:
@@ -4153,6 +4364,56 @@ class UNet2DConditionModel:
         ...
     def set_hidden_states(self, tensor_name: str, encoder_hidden_states: openvino._pyopenvino.Tensor) -> None:
         ...
+class VAETilingConfig:
+    """
+    Configuration of tiled VAE encoding and decoding, which reduces memory consumption at high resolutions.
+    
+    Attributes:
+      tile_size: Height and width of a tile in pixels (default: 512)
+      tile_overlap: Number of pixels shared by neighboring tiles, must be less than tile_size (default: 64)
+      temporal_tile_size: Number of video frames in a temporal tile, 0 disables temporal tiling (default: 0)
+      temporal_tile_overlap: Number of video frames shared by neighboring temporal tiles (default: 8)
+    """
+    def __init__(self) -> None:
+        ...
+    def __repr__(self) -> str:
+        ...
+    def to_string(self) -> str:
+        ...
+    def validate(self) -> None:
+        ...
+    @property
+    def temporal_tile_overlap(self) -> int:
+        """
+        Number of video frames shared by neighboring temporal tiles
+        """
+    @temporal_tile_overlap.setter
+    def temporal_tile_overlap(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def temporal_tile_size(self) -> int:
+        """
+        Number of video frames in a temporal tile, 0 disables temporal tiling
+        """
+    @temporal_tile_size.setter
+    def temporal_tile_size(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def tile_overlap(self) -> int:
+        """
+        Number of pixels shared by neighboring tiles
+        """
+    @tile_overlap.setter
+    def tile_overlap(self, arg0: typing.SupportsInt) -> None:
+        ...
+    @property
+    def tile_size(self) -> int:
+        """
+        Height and width of a tile in pixels
+        """
+    @tile_size.setter
+    def tile_size(self, arg0: typing.SupportsInt) -> None:
+        ...
 class VLLMParserWrapper(Parser):
     def __init__(self, py_parser: typing.Any) -> None:
         """
@@ -4491,6 +4752,7 @@ class VideoGenerationConfig:
     generator: Generator
     negative_prompt: str | None
     taylorseer_config: openvino_genai.py_openvino_genai.TaylorSeerCacheConfig | None
+    vae_tiling_config: openvino_genai.py_openvino_genai.VAETilingConfig | None
     def __init__(self) -> None:
         ...
     @property
@@ -4844,6 +5106,11 @@ class WhisperPipeline:
                     models_path (os.PathLike): Path to the model file.
                     device (str): Device to run the model on (e.g., CPU, GPU).
         """
+    def finish_streaming(self) -> WhisperStreamingUpdate:
+        """
+        Transcribes the rest of the pushed audio and closes the streaming session.
+        """
+    @typing.overload
     def generate(self, raw_speech_input: collections.abc.Sequence[typing.SupportsFloat], generation_config: openvino_genai.py_openvino_genai.WhisperGenerationConfig | None = None, streamer: collections.abc.Callable[[str], int | None] | openvino_genai.py_openvino_genai.StreamerBase | None = None, **kwargs) -> WhisperDecodedResults:
         """
             High level generate that receives raw speech as a vector of floats and returns decoded output.
@@ -4985,12 +5252,54 @@ class WhisperPipeline:
             do_sample:          whether or not to use multinomial random sampling that add up to `top_p` or higher are kept.
             num_return_sequences: the number of sequences to generate from a single prompt.
         """
+    @typing.overload
+    def generate(self, raw_speech_inputs: collections.abc.Sequence[collections.abc.Sequence[typing.SupportsFloat]], generation_configs: collections.abc.Sequence[WhisperGenerationConfig] | None = None, streamers: collections.abc.Sequence[collections.abc.Callable[[str], int | None] | openvino_genai.py_openvino_genai.StreamerBase | None] | None = None) -> list[WhisperDecodedResults]:
+        """
+            Transcribes several audio inputs at once. Encoder and decoder inferences of 30 seconds chunks of different inputs
+            are batched, up to WHISPER_MAX_BATCH_SIZE chunks passed as a pipeline property, 8 by default.
+            Inputs are transcribed one after another for beam search, word level timestamps or NPU.
+        
+            :param raw_speech_inputs: inputs in the form of lists of floats. Required to be normalized to near [-1, 1] range and have 16k Hz sampling rate.
+            :type raw_speech_inputs: list[list[float]]
+        
+            :param generation_configs: generation configs of the inputs, the pipeline generation config is used if not set
+            :type generation_configs: list[WhisperGenerationConfig]
+        
+            :param streamers: streamers of the inputs
+            :type streamers: list[Callable[[str], bool] | ov.genai.StreamerBase]
+        
+            :return: return results in decoded form, one per input
+            :rtype: list[WhisperDecodedResults]
+        """
     def get_generation_config(self) -> WhisperGenerationConfig:
         ...
     def get_tokenizer(self) -> Tokenizer:
         ...
+    def push_audio(self, raw_speech_input: collections.abc.Sequence[typing.SupportsFloat]) -> WhisperStreamingUpdate:
+        """
+            Pushes the next piece of audio to the streaming session.
+        
+            :param raw_speech_input: inputs in the form of list of floats. Required to be normalized to near [-1, 1] range and have 16k Hz sampling rate.
+            :type raw_speech_input: list[float]
+        
+            :return: the chunks which have become final and the current partial chunk
+            :rtype: WhisperStreamingUpdate
+        """
     def set_generation_config(self, config: WhisperGenerationConfig) -> None:
         ...
+    def start_streaming(self, generation_config: openvino_genai.py_openvino_genai.WhisperGenerationConfig | None = None, min_update_interval: typing.SupportsFloat = 1.0) -> None:
+        """
+            Starts a streaming session, the audio is pushed to it piece by piece as it arrives, e.g. from a microphone.
+            The pushed audio is transcribed by windows of up to 30 seconds, which are decoded again as new audio arrives.
+            A chunk becomes final once the same text has been decoded for it by two consecutive updates or once the window
+            it belongs to is full. A previous session is discarded. Not supported by the static NPU pipeline.
+        
+            :param generation_config: generation_config, beam search and word level timestamps are not supported
+            :type generation_config: WhisperGenerationConfig
+        
+            :param min_update_interval: the minimal duration of new audio in seconds, which triggers decoding of the window
+            :type min_update_interval: float
+        """
 class WhisperRawPerfMetrics:
     """
     
@@ -5010,6 +5319,23 @@ class WhisperRawPerfMetrics:
     @property
     def word_level_timestamps_processing_durations(self) -> list[float]:
         ...
+class WhisperStreamingUpdate:
+    """
+    
+        Transcription of the audio pushed to a streaming session since the previous update.
+    
+        Parameters:
+        final_chunks:   chunks which won't change anymore, in order of the audio.
+        partial_chunk:  optional current hypothesis for the audio after the final chunks, it may change with the next updates.
+    """
+    def __init__(self) -> None:
+        ...
+    @property
+    def final_chunks(self) -> list[WhisperDecodedResultChunk]:
+        ...
+    @property
+    def partial_chunk(self) -> WhisperDecodedResultChunk | None:
+        ...
 class WhisperWordTiming:
     """
     Structure to store word-level timestamps
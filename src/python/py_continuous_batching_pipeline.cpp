@@ -31,6 +31,7 @@ using ov::genai::GenerationFinishReason;
 using ov::genai::GenerationStatus;
 using ov::genai::SchedulerConfig;
 using ov::genai::PipelineMetrics;
+using ov::genai::PriorityClassMetrics;
 using ov::genai::KVCrushAnchorPointMode;
 using ov::genai::KVCrushConfig;
 using ov::genai::ChatHistory;
@@ -113,6 +114,9 @@ auto scheduler_config_docstring = R"(
     cache_size:                 total size of KV cache in GB.
     block_size:                 block size for KV cache.
     dynamic_split_fuse:         whether to split prompt / generate to different scheduling phases.
+    max_prompt_chunk_size:      Maximum number of prompt tokens scheduled for a single request per step, 0 means unlimited.
+    fair_prompt_chunking:       Whether to share the prompt tokens budget of a step equally between waiting prompts.
+    num_reserved_decode_tokens: Number of batched tokens per step prompts cannot take while some requests are generating.
 
     vLLM-like settings:
     max_num_seqs:               max number of scheduled sequences (you can think of it as "max batch size").
@@ -122,6 +126,11 @@ auto scheduler_config_docstring = R"(
         This results in more RAM usage, maximum RAM usage is determined by cache_size or num_kv_blocks parameters.
         When turned off only KV-cache required for batch calculation is kept in memory and
         when a sequence has finished generation its cache is released.
+    num_swap_kv_blocks:         Number of KV blocks in host memory for swapping out preempted sequences instead of recomputing them.
+    swap_min_num_tokens:        Minimal number of processed tokens for a preempted sequence to be swapped out.
+    persistent_prefix_cache_path: Path to a file persisting prefix cache KV blocks across pipeline restarts.
+    persistent_prefix_cache_size: Size budget of the persistent prefix cache file in GB.
+    priority_aging_interval_ms: Waiting time in milliseconds after which the effective priority of a request grows by one.
     use_cache_eviction:         Whether to use cache eviction during generation.
     cache_eviction_config       Cache eviction configuration struct.
     use_sparse_attention        Whether to use sparse attention during prefill.
@@ -170,6 +179,31 @@ auto pipeline_metrics_docstring = R"(
       This value represents reserved/allocated memory for the KV cache and does not
       distinguish between used and unused portions in dynamic KV cache configurations.
     :type kv_cache_size_in_bytes: int
+
+    :param priority_classes: Latency statistics per priority class, keyed by GenerationConfig.priority.
+    :type priority_classes: dict[int, PriorityClassMetrics]
+)";
+
+auto priority_class_metrics_docstring = R"(
+    Latency statistics of the requests sharing the same GenerationConfig.priority, aggregated throughout the lifetime of the pipeline.
+
+    :param requests: Number of requests of the class to be processed by the pipeline.
+    :type requests: int
+
+    :param finished_requests: Number of requests of the class which finished generation.
+    :type finished_requests: int
+
+    :param avg_ttft: Average time to first token of the finished requests in milliseconds.
+    :type avg_ttft: float
+
+    :param avg_tpot: Average time per output token of the finished requests in milliseconds.
+    :type avg_tpot: float
+
+    :param ttft_deadline_misses: Number of finished requests which produced the first token later than their ttft_deadline_ms.
+    :type ttft_deadline_misses: int
+
+    :param tpot_deadline_misses: Number of generation steps of the finished requests which produced tokens later than tpot_deadline_ms after the previous ones.
+    :type tpot_deadline_misses: int
 )";
 
 std::ostream& operator << (std::ostream& stream, const GenerationResult& generation_result) {
@@ -377,14 +411,31 @@ void init_continuous_batching_pipeline(py::module_& m) {
         .def_readwrite("num_kv_blocks", &SchedulerConfig::num_kv_blocks)
         .def_readwrite("cache_size", &SchedulerConfig::cache_size)
         .def_readwrite("dynamic_split_fuse", &SchedulerConfig::dynamic_split_fuse)
+        .def_readwrite("max_prompt_chunk_size", &SchedulerConfig::max_prompt_chunk_size)
+        .def_readwrite("fair_prompt_chunking", &SchedulerConfig::fair_prompt_chunking)
+        .def_readwrite("num_reserved_decode_tokens", &SchedulerConfig::num_reserved_decode_tokens)
         .def_readwrite("max_num_seqs", &SchedulerConfig::max_num_seqs)
         .def_readwrite("enable_prefix_caching", &SchedulerConfig::enable_prefix_caching)
+        .def_readwrite("num_swap_kv_blocks", &SchedulerConfig::num_swap_kv_blocks)
+        .def_readwrite("swap_min_num_tokens", &SchedulerConfig::swap_min_num_tokens)
+        .def_readwrite("persistent_prefix_cache_path", &SchedulerConfig::persistent_prefix_cache_path)
+        .def_readwrite("persistent_prefix_cache_size", &SchedulerConfig::persistent_prefix_cache_size)
+        .def_readwrite("priority_aging_interval_ms", &SchedulerConfig::priority_aging_interval_ms)
         .def_readwrite("use_cache_eviction", &SchedulerConfig::use_cache_eviction)
         .def_readwrite("cache_eviction_config", &SchedulerConfig::cache_eviction_config)
         .def_readwrite("use_sparse_attention", &SchedulerConfig::use_sparse_attention)
         .def_readwrite("sparse_attention_config", &SchedulerConfig::sparse_attention_config)
         .def("to_string", &SchedulerConfig::to_string);
 
+    py::class_<PriorityClassMetrics>(m, "PriorityClassMetrics", priority_class_metrics_docstring)
+            .def(py::init<>())
+            .def_readonly("requests", &PriorityClassMetrics::requests)
+            .def_readonly("finished_requests", &PriorityClassMetrics::finished_requests)
+            .def_readonly("avg_ttft", &PriorityClassMetrics::avg_ttft)
+            .def_readonly("avg_tpot", &PriorityClassMetrics::avg_tpot)
+            .def_readonly("ttft_deadline_misses", &PriorityClassMetrics::ttft_deadline_misses)
+            .def_readonly("tpot_deadline_misses", &PriorityClassMetrics::tpot_deadline_misses);
+
     py::class_<PipelineMetrics>(m, "PipelineMetrics", pipeline_metrics_docstring)
             .def(py::init<>())
             .def_readonly("requests", &PipelineMetrics::requests)
@@ -392,7 +443,8 @@ void init_continuous_batching_pipeline(py::module_& m) {
             .def_readonly("cache_usage", &PipelineMetrics::cache_usage)
             .def_readonly("avg_cache_usage", &PipelineMetrics::avg_cache_usage)
             .def_readonly("kv_cache_size_in_bytes", &PipelineMetrics::kv_cache_size_in_bytes)
-            .def_readonly("max_cache_usage", &PipelineMetrics::max_cache_usage);
+            .def_readonly("max_cache_usage", &PipelineMetrics::max_cache_usage)
+            .def_readonly("priority_classes", &PipelineMetrics::priority_classes);
 
     py::class_<ContinuousBatchingPipeline>(m, "ContinuousBatchingPipeline", "This class is used for generation with LLMs with continuous batchig")
         .def(py::init([](const std::filesystem::path& models_path, const SchedulerConfig& scheduler_config, const std::string& device, const std::map<std::string, py::object>& llm_plugin_config,
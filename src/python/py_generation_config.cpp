@@ -193,6 +193,11 @@ char generation_config_docstring[] = R"(
     top_k:              the number of highest probability vocabulary tokens to keep for top-k-filtering.
     do_sample:          whether or not to use multinomial random sampling that add up to `top_p` or higher are kept.
     num_return_sequences: the number of sequences to generate from a single prompt.
+
+    Scheduling parameters (continuous batching only):
+    priority:           priority class of the request, requests with higher values are scheduled and kept running first.
+    ttft_deadline_ms:   time to first token target in milliseconds, 0 means no target.
+    tpot_deadline_ms:   time per output token target in milliseconds, 0 means no target.
 )";
 
 
@@ -450,6 +455,9 @@ void init_generation_config(py::module_& m) {
         .def_readwrite("parsers", &GenerationConfig::parsers, py::keep_alive<1, 2>())
         .def_readwrite("adapters", &GenerationConfig::adapters)
         .def_readwrite("apply_chat_template", &GenerationConfig::apply_chat_template)
+        .def_readwrite("priority", &GenerationConfig::priority)
+        .def_readwrite("ttft_deadline_ms", &GenerationConfig::ttft_deadline_ms)
+        .def_readwrite("tpot_deadline_ms", &GenerationConfig::tpot_deadline_ms)
         .def("set_eos_token_id", &GenerationConfig::set_eos_token_id, py::arg("tokenizer_eos_token_id"))
         .def("is_beam_search", &GenerationConfig::is_beam_search)
         .def("is_greedy_decoding", &GenerationConfig::is_greedy_decoding)
@@ -73,6 +73,23 @@ auto raw_image_generation_perf_metrics_docstring = R"(
     :type iteration_durations: list[float]
 )";
 
+auto text2image_generate_batch_docstring = R"(
+    Generates images for several prompts, e.g. for requests of concurrent users.
+    For Stable Diffusion and Latent Consistency models, requests of the same image size and guidance mode are denoised
+    together: a single UNet inference per denoising step for all requests at the same timestep. Each request keeps its
+    own generation parameters, random generator and callback. Prompts are generated one after another by other models,
+    by a reshaped pipeline, on NPU or if 'adapters' are passed to requests.
+
+    :param prompts: prompts to generate images from
+    :type prompts: list[str]
+
+    :param properties: generation parameters of each prompt, see generate() with a single prompt. The pipeline generation config is used if not set.
+    :type properties: list[dict]
+
+    :return: images and performance metrics of each prompt, the image is empty if generation was stopped by callback
+    :rtype: list[ImageGenerationResult]
+)";
+
 auto image_generation_perf_metrics_docstring = R"(
     Holds performance metrics for each generate call.
 
@@ -351,6 +368,27 @@ void init_image_generation_pipelines(py::module_& m) {
         .def("to_string", &ov::genai::TaylorSeerCacheConfig::to_string)
         .def("__repr__", &ov::genai::TaylorSeerCacheConfig::to_string);
 
+    py::class_<ov::genai::VAETilingConfig>(
+        m, "VAETilingConfig",
+        "Configuration of tiled VAE encoding and decoding, which reduces memory consumption at high resolutions.\n\n"
+        "Attributes:\n"
+        "  tile_size: Height and width of a tile in pixels (default: 512)\n"
+        "  tile_overlap: Number of pixels shared by neighboring tiles, must be less than tile_size (default: 64)\n"
+        "  temporal_tile_size: Number of video frames in a temporal tile, 0 disables temporal tiling (default: 0)\n"
+        "  temporal_tile_overlap: Number of video frames shared by neighboring temporal tiles (default: 8)")
+        .def(py::init<>())
+        .def_readwrite("tile_size", &ov::genai::VAETilingConfig::tile_size,
+                      "Height and width of a tile in pixels")
+        .def_readwrite("tile_overlap", &ov::genai::VAETilingConfig::tile_overlap,
+                      "Number of pixels shared by neighboring tiles")
+        .def_readwrite("temporal_tile_size", &ov::genai::VAETilingConfig::temporal_tile_size,
+                      "Number of video frames in a temporal tile, 0 disables temporal tiling")
+        .def_readwrite("temporal_tile_overlap", &ov::genai::VAETilingConfig::temporal_tile_overlap,
+                      "Number of video frames shared by neighboring temporal tiles")
+        .def("validate", &ov::genai::VAETilingConfig::validate)
+        .def("to_string", &ov::genai::VAETilingConfig::to_string)
+        .def("__repr__", &ov::genai::VAETilingConfig::to_string);
+
     py::class_<ov::genai::ImageGenerationConfig>(m, "ImageGenerationConfig", "This class is used for storing generation config for image generation pipeline.")
         .def(py::init<>())
         .def_readwrite("prompt_2", &ov::genai::ImageGenerationConfig::prompt_2)
@@ -369,6 +407,7 @@ void init_image_generation_pipelines(py::module_& m) {
         .def_readwrite("strength", &ov::genai::ImageGenerationConfig::strength)
         .def_readwrite("max_sequence_length", &ov::genai::ImageGenerationConfig::max_sequence_length)
         .def_readwrite("taylorseer_config", &ov::genai::ImageGenerationConfig::taylorseer_config)
+        .def_readwrite("vae_tiling_config", &ov::genai::ImageGenerationConfig::vae_tiling_config)
         .def("validate", &ov::genai::ImageGenerationConfig::validate)
         .def("update_generation_config", [](
             ov::genai::ImageGenerationConfig& config,
@@ -418,6 +457,10 @@ void init_image_generation_pipelines(py::module_& m) {
         .def("get_unet_infer_duration", &ImageGenerationPerfMetrics::get_unet_infer_duration)
         .def_readonly("raw_metrics", &ImageGenerationPerfMetrics::raw_metrics);
 
+    py::class_<ov::genai::ImageGenerationResult>(m, "ImageGenerationResult", "Image(s) generated for a prompt of a batched generate() call.")
+        .def_readonly("image", &ov::genai::ImageGenerationResult::image)
+        .def_readonly("perf_metrics", &ov::genai::ImageGenerationResult::performance_stat);
+
     auto text2image_pipeline = py::class_<ov::genai::Text2ImagePipeline>(m, "Text2ImagePipeline", "This class is used for generation with text-to-image models.")
         .def(py::init([](const std::filesystem::path& models_path) {
             ScopedVar env_manager(pyutils::ov_tokenizers_module_path());
@@ -516,6 +559,22 @@ void init_image_generation_pipelines(py::module_& m) {
             },
             py::arg("prompt"), "Input string",
             (text2image_generate_docstring + std::string(" \n ")).c_str())
+        .def(
+            "generate",
+            [](ov::genai::Text2ImagePipeline& pipe,
+                const std::vector<std::string>& prompts,
+                const std::vector<std::map<std::string, py::object>>& properties
+            ) -> std::vector<ov::genai::ImageGenerationResult> {
+                std::vector<ov::AnyMap> params;
+                params.reserve(properties.size());
+                for (const auto& request_properties : properties) {
+                    params.push_back(pyutils::properties_to_any_map(request_properties));
+                }
+                py::gil_scoped_release rel;
+                return pipe.generate(prompts, params);
+            },
+            py::arg("prompts"), py::arg("properties") = std::vector<std::map<std::string, py::object>>{},
+            text2image_generate_batch_docstring)
         .def("decode", &ov::genai::Text2ImagePipeline::decode, py::arg("latent"))
         .def("get_performance_metrics", &ov::genai::Text2ImagePipeline::get_performance_metrics)
         .def("export_model",
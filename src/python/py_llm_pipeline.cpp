@@ -25,6 +25,7 @@ using ov::genai::DecodedResults;
 using ov::genai::Tokenizer;
 using ov::genai::draft_model;
 using ov::genai::ChatHistory;
+using ov::genai::SessionState;
 
 namespace {
 
@@ -117,6 +118,19 @@ py::object call_common_generate(
 extern char generation_config_docstring[];
 
 void init_llm_pipeline(py::module_& m) {
+    py::class_<SessionState>(m, "SessionState", "Snapshot of a chat session of LLMPipeline: the chat history and the KV cache of the model. Copies share the same snapshot.")
+        .def(py::init<>(), "Creates an empty session. Restoring it starts a new chat.")
+        .def("compress", &SessionState::compress,
+             "Stores f32 KV cache tensors in f16, halving the memory of the snapshot at a small accuracy cost.")
+        .def("spill", &SessionState::spill, py::arg("path"),
+             "Writes the KV cache tensors to a file and releases their memory. The file must exist while the session is used.")
+        .def("is_spilled", &SessionState::is_spilled)
+        .def("get_size_in_bytes", &SessionState::get_size_in_bytes,
+             "The number of bytes of the KV cache tensors of the snapshot, either in memory or in the file.")
+        .def("get_save_duration", &SessionState::get_save_duration, "Duration of the snapshot creation in milliseconds.")
+        .def("get_restore_duration", &SessionState::get_restore_duration,
+             "Duration of the last restore of the session in milliseconds, 0 if it was not restored yet.");
+
     py::class_<LLMPipeline>(m, "LLMPipeline", "This class is used for generation with LLMs")
         // init(model_path, tokenizer, device, config, kwargs) should be defined before init(model_path, device, config, kwargs) 
         // to prevent tokenizer treated as kwargs argument
@@ -259,6 +273,11 @@ void init_llm_pipeline(py::module_& m) {
                          1);
             pipe.finish_chat();
         })
+        .def("save_session", &LLMPipeline::save_session,
+             "Saves the current chat session: the chat history and a copy of the KV cache. Supported by the stateful pipeline only.")
+        .def("restore_session", &LLMPipeline::restore_session, py::arg("session"),
+             "Restores a chat session saved by save_session() of this pipeline, replacing the current one. "
+             "Restoring an empty SessionState starts a new chat.")
         .def("get_generation_config", &LLMPipeline::get_generation_config, py::return_value_policy::copy)
         .def("set_generation_config", &LLMPipeline::set_generation_config, py::arg("config"));
 
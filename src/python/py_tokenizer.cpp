@@ -68,6 +68,19 @@ Args:
 + std::string(common_encode_docstring)
 );
 
+constexpr char encode_parallel_docstring[] = R"(
+Encodes every prompt separately, running the prompts on all the tokenizer infer requests asynchronously.
+Unlike encode of a list of prompts, the results are not padded to the longest prompt.
+Args:
+ 'prompts' - list of prompts to encode
+ 'add_special_tokens' - whether to add special tokens like BOS, EOS, PAD. Default is True.
+ 'pad_to_max_length' - whether to pad the sequence to the maximum length. Default is False.
+ 'max_length' - maximum length of the sequence. If None (default), the value will be taken from the IR (where default value from original HF/GGUF model is stored).
+ 'padding_side' - side to pad the sequence, can be 'left' or 'right'. If None (default), the value will be taken from the IR (where default value from original HF/GGUF model is stored).
+Returns:
+ List of TokenizedInputs objects in the order of prompts.
+)";
+
 }  // namespace
 
 namespace py = pybind11;
@@ -219,6 +232,29 @@ void init_tokenizer(py::module_& m) {
             encode_list_of_lists_docstring.c_str()
         )
 
+        .def("encode_parallel", [](Tokenizer& tok, const std::vector<std::string>& prompts,
+                                   bool add_special_tokens,
+                                   bool pad_to_max_length,
+                                   std::optional<size_t> max_length,
+                                   std::optional<std::string> padding_side) {
+                ov::AnyMap tokenization_params;
+                tokenization_params[ov::genai::add_special_tokens.name()] = add_special_tokens;
+                tokenization_params[ov::genai::pad_to_max_length.name()] = pad_to_max_length;
+                if (max_length.has_value()) {
+                    tokenization_params[ov::genai::max_length.name()] = *max_length;
+                }
+                if (padding_side.has_value()) {
+                    tokenization_params[ov::genai::padding_side.name()] = *padding_side;
+                }
+                return tok.encode_parallel(prompts, tokenization_params);
+            },
+            py::arg("prompts"),
+            py::arg("add_special_tokens") = true,
+            py::arg("pad_to_max_length") = false,
+            py::arg("max_length") = std::nullopt,
+            py::arg("padding_side") = std::nullopt,
+            encode_parallel_docstring)
+
         .def(
             "decode",
             [](Tokenizer& tok, std::vector<int64_t>& tokens, bool skip_special_tokens) -> py::str {
@@ -19,6 +19,7 @@
 #include "openvino/genai/image_generation/generation_config.hpp"
 #include "openvino/genai/extensions.hpp"
 #include "openvino/genai/taylorseer_config.hpp"
+#include "openvino/genai/vae_tiling_config.hpp"
 #include "openvino/genai/whisper_generation_config.hpp"
 #include "openvino/genai/whisper_pipeline.hpp"
 #include "openvino/genai/rag/text_embedding_pipeline.hpp"
@@ -428,6 +429,8 @@ ov::Any py_object_to_any(const py::object& py_obj, std::string property_name) {
         return py::cast<ov::genai::ImageGenerationConfig>(py_obj);
     } else if (py::isinstance<ov::genai::TaylorSeerCacheConfig>(py_obj)) {
         return py::cast<ov::genai::TaylorSeerCacheConfig>(py_obj);
+    } else if (py::isinstance<ov::genai::VAETilingConfig>(py_obj)) {
+        return py::cast<ov::genai::VAETilingConfig>(py_obj);
     } else if (py::isinstance<ov::genai::WhisperGenerationConfig>(py_obj)) {
         return py::cast<ov::genai::WhisperGenerationConfig>(py_obj);
     } else if (py::isinstance<ov::genai::TextEmbeddingPipeline::PoolingType>(py_obj)) {
@@ -489,7 +492,7 @@ ov::AnyMap kwargs_to_any_map(const py::kwargs& kwargs) {
             params.insert(map.begin(), map.end());
         } else if (py::isinstance<ov::genai::StructuredOutputConfig>(value)) {
             params[key] = py::cast<ov::genai::StructuredOutputConfig>(value);
-        } else if (value.is_none() && key == "taylorseer_config") {
+        } else if (value.is_none() && (key == "taylorseer_config" || key == "vae_tiling_config")) {
             params[key] = ov::Any{};
         } else {
             OPENVINO_ASSERT(!value.is_none(), "Property \"", key, "\" can't be None.");
@@ -226,9 +226,11 @@ void init_autoencoder_kl_ltx_video(py::module_& m) {
              &ov::genai::AutoencoderKLLTXVideo::decode,
              py::call_guard<py::gil_scoped_release>(),
              py::arg("latent"),
+             py::arg("tiling_config") = std::nullopt,
              R"(
                 Decodes latent video to pixel space.
                 latent (ov.Tensor): Latent video tensor.
+                tiling_config (VAETilingConfig | None): Enables decoding by overlapping spatial and temporal tiles.
                 Returns: Decoded video tensor.
             )");
 }
@@ -30,6 +30,7 @@ using ov::genai::WhisperGenerationConfig;
 using ov::genai::WhisperPerfMetrics;
 using ov::genai::WhisperPipeline;
 using ov::genai::WhisperRawPerfMetrics;
+using ov::genai::WhisperStreamingUpdate;
 using ov::genai::WhisperWordTiming;
 
 namespace pyutils = ov::genai::pybind::utils;
@@ -57,6 +58,55 @@ auto whisper_generate_docstring = R"(
     :rtype: WhisperDecodedResults
 )";
 
+auto whisper_generate_batch_docstring = R"(
+    Transcribes several audio inputs at once. Encoder and decoder inferences of 30 seconds chunks of different inputs
+    are batched, up to WHISPER_MAX_BATCH_SIZE chunks passed as a pipeline property, 8 by default.
+    Inputs are transcribed one after another for beam search, word level timestamps or NPU.
+
+    :param raw_speech_inputs: inputs in the form of lists of floats. Required to be normalized to near [-1, 1] range and have 16k Hz sampling rate.
+    :type raw_speech_inputs: list[list[float]]
+
+    :param generation_configs: generation configs of the inputs, the pipeline generation config is used if not set
+    :type generation_configs: list[WhisperGenerationConfig]
+
+    :param streamers: streamers of the inputs
+    :type streamers: list[Callable[[str], bool] | ov.genai.StreamerBase]
+
+    :return: return results in decoded form, one per input
+    :rtype: list[WhisperDecodedResults]
+)";
+
+auto whisper_start_streaming_docstring = R"(
+    Starts a streaming session, the audio is pushed to it piece by piece as it arrives, e.g. from a microphone.
+    The pushed audio is transcribed by windows of up to 30 seconds, which are decoded again as new audio arrives.
+    A chunk becomes final once the same text has been decoded for it by two consecutive updates or once the window
+    it belongs to is full. A previous session is discarded. Not supported by the static NPU pipeline.
+
+    :param generation_config: generation_config, beam search and word level timestamps are not supported
+    :type generation_config: WhisperGenerationConfig
+
+    :param min_update_interval: the minimal duration of new audio in seconds, which triggers decoding of the window
+    :type min_update_interval: float
+)";
+
+auto whisper_push_audio_docstring = R"(
+    Pushes the next piece of audio to the streaming session.
+
+    :param raw_speech_input: inputs in the form of list of floats. Required to be normalized to near [-1, 1] range and have 16k Hz sampling rate.
+    :type raw_speech_input: list[float]
+
+    :return: the chunks which have become final and the current partial chunk
+    :rtype: WhisperStreamingUpdate
+)";
+
+auto whisper_streaming_update_docstring = R"(
+    Transcription of the audio pushed to a streaming session since the previous update.
+
+    Parameters:
+    final_chunks:   chunks which won't change anymore, in order of the audio.
+    partial_chunk:  optional current hypothesis for the audio after the final chunks, it may change with the next updates.
+)";
+
 auto whisper_decoded_results_docstring = R"(
     Structure to store resulting text outputs and scores.
 
@@ -316,6 +366,11 @@ void init_whisper_pipeline(py::module_& m) {
             return pyutils::handle_utf8(chunk.text);
         });
 
+    py::class_<WhisperStreamingUpdate>(m, "WhisperStreamingUpdate", whisper_streaming_update_docstring)
+        .def(py::init<>())
+        .def_readonly("final_chunks", &WhisperStreamingUpdate::final_chunks)
+        .def_readonly("partial_chunk", &WhisperStreamingUpdate::partial_chunk);
+
     py::class_<WhisperWordTiming>(m, "WhisperWordTiming", "Structure to store word-level timestamps")
         .def(py::init<>())
         .def_readonly("word", &WhisperWordTiming::word)
@@ -381,6 +436,48 @@ void init_whisper_pipeline(py::module_& m) {
             "streamer",
             (whisper_generate_docstring + std::string(" \n ") + whisper_generation_config_docstring).c_str())
 
+        .def(
+            "generate",
+            [](WhisperPipeline& pipe,
+               const std::vector<RawSpeechInput>& raw_speech_inputs,
+               const std::optional<std::vector<WhisperGenerationConfig>>& generation_configs,
+               const std::optional<std::vector<pyutils::PyBindStreamerVariant>>& py_streamers) {
+                std::vector<StreamerVariant> streamers;
+                if (py_streamers.has_value()) {
+                    for (const auto& py_streamer : *py_streamers) {
+                        streamers.push_back(pyutils::pystreamer_to_streamer(py_streamer));
+                    }
+                }
+                std::vector<WhisperDecodedResults> res;
+                {
+                    py::gil_scoped_release rel;
+                    res = pipe.generate(raw_speech_inputs, generation_configs.value_or(std::vector<WhisperGenerationConfig>{}), streamers);
+                }
+                return res;
+            },
+            py::arg("raw_speech_inputs"),
+            "Lists of floats representing raw speech audio. "
+            "Required to be normalized to near [-1, 1] range and have 16k Hz sampling rate.",
+            py::arg("generation_configs") = std::nullopt,
+            "generation configs of the inputs",
+            py::arg("streamers") = std::nullopt,
+            "streamers of the inputs",
+            whisper_generate_batch_docstring)
+
+        .def("start_streaming",
+             &WhisperPipeline::start_streaming,
+             py::arg("generation_config") = std::nullopt,
+             py::arg("min_update_interval") = 1.0f,
+             whisper_start_streaming_docstring)
+        .def("push_audio",
+             &WhisperPipeline::push_audio,
+             py::arg("raw_speech_input"),
+             py::call_guard<py::gil_scoped_release>(),
+             whisper_push_audio_docstring)
+        .def("finish_streaming",
+             &WhisperPipeline::finish_streaming,
+             py::call_guard<py::gil_scoped_release>(),
+             "Transcribes the rest of the pushed audio and closes the streaming session.")
         .def("get_tokenizer", &WhisperPipeline::get_tokenizer)
         .def("get_generation_config", &WhisperPipeline::get_generation_config, py::return_value_policy::copy)
         .def("set_generation_config", &WhisperPipeline::set_generation_config, py::arg("config"));
@@ -6,19 +6,15 @@
 #include "openvino/runtime/core.hpp"
 #include "continuous_batching/scheduler.hpp"
 #include <chrono>
-#include <thread>
 
 TEST(TestBlockHashStore, general_test) {
     ov::genai::OverwritableBlocksHashStore block_hash_store(1);
     auto block0 = std::make_shared<ov::genai::KVCacheBlock>(0);
     block0->set_hash(77);
-    std::this_thread::sleep_until(std::chrono::steady_clock::now() + std::chrono::seconds(1));
     auto block1 = std::make_shared<ov::genai::KVCacheBlock>(1);
     block1->set_hash(56);
-    std::this_thread::sleep_until(std::chrono::steady_clock::now() + std::chrono::seconds(1));
     auto block2 = std::make_shared<ov::genai::KVCacheBlock>(2);
     block2->set_hash(23);
-    std::this_thread::sleep_until(std::chrono::steady_clock::now() + std::chrono::seconds(1));
     block_hash_store.add(ov::genai::BlocksPerLayer{block0});
     block_hash_store.add(ov::genai::BlocksPerLayer{block1});
     block_hash_store.add(ov::genai::BlocksPerLayer{block2});
@@ -38,13 +34,12 @@ TEST(TestBlockHashStore, general_test) {
 
     auto block3 = std::make_shared<ov::genai::KVCacheBlock>(7);
     block3->set_hash(12);
-    std::this_thread::sleep_until(std::chrono::steady_clock::now() + std::chrono::seconds(1));
     auto block4 = std::make_shared<ov::genai::KVCacheBlock>(10);
     block4->set_hash(99);
-    std::this_thread::sleep_until(std::chrono::steady_clock::now() + std::chrono::seconds(1));
     block_hash_store.add(ov::genai::BlocksPerLayer{block3});
     block_hash_store.add(ov::genai::BlocksPerLayer{block4});
-    block2->set_timestamp(std::chrono::steady_clock::now());
+    EXPECT_TRUE(block_hash_store.touch(23));
+    EXPECT_FALSE(block_hash_store.touch(44));
 
     EXPECT_EQ(block_hash_store.get_lru_block_to_overwrite()[0]->get_index(), 7);
     EXPECT_EQ(block_hash_store.get_lru_block_to_overwrite()[0]->get_index(), 10);
@@ -52,3 +47,28 @@ TEST(TestBlockHashStore, general_test) {
     EXPECT_TRUE(block_hash_store.get_lru_block_to_overwrite().empty());
     EXPECT_EQ(block_hash_store.num_blocks(), 0);
 }
+
+TEST(TestBlockHashStore, clean_store_keeps_recency_order) {
+    size_t num_layers = 2;
+    ov::genai::OverwritableBlocksHashStore block_hash_store(num_layers);
+    for (size_t hash = 0; hash < 4; hash++) {
+        ov::genai::BlocksPerLayer blocks;
+        for (size_t layer_idx = 0; layer_idx < num_layers; layer_idx++) {
+            blocks.push_back(std::make_shared<ov::genai::KVCacheBlock>(hash * num_layers + layer_idx));
+            blocks.back()->set_hash(hash);
+        }
+        block_hash_store.add(blocks);
+    }
+
+    auto removed_blocks = block_hash_store.clean_store({0, 2, 5});
+    EXPECT_EQ(removed_blocks.size(), 2);
+    EXPECT_EQ(removed_blocks[0].size(), num_layers);
+    EXPECT_EQ(block_hash_store.num_blocks(), 2);
+
+    auto blocks = block_hash_store.get_lru_block_to_overwrite();
+    EXPECT_EQ(blocks.size(), num_layers);
+    EXPECT_EQ(blocks[0]->get_hash(), 1);
+    EXPECT_EQ(blocks[1]->get_index(), 3);
+    EXPECT_EQ(block_hash_store.get_lru_block_to_overwrite()[0]->get_hash(), 3);
+    EXPECT_TRUE(block_hash_store.get_lru_block_to_overwrite().empty());
+}
@@ -0,0 +1,26 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include "tokenizer/chat_history_encoder.hpp"
+
+using namespace ov::genai;
+
+TEST(ChatHistoryEncoderTest, finds_occurrence_of_special_token) {
+    // "<s>" and "</s>" are special tokens with ids 1 and 2, other ids stand for the text between them
+    const std::string text = "<s>user: hi</s><s>assistant: hello</s><s>user: bye</s>";
+    const std::vector<int64_t> token_ids = {1, 10, 11, 2, 1, 12, 13, 2, 1, 10, 14, 2};
+    EXPECT_EQ(ChatHistoryEncoder::find_special_token_offset(text, token_ids, 0, "<s>"), 0);
+    EXPECT_EQ(ChatHistoryEncoder::find_special_token_offset(text, token_ids, 4, "<s>"), text.find("<s>assistant"));
+    EXPECT_EQ(ChatHistoryEncoder::find_special_token_offset(text, token_ids, 11, "</s>"), text.rfind("</s>"));
+}
+
+TEST(ChatHistoryEncoderTest, rejects_token_text_inside_other_tokens) {
+    // "<s>" is a part of the text of the regular token 15, so its occurrences do not match the token ids
+    const std::string text = "<s>user: <s></s>";
+    const std::vector<int64_t> token_ids = {1, 10, 15, 2};
+    EXPECT_EQ(ChatHistoryEncoder::find_special_token_offset(text, token_ids, 0, "<s>"), std::string::npos);
+    EXPECT_EQ(ChatHistoryEncoder::find_special_token_offset(text, token_ids, 3, "</s>"), text.find("</s>"));
+    EXPECT_EQ(ChatHistoryEncoder::find_special_token_offset(text, token_ids, 3, ""), std::string::npos);
+}
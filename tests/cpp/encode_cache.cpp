@@ -0,0 +1,75 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "tokenizer/encode_cache.hpp"
+
+using namespace ov::genai;
+
+namespace {
+TokenizedInputs make_inputs(const std::vector<int64_t>& tokens) {
+    ov::Tensor input_ids(ov::element::i64, ov::Shape{1, tokens.size()});
+    ov::Tensor attention_mask(ov::element::i64, ov::Shape{1, tokens.size()});
+    std::copy(tokens.begin(), tokens.end(), input_ids.data<int64_t>());
+    std::fill_n(attention_mask.data<int64_t>(), tokens.size(), 1);
+    return {input_ids, attention_mask, std::nullopt};
+}
+
+std::vector<int64_t> get_tokens(const TokenizedInputs& inputs) {
+    const int64_t* data = inputs.input_ids.data<const int64_t>();
+    return {data, data + inputs.input_ids.get_size()};
+}
+
+// a key of 8 bytes and two tensors of 4 tokens
+constexpr size_t ENTRY_SIZE_IN_BYTES = 8 + 2 * 4 * sizeof(int64_t);
+}  // namespace
+
+TEST(EncodeCacheTest, returns_cached_copies) {
+    EncodeCache cache(1024);
+    EXPECT_FALSE(cache.get("prompt_1").has_value());
+
+    TokenizedInputs inputs = make_inputs({1, 2, 3, 4});
+    cache.put("prompt_1", inputs);
+    // changes of the original and of the returned results do not affect the cache
+    inputs.input_ids.data<int64_t>()[0] = 100;
+    auto cached = cache.get("prompt_1");
+    ASSERT_TRUE(cached.has_value());
+    EXPECT_EQ(get_tokens(*cached), std::vector<int64_t>({1, 2, 3, 4}));
+    cached->input_ids.data<int64_t>()[0] = 100;
+    EXPECT_EQ(get_tokens(*cache.get("prompt_1")), std::vector<int64_t>({1, 2, 3, 4}));
+
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_EQ(cache.get_size_in_bytes(), ENTRY_SIZE_IN_BYTES);
+}
+
+TEST(EncodeCacheTest, evicts_least_recently_used) {
+    EncodeCache cache(2 * ENTRY_SIZE_IN_BYTES);
+    cache.put("prompt_1", make_inputs({1, 1, 1, 1}));
+    cache.put("prompt_2", make_inputs({2, 2, 2, 2}));
+    // the hit makes prompt_1 the most recently used, so prompt_2 is evicted
+    ASSERT_TRUE(cache.get("prompt_1").has_value());
+    cache.put("prompt_3", make_inputs({3, 3, 3, 3}));
+
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_TRUE(cache.get("prompt_1").has_value());
+    EXPECT_FALSE(cache.get("prompt_2").has_value());
+    EXPECT_TRUE(cache.get("prompt_3").has_value());
+    EXPECT_LE(cache.get_size_in_bytes(), 2 * ENTRY_SIZE_IN_BYTES);
+}
+
+TEST(EncodeCacheTest, skips_entries_larger_than_cache) {
+    EncodeCache cache(ENTRY_SIZE_IN_BYTES);
+    cache.put("prompt_1", make_inputs({1, 1, 1, 1}));
+    cache.put("prompt_2", make_inputs({2, 2, 2, 2, 2}));
+
+    EXPECT_TRUE(cache.get("prompt_1").has_value());
+    EXPECT_FALSE(cache.get("prompt_2").has_value());
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0);
+    EXPECT_EQ(cache.get_size_in_bytes(), 0);
+    EXPECT_FALSE(cache.get("prompt_1").has_value());
+}
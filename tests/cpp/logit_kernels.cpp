@@ -0,0 +1,157 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "sampling/logit_kernels.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+constexpr float inf = std::numeric_limits<float>::infinity();
+
+std::vector<float> get_random_logits(size_t size, size_t seed) {
+    std::mt19937 rng(seed);
+    std::normal_distribution<float> distribution(0.0f, 4.0f);
+    std::vector<float> logits(size);
+    for (auto& logit : logits)
+        logit = distribution(rng);
+    return logits;
+}
+
+}  // namespace
+
+class LogitKernelsTest : public ::testing::TestWithParam<kernels::ISA> {
+protected:
+    void SetUp() override {
+        kernels::set_max_isa(GetParam());
+        if (kernels::get_isa() != GetParam())
+            GTEST_SKIP() << "The instruction set is not supported by the CPU";
+    }
+
+    void TearDown() override {
+        kernels::set_max_isa(kernels::ISA::AVX512);
+    }
+
+    // sizes which are not multiples of the vector width exercise the scalar remainders
+    const std::vector<size_t> m_sizes = {1, 7, 16, 33, 1000, 151936};
+};
+
+TEST_P(LogitKernelsTest, reductions_match_reference) {
+    for (size_t size : m_sizes) {
+        auto logits = get_random_logits(size, size);
+        const size_t max_index = std::max_element(logits.begin(), logits.end()) - logits.begin();
+        EXPECT_EQ(kernels::reduce_max(logits.data(), size), logits[max_index]);
+        EXPECT_EQ(kernels::argmax(logits.data(), size), max_index);
+
+        // the first occurrence of the maximum is returned
+        logits.push_back(logits[max_index]);
+        EXPECT_EQ(kernels::argmax(logits.data(), logits.size()), max_index);
+        logits.pop_back();
+
+        const float sum = std::accumulate(logits.begin(), logits.end(), 0.0f);
+        EXPECT_NEAR(kernels::reduce_sum(logits.data(), size), sum, 1e-5f * size);
+
+        const size_t first_greater = std::find_if(logits.begin(), logits.end(), [](float logit) { return logit > 3.0f; }) - logits.begin();
+        EXPECT_EQ(kernels::find_first_greater(logits.data(), size, 3.0f), first_greater);
+        EXPECT_EQ(kernels::find_first_greater(logits.data(), size, logits[max_index]), size);
+    }
+}
+
+TEST_P(LogitKernelsTest, nans_and_infinities_are_handled) {
+    std::vector<float> logits(37, -inf);
+    EXPECT_EQ(kernels::reduce_max(logits.data(), logits.size()), -inf);
+    EXPECT_EQ(kernels::argmax(logits.data(), logits.size()), 0);
+    EXPECT_EQ(kernels::exp_sum(logits.data(), logits.size(), 0.0f), 0.0f);
+
+    logits[3] = std::numeric_limits<float>::quiet_NaN();
+    logits[20] = 1.0f;
+    logits[30] = std::numeric_limits<float>::quiet_NaN();
+    EXPECT_EQ(kernels::reduce_max(logits.data(), logits.size()), 1.0f);
+    EXPECT_EQ(kernels::argmax(logits.data(), logits.size()), 20);
+    EXPECT_EQ(kernels::find_first_greater(logits.data(), logits.size(), 0.0f), 20);
+
+    logits[3] = logits[30] = -inf;
+    kernels::softmax(logits.data(), logits.size(), 1.0f);
+    for (size_t i = 0; i < logits.size(); ++i)
+        EXPECT_EQ(logits[i], i == 20 ? 1.0f : 0.0f);
+}
+
+TEST_P(LogitKernelsTest, softmax_matches_reference) {
+    for (float temperature : {0.5f, 1.0f, 2.0f}) {
+        for (size_t size : m_sizes) {
+            auto logits = get_random_logits(size, size);
+            // relative error of the sequential float accumulation in the scalar path grows with the size
+            const double tolerance = size > 1000 ? 1e-3 : 1e-5;
+            auto reference = logits;
+            const float max_logit = *std::max_element(reference.begin(), reference.end());
+            double norm_sum = 0.0;
+            for (auto& value : reference) {
+                value = std::exp((value - max_logit) / temperature);
+                norm_sum += value;
+            }
+
+            const float exp_sum = kernels::exp_sum(logits.data(), size, max_logit);
+            double ref_exp_sum = 0.0;
+            for (float logit : logits)
+                ref_exp_sum += std::exp(logit - max_logit);
+            EXPECT_NEAR(exp_sum, ref_exp_sum, tolerance * ref_exp_sum);
+
+            kernels::softmax(logits.data(), size, temperature);
+            for (size_t i = 0; i < size; ++i)
+                EXPECT_NEAR(logits[i], reference[i] / norm_sum, 1e-7 + tolerance * reference[i] / norm_sum);
+        }
+    }
+}
+
+TEST_P(LogitKernelsTest, top_k_threshold_matches_sorting) {
+    for (size_t size : m_sizes) {
+        auto logits = get_random_logits(size, size);
+        // add ties and special values
+        logits[size / 2] = logits[0];
+        logits[size - 1] = size > 1 ? -inf : logits[0];
+        auto sorted = logits;
+        std::sort(sorted.begin(), sorted.end(), std::greater<float>());
+        for (size_t k : {size_t(1), size / 3 + 1, size}) {
+            EXPECT_EQ(kernels::top_k_threshold(logits.data(), size, k), sorted[k - 1]) << "size " << size << ", k " << k;
+        }
+    }
+
+    // strided selection over array of structures
+    std::vector<float> pairs = {1.0f, 100.0f, 5.0f, 100.0f, -2.0f, 100.0f, 3.0f, 100.0f};
+    EXPECT_EQ(kernels::top_k_threshold(pairs.data(), 4, 2, 2), 3.0f);
+    EXPECT_EQ(kernels::top_k_threshold(pairs.data(), 4, 4, 2), -2.0f);
+}
+
+TEST_P(LogitKernelsTest, token_bitmask_matches_reference) {
+    for (size_t size : m_sizes) {
+        const auto reference_logits = get_random_logits(size, size);
+        std::mt19937 rng(size);
+        std::vector<int32_t> bitmask((size + 31) / 32);
+        for (auto& word : bitmask)
+            word = static_cast<int32_t>(rng());
+        // words which allow all or no tokens take the fast paths
+        bitmask.front() = -1;
+        bitmask.back() = 0;
+
+        auto logits = reference_logits;
+        kernels::apply_token_bitmask(logits.data(), size, bitmask.data());
+        for (size_t i = 0; i < size; ++i) {
+            const bool allowed = (static_cast<uint32_t>(bitmask[i / 32]) >> (i % 32)) & 1u;
+            EXPECT_EQ(kernels::is_token_allowed(bitmask.data(), i), allowed);
+            EXPECT_EQ(logits[i], allowed ? reference_logits[i] : -inf) << "size " << size << ", token " << i;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(VariousISA, LogitKernelsTest,
+                         ::testing::Values(kernels::ISA::SCALAR, kernels::ISA::AVX2, kernels::ISA::AVX512));
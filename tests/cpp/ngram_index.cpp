@@ -0,0 +1,96 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include "prompt_lookup/ngram_index.hpp"
+
+using namespace ov::genai;
+
+namespace {
+// the brute-force search the index replaces, kept as the reference behaviour
+std::vector<int64_t> scan_candidates(const std::vector<int64_t>& input_ids, size_t num_pred_tokens, size_t max_ngram_size) {
+    if (num_pred_tokens == 0) {
+        return {};
+    }
+    const size_t input_length = input_ids.size();
+    if (max_ngram_size >= input_length) {
+        max_ngram_size = input_length / 2;
+    }
+    for (size_t ngram_size = max_ngram_size; ngram_size > 0; ngram_size--) {
+        for (size_t input_i = 0; input_i + ngram_size < input_length; input_i++) {
+            if (!std::equal(input_ids.end() - ngram_size, input_ids.end(), input_ids.begin() + input_i)) {
+                continue;
+            }
+            const size_t start_candidate_idx = input_i + ngram_size;
+            const size_t available_num_pred = std::min(input_length - start_candidate_idx, num_pred_tokens);
+            return {input_ids.begin() + start_candidate_idx, input_ids.begin() + start_candidate_idx + available_num_pred};
+        }
+    }
+    return {};
+}
+
+std::vector<int64_t> generate_tokens(size_t length, int64_t vocab_size, std::mt19937& generator) {
+    std::uniform_int_distribution<int64_t> distribution(0, vocab_size - 1);
+    std::vector<int64_t> tokens(length);
+    for (auto& token : tokens) {
+        token = distribution(generator);
+    }
+    return tokens;
+}
+}  // namespace
+
+TEST(NgramIndexTest, finds_longest_earliest_match) {
+    NgramIndex ngram_index(3);
+    ngram_index.update({1, 2, 3, 4, 5, 2, 3, 6, 7, 1, 2, 3});
+    // [1, 2, 3] occurs at the beginning, the shorter [2, 3] occurrence at position 5 is ignored
+    EXPECT_EQ(ngram_index.find_candidates(3, 3), std::vector<int64_t>({4, 5, 2}));
+    // only [3] is searched
+    EXPECT_EQ(ngram_index.find_candidates(2, 1), std::vector<int64_t>({4, 5}));
+    EXPECT_EQ(ngram_index.find_candidates(0, 3), std::vector<int64_t>{});
+}
+
+TEST(NgramIndexTest, returns_nothing_without_match) {
+    NgramIndex ngram_index(3);
+    ngram_index.update({1, 2, 3, 4});
+    EXPECT_TRUE(ngram_index.find_candidates(5, 3).empty());
+
+    NgramIndex empty_index(3);
+    EXPECT_TRUE(empty_index.find_candidates(5, 3).empty());
+}
+
+TEST(NgramIndexTest, incremental_updates_match_brute_force_search) {
+    std::mt19937 generator(42);
+    for (size_t max_ngram_size : {1, 2, 3, 5}) {
+        for (int64_t vocab_size : {2, 5, 50}) {
+            const std::vector<int64_t> tokens = generate_tokens(300, vocab_size, generator);
+            NgramIndex ngram_index(max_ngram_size);
+            std::vector<int64_t> prefix;
+            for (int64_t token : tokens) {
+                prefix.push_back(token);
+                ngram_index.update(prefix);
+                ASSERT_EQ(ngram_index.find_candidates(4, max_ngram_size), scan_candidates(prefix, 4, max_ngram_size))
+                    << "max_ngram_size " << max_ngram_size << ", vocab_size " << vocab_size << ", length " << prefix.size();
+            }
+        }
+    }
+}
+
+TEST(NgramIndexTest, ranks_continuations_by_frequency) {
+    NgramIndex ngram_index(2);
+    // [7, 8] is followed by 1 once, then by 2 twice, then by 3 once
+    ngram_index.update({7, 8, 1, 0, 7, 8, 2, 0, 7, 8, 2, 5, 7, 8, 3, 0, 7, 8});
+    auto continuations = ngram_index.find_ranked_candidates(2, 2, 5);
+    ASSERT_EQ(continuations.size(), 3);
+    EXPECT_EQ(continuations[0].tokens, std::vector<int64_t>({2, 0}));
+    EXPECT_EQ(continuations[0].frequency, 2);
+    EXPECT_EQ(continuations[1].tokens, std::vector<int64_t>({1, 0}));
+    EXPECT_EQ(continuations[1].frequency, 1);
+    EXPECT_EQ(continuations[2].tokens, std::vector<int64_t>({3, 0}));
+
+    EXPECT_EQ(ngram_index.find_ranked_candidates(2, 2, 1).size(), 1);
+    // the longest match is the same as the one of find_candidates
+    EXPECT_EQ(ngram_index.find_candidates(2, 2), std::vector<int64_t>({1, 0}));
+}
@@ -0,0 +1,134 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include "continuous_batching/persistent_block_store.hpp"
+
+using namespace ov::genai;
+
+class PersistentBlockStoreTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::filesystem::remove(m_path);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(m_path);
+    }
+
+    std::vector<uint8_t> get_block(uint8_t value) {
+        return std::vector<uint8_t>(m_block_byte_size, value);
+    }
+
+    std::filesystem::path m_path = std::filesystem::temp_directory_path() / "ov_genai_test_persistent_block_store.bin";
+    const size_t m_block_byte_size = 64;
+    const uint64_t m_layout_hash = 42;
+    const uint64_t m_model_hash = 23;
+};
+
+TEST_F(PersistentBlockStoreTest, blocks_survive_reopening) {
+    {
+        PersistentBlockStore store(m_path, 4 * m_block_byte_size, m_block_byte_size, m_layout_hash, m_model_hash);
+        EXPECT_EQ(store.num_slots(), 4);
+        store.put(77, get_block(1));
+        store.put(56, get_block(2));
+        EXPECT_EQ(store.num_blocks(), 2);
+    }
+
+    PersistentBlockStore store(m_path, 4 * m_block_byte_size, m_block_byte_size, m_layout_hash, m_model_hash);
+    EXPECT_EQ(store.num_blocks(), 2);
+    EXPECT_TRUE(store.contains(77));
+    EXPECT_FALSE(store.contains(23));
+
+    std::vector<uint8_t> data;
+    EXPECT_TRUE(store.get(56, data));
+    EXPECT_EQ(data, get_block(2));
+    EXPECT_TRUE(store.get(77, data));
+    EXPECT_EQ(data, get_block(1));
+    EXPECT_FALSE(store.get(23, data));
+}
+
+TEST_F(PersistentBlockStoreTest, least_recently_used_block_is_evicted) {
+    {
+        PersistentBlockStore store(m_path, 2 * m_block_byte_size, m_block_byte_size, m_layout_hash, m_model_hash);
+        store.put(77, get_block(1));
+        store.put(56, get_block(2));
+        std::vector<uint8_t> data;
+        EXPECT_TRUE(store.get(77, data));
+    }
+
+    // the recency order is restored on reopening
+    PersistentBlockStore store(m_path, 2 * m_block_byte_size, m_block_byte_size, m_layout_hash, m_model_hash);
+    store.put(23, get_block(3));
+    EXPECT_EQ(store.num_blocks(), 2);
+    EXPECT_TRUE(store.contains(77));
+    EXPECT_FALSE(store.contains(56));
+
+    std::vector<uint8_t> data;
+    EXPECT_TRUE(store.get(23, data));
+    EXPECT_EQ(data, get_block(3));
+}
+
+TEST_F(PersistentBlockStoreTest, corrupted_block_is_dropped) {
+    {
+        PersistentBlockStore store(m_path, 2 * m_block_byte_size, m_block_byte_size, m_layout_hash, m_model_hash);
+        store.put(77, get_block(1));
+    }
+    {
+        // the only stored block is at the end of the file
+        std::fstream file(m_path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(-1, std::ios::end);
+        file.put(static_cast<char>(0xFF));
+    }
+
+    PersistentBlockStore store(m_path, 2 * m_block_byte_size, m_block_byte_size, m_layout_hash, m_model_hash);
+    EXPECT_TRUE(store.contains(77));
+    std::vector<uint8_t> data;
+    EXPECT_FALSE(store.get(77, data));
+    EXPECT_FALSE(store.contains(77));
+    EXPECT_EQ(store.num_blocks(), 0);
+}
+
+TEST_F(PersistentBlockStoreTest, store_is_reset_on_layout_change) {
+    {
+        PersistentBlockStore store(m_path, 2 * m_block_byte_size, m_block_byte_size, m_layout_hash, m_model_hash);
+        store.put(77, get_block(1));
+    }
+
+    PersistentBlockStore store(m_path, 2 * m_block_byte_size, m_block_byte_size, m_layout_hash + 1, m_model_hash);
+    EXPECT_EQ(store.num_blocks(), 0);
+    EXPECT_FALSE(store.contains(77));
+}
+
+TEST_F(PersistentBlockStoreTest, store_is_reset_on_model_change) {
+    {
+        PersistentBlockStore store(m_path, 2 * m_block_byte_size, m_block_byte_size, m_layout_hash, m_model_hash);
+        store.put(77, get_block(1));
+    }
+
+    // e.g. a different fine-tune of the same architecture
+    PersistentBlockStore store(m_path, 2 * m_block_byte_size, m_block_byte_size, m_layout_hash, m_model_hash + 1);
+    EXPECT_EQ(store.num_blocks(), 0);
+    EXPECT_FALSE(store.contains(77));
+}
+
+TEST_F(PersistentBlockStoreTest, blocks_are_written_in_batch) {
+    std::vector<uint8_t> batch = get_block(1);
+    std::vector<uint8_t> second_block = get_block(2);
+    batch.insert(batch.end(), second_block.begin(), second_block.end());
+    {
+        PersistentBlockStore store(m_path, 2 * m_block_byte_size, m_block_byte_size, m_layout_hash, m_model_hash);
+        store.put(std::vector<size_t>{77, 56}, batch);
+        EXPECT_EQ(store.num_blocks(), 2);
+    }
+
+    PersistentBlockStore store(m_path, 2 * m_block_byte_size, m_block_byte_size, m_layout_hash, m_model_hash);
+    std::vector<uint8_t> data;
+    EXPECT_TRUE(store.get(77, data));
+    EXPECT_EQ(data, get_block(1));
+    EXPECT_TRUE(store.get(56, data));
+    EXPECT_EQ(data, get_block(2));
+}
@@ -166,6 +166,124 @@ TEST(SamplerValidationMode, gen_phase) {
     ASSERT_EQ(sequence_groups.front()->get_sequences().front()->get_generated_ids(), expected);
 }
 
+TEST(SamplerValidationMode, gen_phase_keeps_longest_branch) {
+    auto sampling_config = ov::genai::utils::get_greedy_config();
+    // create sequence group with prompt [0, 1, 2, 3, 4]
+    std::vector<int64_t> input_vector{0, 1, 2, 3, 4};
+    ov::Tensor input_tensor(ov::element::i64, ov::Shape{1, 5}, input_vector.data());
+    std::vector<SequenceGroup::Ptr> sequence_groups{
+        SequenceGroup::Ptr(new SequenceGroup(0, input_tensor, sampling_config, 32)),
+    };
+    auto sequence_group = sequence_groups.front();
+
+    // to emulate processed prompt and add next token [ 0 ]
+    auto first_branch = sequence_group->get_sequences().front();
+    first_branch->append_token(0, 1.f);
+    sequence_group->update_processed_tokens_num(5);
+
+    // append candidates [ 1, 3, 3 ] to the first branch and [ 1, 2, 3 ] to the second one
+    auto second_branch = sequence_group->fork_sequence(first_branch);
+    size_t num_validated_tokens = 3;
+    for (int64_t token_id : {1, 3, 3}) {
+        first_branch->append_token(token_id, 1.f);
+    }
+    for (int64_t token_id : {1, 2, 3}) {
+        second_branch->append_token(token_id, 1.f);
+    }
+    sequence_group->set_candidate_branches(true);
+
+    sequence_group->set_num_validated_tokens(num_validated_tokens);
+    const auto num_scheduled_tokens = sequence_group->get_num_available_tokens_for_batching();
+    ASSERT_EQ(num_scheduled_tokens, num_validated_tokens + 1);
+    sequence_group->schedule_tokens(num_scheduled_tokens);
+
+    // both branches are predicted as [ 1, 2, 3, 4 ]
+    std::vector<float> logits = {
+        0, 1.f, 0, 0, 0,
+        0, 0, 1.f, 0, 0,
+        0, 0, 0, 1.f, 0,
+        0, 0, 0, 0, 1.f,
+        0, 1.f, 0, 0, 0,
+        0, 0, 1.f, 0, 0,
+        0, 0, 0, 1.f, 0,
+        0, 0, 0, 0, 1.f,
+    };
+
+    // shape 2 branches + 4 tokens + 5 vocab
+    ov::Tensor gen_input_ids(ov::element::f32, ov::Shape{2, 4, 5}, logits.data());
+
+    Sampler sampler;
+    SamplerOutput sampler_output = sampler.sample(sequence_groups, gen_input_ids, true);
+
+    // the first branch is cut to [0, 1, 2], the second one is fully accepted and replaces it
+    ASSERT_EQ(sequence_group->num_total_seqs(), 1);
+    EXPECT_FALSE(sequence_group->has_candidate_branches());
+    EXPECT_EQ(sequence_group->get_sequences().front()->get_id(), second_branch->get_id());
+    TokenIds expected{0, 1, 2, 3, 4};
+    EXPECT_EQ(sequence_group->get_sequences().front()->get_generated_ids(), expected);
+    EXPECT_EQ(sampler_output.m_dropped_sequences, std::vector<uint64_t>{first_branch->get_id()});
+    // prompt and all the generated tokens except the last one
+    EXPECT_EQ(sequence_group->get_num_processed_tokens(), 9);
+}
+
+TEST(SamplerValidationMode, gen_phase_longest_branch_streams_to_original_sequence) {
+    auto sampling_config = ov::genai::utils::get_greedy_config();
+    // create sequence group with prompt [0, 1, 2, 3, 4]
+    std::vector<int64_t> input_vector{0, 1, 2, 3, 4};
+    ov::Tensor input_tensor(ov::element::i64, ov::Shape{1, 5}, input_vector.data());
+    std::vector<SequenceGroup::Ptr> sequence_groups{
+        SequenceGroup::Ptr(new SequenceGroup(0, input_tensor, sampling_config, 32)),
+    };
+    auto sequence_group = sequence_groups.front();
+    auto handle = std::make_shared<GenerationHandleImpl>(sequence_group->get_generation_stream(), sampling_config);
+
+    // to emulate processed prompt and add next token [ 0 ], which is streamed before the branches are forked
+    auto first_branch = sequence_group->get_sequences().front();
+    first_branch->append_token(0, 1.f);
+    sequence_group->update_processed_tokens_num(5);
+    sequence_group->notify_handle();
+
+    // append candidates [ 1, 3, 3 ] to the first branch and [ 1, 2, 3 ] to the second one
+    auto second_branch = sequence_group->fork_sequence(first_branch);
+    size_t num_validated_tokens = 3;
+    for (int64_t token_id : {1, 3, 3}) {
+        first_branch->append_token(token_id, 1.f);
+    }
+    for (int64_t token_id : {1, 2, 3}) {
+        second_branch->append_token(token_id, 1.f);
+    }
+    sequence_group->set_candidate_branches(true);
+
+    sequence_group->set_num_validated_tokens(num_validated_tokens);
+    sequence_group->schedule_tokens(sequence_group->get_num_available_tokens_for_batching());
+
+    // both branches are predicted as [ 1, 2, 3, 4 ]
+    std::vector<float> logits = {
+        0, 1.f, 0, 0, 0,
+        0, 0, 1.f, 0, 0,
+        0, 0, 0, 1.f, 0,
+        0, 0, 0, 0, 1.f,
+        0, 1.f, 0, 0, 0,
+        0, 0, 1.f, 0, 0,
+        0, 0, 0, 1.f, 0,
+        0, 0, 0, 0, 1.f,
+    };
+    ov::Tensor gen_input_ids(ov::element::f32, ov::Shape{2, 4, 5}, logits.data());
+
+    Sampler sampler;
+    sampler.sample(sequence_groups, gen_input_ids, true);
+    sequence_group->notify_handle();
+    sequence_group->set_generation_status(GenerationStatus::FINISHED);
+
+    // the second branch wins, but continues the output of the first one
+    EXPECT_EQ(sequence_group->get_sequences().front()->get_grouped_id(), first_branch->get_grouped_id());
+    std::vector<GenerationOutput> outputs = handle->read_all();
+    ASSERT_EQ(outputs.size(), 1);
+    TokenIds expected{0, 1, 2, 3, 4};
+    EXPECT_EQ(outputs.front().generated_ids, expected);
+    EXPECT_EQ(outputs.front().generated_log_probs.size(), expected.size());
+}
+
 TEST(SamplerValidationMode, prompt_phase_to_cut_part_seq) {
     auto sampling_config = ov::genai::utils::get_greedy_config();
     // create sequence group with prompt [0, 1, 2, 3, 4]
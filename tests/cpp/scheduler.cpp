@@ -3,12 +3,17 @@
 //
 
 #include <gtest/gtest.h>
+#include <chrono>
+#include <filesystem>
+#include <numeric>
+#include <thread>
 #include "openvino/runtime/core.hpp"
 #include "openvino/op/concat.hpp"
 #include "openvino/genai/continuous_batching_pipeline.hpp"
 #include "openvino/genai/generation_config.hpp"
 #include "sequence_group.hpp"
 #include "continuous_batching/scheduler.hpp"
+#include "sampling/sampler.hpp"
 #include "helper.hpp"
 #include "utils.hpp"
 
@@ -321,6 +326,94 @@ TEST_P(PartialPreemptionSchedulerTest, test_partial_preemption) {
 INSTANTIATE_TEST_SUITE_P(VariousSchedulerConfigs, PartialPreemptionSchedulerTest ,
                          ::testing::ValuesIn(PARTIAL_PREEMPTION_TEST_CASES));
 
+using SwapPreemptionSchedulerTest = ::testing::TestWithParam<SchedulerConfig>;
+SchedulerConfig get_swap_scheduler_config(bool dynamic_split_fuse) {
+    auto retval = get_scheduler_config(32, 6, dynamic_split_fuse, 5);
+    retval.num_swap_kv_blocks = 4;
+    retval.swap_min_num_tokens = 1;
+    return retval;
+}
+const std::vector<SchedulerConfig> SWAP_PREEMPTION_TEST_CASES = {
+        get_swap_scheduler_config(false),
+        get_swap_scheduler_config(true),
+};
+
+TEST_P(SwapPreemptionSchedulerTest, test_preemption_by_swap) {
+    auto scheduler_config = GetParam();
+    std::vector<uint64_t> tokens1 = {0,1,2,3,4,5,6,7,8,9,10};
+    SequenceGroup::Ptr sequence_group1 = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {tokens1.size()}, tokens1.data()),
+                                                                            utils::get_greedy_config(), 4);
+    std::vector<uint64_t> tokens2 = {0,1,2,3,4,5,6,7};
+    auto idx0 = (*sequence_group1)[0]->get_id();
+    SequenceGroup::Ptr sequence_group2 = std::make_shared<SequenceGroup>(1, ov::Tensor(ov::element::i64, {tokens2.size()}, tokens2.data()),
+                                                                            utils::get_greedy_config(), 4);
+    auto idx1 = (*sequence_group2)[0]->get_id();
+    std::vector<SequenceGroup::Ptr> requests = {sequence_group1, sequence_group2};
+
+    auto cache_manager = init_cache_manager(scheduler_config);
+    Scheduler scheduler = Scheduler(4, cache_manager, scheduler_config);
+    scheduler.schedule(requests);
+    for (auto seq: requests) {
+        // prompt phase
+        seq->finish_iteration();
+    }
+
+    // schedule generate, all 6 kv blocks are used.
+    scheduler.schedule(requests);
+    for (auto seq: requests) {
+        seq->get_running_sequences()[0]->append_token(16, 0.9);
+        seq->finish_iteration();
+    }
+
+    // fill blocks of sequence_group2 with a pattern to check that contents survive swapping
+    ov::Tensor key_cache = cache_manager->get_key_cache(0);
+    const size_t block_byte_size = key_cache.get_byte_size() / key_cache.get_shape()[0];
+    auto block_table2 = scheduler.get_block_tables(*(*sequence_group2)[0])[0];
+    EXPECT_EQ(block_table2.size(), 3);
+    for (size_t i = 0; i < block_table2.size(); ++i) {
+        std::memset(static_cast<uint8_t*>(key_cache.data()) + block_table2[i]->get_index() * block_byte_size, i + 1, block_byte_size);
+    }
+
+    // sequence_group2 should be swapped out completely, keeping its processed tokens
+    auto out2 = scheduler.schedule(requests);
+
+    std::vector<uint64_t> ref_ids = {0};
+    EXPECT_EQ(out2.m_scheduled_sequence_groups_ids, ref_ids);
+    EXPECT_EQ(out2.m_total_num_scheduled_tokens, 1);
+    EXPECT_EQ(out2.m_block_tables[idx0][0].size(), 4);
+    EXPECT_EQ(sequence_group2->get_num_processed_tokens(), 9);
+    EXPECT_TRUE(scheduler.has_block_table(idx1));
+    EXPECT_THROW(scheduler.get_block_tables(idx1), std::out_of_range);
+
+    // finish first sequence
+    requests[0]->get_running_sequences()[0]->set_status(SequenceStatus::FINISHED);
+    scheduler.free_sequence(idx0);
+    clear_finished_sequences(requests);
+
+    // sequence_group2 should be swapped in and only the next token should be computed
+    auto out3 = scheduler.schedule(requests);
+
+    EXPECT_EQ(out3.m_total_num_scheduled_tokens, 1);
+    EXPECT_EQ(sequence_group2->get_num_processed_tokens(), 9);
+    block_table2 = scheduler.get_block_tables(*(*sequence_group2)[0])[0];
+    EXPECT_EQ(block_table2.size(), 3);
+    key_cache = cache_manager->get_key_cache(0);
+    for (size_t i = 0; i < block_table2.size(); ++i) {
+        const uint8_t* block_data = static_cast<const uint8_t*>(key_cache.data()) + block_table2[i]->get_index() * block_byte_size;
+        EXPECT_EQ(block_data[0], i + 1);
+        EXPECT_EQ(block_data[block_byte_size - 1], i + 1);
+    }
+
+    for (auto& req : requests) {
+        for (auto& seq : req->get_sequences()) {
+            scheduler.free_sequence(seq->get_id());
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(VariousSchedulerConfigs, SwapPreemptionSchedulerTest,
+                         ::testing::ValuesIn(SWAP_PREEMPTION_TEST_CASES));
+
 TEST(TestScheduler, test_partial_preemption_beam_search) {
     std::array<SchedulerConfig, 2> configs = {SchedulerConfig(), SchedulerConfig()};
     configs.at(0).num_kv_blocks = 10;
@@ -731,6 +824,102 @@ TEST(TestScheduler, prefix_caching_with_max_new_tokens_equal_1) {
 
 }
 
+TEST(TestScheduler, prefix_caching_persistent_store_test) {
+    std::array<SchedulerConfig, 2> configs = {SchedulerConfig(), SchedulerConfig()};
+    configs.at(0).num_kv_blocks = 10;
+    configs.at(0).dynamic_split_fuse = false;
+    configs.at(0).enable_prefix_caching = true;
+    configs.at(1).num_kv_blocks = 10;
+    configs.at(1).dynamic_split_fuse = true;
+    configs.at(1).enable_prefix_caching = true;
+    auto store_path = std::filesystem::temp_directory_path() / "ov_genai_test_persistent_prefix_cache.bin";
+    for (auto scheduler_config: configs) {
+        std::filesystem::remove(store_path);
+        scheduler_config.persistent_prefix_cache_path = store_path.string();
+        std::vector<uint64_t> prompt_tokens = {0,1,2,3,4,5,6,7,8,9,10};
+
+        // each scheduler instance emulates a separate pipeline run with an empty in-memory cache
+        for (size_t run = 0; run < 2; run++) {
+            auto cache_manager = init_cache_manager(scheduler_config);
+            Scheduler scheduler = Scheduler(4, cache_manager, scheduler_config);
+            scheduler.open_persistent_prefix_cache(/* model_fingerprint = */ 42);
+            SequenceGroup::Ptr sequence_group = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {prompt_tokens.size()}, prompt_tokens.data()),
+                                                                                    utils::get_greedy_config(), 4);
+            std::vector<SequenceGroup::Ptr> requests = {sequence_group};
+            scheduler.restore_cached_blocks(sequence_group);
+            EXPECT_EQ(sequence_group->get_num_processed_tokens(), 0);
+
+            // two full prompt blocks are restored from the persistent store on the second run
+            auto out = scheduler.schedule(requests);
+            EXPECT_EQ(out.m_total_num_scheduled_tokens, run == 0 ? prompt_tokens.size() : prompt_tokens.size() - 8);
+            auto idx0 = (*sequence_group)[0]->get_id();
+            auto block_table = scheduler.get_block_tables(idx0)[0];
+            EXPECT_EQ(block_table.size(), 3);
+
+            ov::Tensor key_cache = cache_manager->get_key_cache(0);
+            const size_t block_byte_size = key_cache.get_byte_size() / key_cache.get_shape()[0];
+            for (size_t i = 0; i < 2; ++i) {
+                uint8_t* block_data = static_cast<uint8_t*>(key_cache.data()) + block_table[i]->get_index() * block_byte_size;
+                if (run == 0) {
+                    // emulate inference results
+                    std::memset(block_data, i + 1, block_byte_size);
+                } else {
+                    EXPECT_EQ(block_data[0], i + 1);
+                    EXPECT_EQ(block_data[block_byte_size - 1], i + 1);
+                }
+            }
+
+            sequence_group->get_running_sequences()[0]->append_token(23, 0.7);
+            sequence_group->finish_iteration();
+            scheduler.persist_computed_blocks(requests);
+
+            sequence_group->get_running_sequences()[0]->set_status(SequenceStatus::FINISHED);
+            scheduler.free_sequence(idx0);
+        }
+    }
+    std::filesystem::remove(store_path);
+}
+
+TEST(TestScheduler, prefix_caching_persistent_store_skips_embeddings) {
+    SchedulerConfig scheduler_config;
+    scheduler_config.num_kv_blocks = 10;
+    scheduler_config.dynamic_split_fuse = true;
+    scheduler_config.enable_prefix_caching = true;
+    auto store_path = std::filesystem::temp_directory_path() / "ov_genai_test_persistent_prefix_cache_embeddings.bin";
+    std::filesystem::remove(store_path);
+    scheduler_config.persistent_prefix_cache_path = store_path.string();
+    size_t hidden_size = 16;
+    std::vector<std::vector<float>> prompt_embeddings;
+    for (size_t i = 0; i < 9; i++) {
+        prompt_embeddings.emplace_back(std::vector<float>());
+        for (size_t j = 0; j < hidden_size; j++) {
+            prompt_embeddings[i].push_back(i * hidden_size + j + (float)j * 0.05);
+        }
+    }
+
+    // hashes of embeddings blocks are not exact, so their blocks are neither persisted nor restored
+    for (size_t run = 0; run < 2; run++) {
+        Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+        scheduler.open_persistent_prefix_cache(/* model_fingerprint = */ 42);
+        SequenceGroup::Ptr sequence_group = std::make_shared<SequenceGroup>(0, embeds_matrix_to_tensor(prompt_embeddings), utils::get_greedy_config(), 4);
+        std::vector<SequenceGroup::Ptr> requests = {sequence_group};
+        scheduler.restore_cached_blocks(sequence_group);
+
+        auto out = scheduler.schedule(requests);
+        EXPECT_EQ(out.m_total_num_scheduled_tokens, prompt_embeddings.size());
+
+        auto running_sequence = sequence_group->get_running_sequences()[0];
+        running_sequence->append_token(23, 0.7);
+        running_sequence->append_generated_ids_embeds(embeds_matrix_to_tensor({prompt_embeddings[0]}));
+        sequence_group->finish_iteration();
+        scheduler.persist_computed_blocks(requests);
+
+        running_sequence->set_status(SequenceStatus::FINISHED);
+        scheduler.free_sequence(running_sequence->get_id());
+    }
+    std::filesystem::remove(store_path);
+}
+
 TEST(TestScheduler, test_partially_preempted_prompt_not_allowed) {
     SchedulerConfig scheduler_config;
     scheduler_config.max_num_batched_tokens = 32;
@@ -1111,3 +1300,282 @@ TEST(TestScheduler, prefix_caching_embeddings_test) {
          }
     }
 }
+
+SequenceGroup::Ptr create_prioritized_sequence_group(uint64_t request_id, std::vector<uint64_t>& tokens, size_t priority, size_t ttft_deadline_ms = 0) {
+    ov::genai::GenerationConfig config = utils::get_greedy_config();
+    config.priority = priority;
+    config.ttft_deadline_ms = ttft_deadline_ms;
+    return std::make_shared<SequenceGroup>(request_id, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()), config, 4);
+}
+
+std::vector<uint64_t> get_request_ids(const std::vector<SequenceGroup::Ptr>& requests) {
+    std::vector<uint64_t> request_ids;
+    for (const auto& request : requests) {
+        request_ids.push_back(request->get_request_id());
+    }
+    return request_ids;
+}
+
+TEST(TestScheduler, high_priority_prompt_is_scheduled_first) {
+    for (bool dynamic_split_fuse : {false, true}) {
+        auto scheduler_config = get_scheduler_config(8, 10, dynamic_split_fuse, 5);
+        scheduler_config.priority_aging_interval_ms = 0;
+        std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7};
+        SequenceGroup::Ptr low_priority_group = create_prioritized_sequence_group(0, tokens, 0);
+        SequenceGroup::Ptr high_priority_group = create_prioritized_sequence_group(1, tokens, 1);
+        std::vector<SequenceGroup::Ptr> requests = {low_priority_group, high_priority_group};
+
+        Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+        auto out = scheduler.schedule(requests);
+
+        // only one prompt fits the batch, and it is the one of the later, but more important request,
+        // while the order of the requests is kept
+        EXPECT_EQ(get_request_ids(requests), std::vector<uint64_t>({0, 1}));
+        EXPECT_EQ(out.m_scheduled_sequence_groups_ids, std::vector<uint64_t>({1}));
+        EXPECT_EQ(out.m_total_num_scheduled_tokens, tokens.size());
+        EXPECT_TRUE(scheduler.has_block_table((*high_priority_group)[0]->get_id()));
+        EXPECT_FALSE(scheduler.has_block_table((*low_priority_group)[0]->get_id()));
+    }
+}
+
+TEST(TestScheduler, lowest_priority_group_is_preempted) {
+    for (bool dynamic_split_fuse : {false, true}) {
+        auto scheduler_config = get_scheduler_config(32, 6, dynamic_split_fuse, 5);
+        scheduler_config.priority_aging_interval_ms = 0;
+        std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7};
+        SequenceGroup::Ptr sequence_group1 = create_prioritized_sequence_group(0, tokens, 1);
+        SequenceGroup::Ptr sequence_group2 = create_prioritized_sequence_group(1, tokens, 0);
+        SequenceGroup::Ptr sequence_group3 = create_prioritized_sequence_group(2, tokens, 2);
+        std::vector<SequenceGroup::Ptr> requests = {sequence_group1, sequence_group2, sequence_group3};
+
+        // all 3 prompts take the 6 available KV blocks
+        Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+        auto out1 = scheduler.schedule(requests);
+        EXPECT_EQ(out1.m_total_num_scheduled_tokens, tokens.size() * 3);
+        EXPECT_EQ(out1.m_scheduled_sequence_groups_ids, std::vector<uint64_t>({0, 1, 2}));
+        for (auto seq: requests) {
+            seq->finish_iteration();
+        }
+
+        // every sequence needs a new block for the next token, so the arrival order would preempt the last request,
+        // while the priorities preempt the second one
+        auto out2 = scheduler.schedule(requests);
+        EXPECT_EQ(get_request_ids(requests), std::vector<uint64_t>({0, 1, 2}));
+        EXPECT_EQ(out2.m_scheduled_sequence_groups_ids, std::vector<uint64_t>({0, 2}));
+        EXPECT_EQ(out2.m_total_num_scheduled_tokens, 2);
+        EXPECT_TRUE(scheduler.has_block_table((*sequence_group1)[0]->get_id()));
+        EXPECT_FALSE(scheduler.has_block_table((*sequence_group2)[0]->get_id()));
+        EXPECT_TRUE(scheduler.has_block_table((*sequence_group3)[0]->get_id()));
+
+        for (auto& req : requests) {
+            for (auto& seq : req->get_sequences()) {
+                if (scheduler.has_block_table(seq->get_id())) {
+                    scheduler.free_sequence(seq->get_id());
+                }
+            }
+        }
+    }
+}
+
+TEST(TestScheduler, earliest_deadline_is_scheduled_first_within_priority_class) {
+    auto scheduler_config = get_scheduler_config(8, 10, true, 5);
+    scheduler_config.priority_aging_interval_ms = 0;
+    std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7};
+    std::vector<SequenceGroup::Ptr> requests = {
+        create_prioritized_sequence_group(0, tokens, 0),
+        create_prioritized_sequence_group(1, tokens, 0, 10000),
+        create_prioritized_sequence_group(2, tokens, 0, 5000),
+        create_prioritized_sequence_group(3, tokens, 1),
+    };
+
+    // only one prompt fits the batch: priority class goes first, then the deadlines, and the request without a deadline is the last one
+    for (uint64_t expected_request_id : {3, 2, 1, 0}) {
+        Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+        auto out = scheduler.schedule(requests);
+        ASSERT_EQ(out.m_scheduled_sequence_groups_ids.size(), 1);
+        EXPECT_EQ(requests[out.m_scheduled_sequence_groups_ids[0]]->get_request_id(), expected_request_id);
+
+        // the scheduled request is removed to check the next one with a new scheduler
+        requests.erase(requests.begin() + out.m_scheduled_sequence_groups_ids[0]);
+    }
+}
+
+// Emulates ModelRunner output: logits of the scheduled groups follow the order of scheduled ids,
+// and every logits row of a request prefers the token equal to its request id
+ov::Tensor get_request_id_logits(const std::vector<SequenceGroup::Ptr>& requests, const Scheduler::Output& out, size_t vocab_size) {
+    std::vector<uint64_t> row_request_ids;
+    for (uint64_t seq_group_id : out.m_scheduled_sequence_groups_ids) {
+        const SequenceGroup::Ptr& sequence_group = requests[seq_group_id];
+        size_t num_scheduled_tokens = sequence_group->get_num_scheduled_tokens();
+        sequence_group->set_output_seq_len(num_scheduled_tokens);
+        row_request_ids.insert(row_request_ids.end(), num_scheduled_tokens * sequence_group->num_running_seqs(), sequence_group->get_request_id());
+    }
+    ov::Tensor logits(ov::element::f32, {row_request_ids.size(), 1, vocab_size});
+    float* logits_data = logits.data<float>();
+    std::fill_n(logits_data, logits.get_size(), 0.0f);
+    for (size_t row = 0; row < row_request_ids.size(); ++row) {
+        logits_data[row * vocab_size + row_request_ids[row]] = 1.0f;
+    }
+    return logits;
+}
+
+TEST(TestScheduler, mixed_priorities_keep_logits_of_each_request) {
+    auto scheduler_config = get_scheduler_config(32, 10, true, 5);
+    scheduler_config.priority_aging_interval_ms = 0;
+    std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7};
+    const size_t vocab_size = 8;
+    SequenceGroup::Ptr low_priority_group = create_prioritized_sequence_group(1, tokens, 0);
+    std::vector<SequenceGroup::Ptr> requests = {low_priority_group};
+
+    Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+    Sampler sampler;
+    auto out1 = scheduler.schedule(requests);
+    sampler.sample(requests, get_request_id_logits(requests, out1, vocab_size));
+
+    // the prompt of the high priority request goes in front of the generating low priority request,
+    // but it's scheduled by the prompt phase after the generation phase
+    SequenceGroup::Ptr high_priority_group = create_prioritized_sequence_group(2, tokens, 1);
+    requests.push_back(high_priority_group);
+    auto out2 = scheduler.schedule(requests);
+    EXPECT_EQ(get_request_ids(requests), std::vector<uint64_t>({1, 2}));
+    EXPECT_EQ(out2.m_scheduled_sequence_groups_ids, std::vector<uint64_t>({0, 1}));
+    sampler.sample(requests, get_request_id_logits(requests, out2, vocab_size));
+
+    EXPECT_EQ((*low_priority_group)[0]->get_generated_ids(), TokenIds({1, 1}));
+    EXPECT_EQ((*high_priority_group)[0]->get_generated_ids(), TokenIds({2}));
+
+    for (auto& req : requests) {
+        for (auto& seq : req->get_sequences()) {
+            if (scheduler.has_block_table(seq->get_id())) {
+                scheduler.free_sequence(seq->get_id());
+            }
+        }
+    }
+}
+
+TEST(TestScheduler, priority_aging_prevents_starvation) {
+    for (size_t priority_aging_interval_ms : {0, 10}) {
+        auto scheduler_config = get_scheduler_config(8, 10, true, 5);
+        scheduler_config.priority_aging_interval_ms = priority_aging_interval_ms;
+        std::vector<uint64_t> tokens = {0,1,2,3,4,5,6,7};
+        SequenceGroup::Ptr low_priority_group = create_prioritized_sequence_group(0, tokens, 0);
+        // the low priority request waits for several aging intervals
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        SequenceGroup::Ptr high_priority_group = create_prioritized_sequence_group(1, tokens, 1);
+        std::vector<SequenceGroup::Ptr> requests = {low_priority_group, high_priority_group};
+
+        Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+        auto out = scheduler.schedule(requests);
+
+        // only one prompt fits the batch
+        if (priority_aging_interval_ms == 0) {
+            EXPECT_EQ(out.m_scheduled_sequence_groups_ids, std::vector<uint64_t>({1}));
+        } else {
+            EXPECT_EQ(out.m_scheduled_sequence_groups_ids, std::vector<uint64_t>({0}));
+        }
+    }
+}
+
+SequenceGroup::Ptr create_sequence_group_with_prompt_len(uint64_t request_id, std::vector<uint64_t>& tokens, size_t prompt_len) {
+    tokens.resize(prompt_len);
+    std::iota(tokens.begin(), tokens.end(), 0);
+    return std::make_shared<SequenceGroup>(request_id, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()), utils::get_greedy_config(), 4);
+}
+
+TEST(TestScheduler, max_prompt_chunk_size_limits_prompt_tokens_per_group) {
+    auto scheduler_config = get_scheduler_config(32, 40, true, 5);
+    scheduler_config.max_prompt_chunk_size = 8;
+    std::vector<uint64_t> long_tokens, short_tokens;
+    std::vector<SequenceGroup::Ptr> requests = {
+        create_sequence_group_with_prompt_len(0, long_tokens, 64),
+        create_sequence_group_with_prompt_len(1, short_tokens, 6),
+    };
+
+    Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+    auto out = scheduler.schedule(requests);
+
+    EXPECT_EQ(out.m_scheduled_sequence_groups_ids, std::vector<uint64_t>({0, 1}));
+    EXPECT_EQ(requests[0]->get_num_scheduled_tokens(), 8);
+    EXPECT_EQ(requests[1]->get_num_scheduled_tokens(), 6);
+    EXPECT_EQ(out.m_total_num_scheduled_tokens, 14);
+}
+
+TEST(TestScheduler, fair_prompt_chunking_shares_budget_between_prompts) {
+    for (bool fair_prompt_chunking : {false, true}) {
+        auto scheduler_config = get_scheduler_config(32, 40, true, 5);
+        scheduler_config.fair_prompt_chunking = fair_prompt_chunking;
+        std::vector<uint64_t> long_tokens, other_long_tokens, short_tokens;
+        std::vector<SequenceGroup::Ptr> requests = {
+            create_sequence_group_with_prompt_len(0, long_tokens, 64),
+            create_sequence_group_with_prompt_len(1, other_long_tokens, 48),
+            create_sequence_group_with_prompt_len(2, short_tokens, 4),
+        };
+
+        Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+        auto out = scheduler.schedule(requests);
+
+        EXPECT_EQ(out.m_total_num_scheduled_tokens, 32);
+        if (fair_prompt_chunking) {
+            // the short prompt is scheduled completely and the long ones share the rest equally
+            EXPECT_EQ(out.m_scheduled_sequence_groups_ids, std::vector<uint64_t>({0, 1, 2}));
+            EXPECT_EQ(requests[0]->get_num_scheduled_tokens(), 14);
+            EXPECT_EQ(requests[1]->get_num_scheduled_tokens(), 14);
+            EXPECT_EQ(requests[2]->get_num_scheduled_tokens(), 4);
+        } else {
+            // the first prompt takes the whole batch
+            EXPECT_EQ(out.m_scheduled_sequence_groups_ids, std::vector<uint64_t>({0}));
+            EXPECT_EQ(requests[0]->get_num_scheduled_tokens(), 32);
+        }
+    }
+}
+
+TEST(TestScheduler, fair_prompt_chunking_gives_remainder_to_earlier_prompts) {
+    auto scheduler_config = get_scheduler_config(32, 40, true, 5);
+    scheduler_config.fair_prompt_chunking = true;
+    std::vector<std::vector<uint64_t>> tokens(3);
+    std::vector<SequenceGroup::Ptr> requests;
+    for (size_t request_id = 0; request_id < tokens.size(); ++request_id) {
+        requests.push_back(create_sequence_group_with_prompt_len(request_id, tokens[request_id], 40));
+    }
+
+    Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+    auto out = scheduler.schedule(requests);
+
+    EXPECT_EQ(out.m_total_num_scheduled_tokens, 32);
+    EXPECT_EQ(requests[0]->get_num_scheduled_tokens(), 11);
+    EXPECT_EQ(requests[1]->get_num_scheduled_tokens(), 11);
+    EXPECT_EQ(requests[2]->get_num_scheduled_tokens(), 10);
+}
+
+TEST(TestScheduler, reserved_decode_tokens_limit_prompt_chunks) {
+    for (size_t num_reserved_decode_tokens : {0, 16}) {
+        auto scheduler_config = get_scheduler_config(32, 40, true, 5);
+        scheduler_config.num_reserved_decode_tokens = num_reserved_decode_tokens;
+        std::vector<uint64_t> generating_tokens, prompt_tokens;
+        std::vector<SequenceGroup::Ptr> requests = {create_sequence_group_with_prompt_len(0, generating_tokens, 20)};
+
+        Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+        auto out = scheduler.schedule(requests);
+        // nobody is generating yet, so the prompt is not limited by the reservation
+        EXPECT_EQ(out.m_total_num_scheduled_tokens, 20);
+        // prompt phase
+        requests[0]->finish_iteration();
+
+        requests.push_back(create_sequence_group_with_prompt_len(1, prompt_tokens, 64));
+        out = scheduler.schedule(requests);
+
+        EXPECT_EQ(out.m_scheduled_sequence_groups_ids, std::vector<uint64_t>({0, 1}));
+        EXPECT_EQ(requests[0]->get_num_scheduled_tokens(), 1);
+        if (num_reserved_decode_tokens == 0) {
+            EXPECT_EQ(requests[1]->get_num_scheduled_tokens(), 31);
+        } else {
+            EXPECT_EQ(requests[1]->get_num_scheduled_tokens(), 16);
+        }
+    }
+}
+
+TEST(TestScheduler, reserved_decode_tokens_must_be_less_than_batch) {
+    auto scheduler_config = get_scheduler_config(32, 40, true, 5);
+    scheduler_config.num_reserved_decode_tokens = 32;
+    EXPECT_THROW(Scheduler(4, init_cache_manager(scheduler_config), scheduler_config), ov::Exception);
+}
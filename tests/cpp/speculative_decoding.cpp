@@ -4,6 +4,7 @@
 #include "gtest/gtest.h"
 
 #include "speculative_decoding/continuous_batching/pipeline_impl.hpp"
+#include "speculative_decoding/draft_length_controller.hpp"
 #include "utils.hpp"
 
 class CBForSDTest : public testing::Test, public ov::genai::ContinuousBatchingPipeline {
@@ -426,3 +427,42 @@ TEST_F(CBForSDTest, add_tokens__two_sequence) {
     ASSERT_EQ(after.at(0).at(1).token_ids, tokens);
     ASSERT_EQ(after.at(0).at(1).log_probs, log_probs);
 }
+
+TEST(DraftLengthControllerTest, optimal_num_candidates_grows_with_acceptance) {
+    using ov::genai::DraftLengthController;
+    // every candidate is accepted, so the longest draft is the best one while drafting is cheap
+    EXPECT_EQ(DraftLengthController::get_optimal_num_candidates(1.f, 0.1f, 10), 10);
+    // nothing is accepted, so a single candidate wastes the least time
+    EXPECT_EQ(DraftLengthController::get_optimal_num_candidates(0.f, 0.1f, 10), 1);
+    size_t previous_num_candidates = 1;
+    for (float acceptance_probability : {0.2f, 0.4f, 0.6f, 0.8f, 0.9f}) {
+        size_t num_candidates = DraftLengthController::get_optimal_num_candidates(acceptance_probability, 0.1f, 10);
+        EXPECT_GE(num_candidates, previous_num_candidates);
+        previous_num_candidates = num_candidates;
+    }
+    // expensive drafts shorten the optimal draft
+    EXPECT_LT(DraftLengthController::get_optimal_num_candidates(0.8f, 0.5f, 10),
+              DraftLengthController::get_optimal_num_candidates(0.8f, 0.05f, 10));
+}
+
+TEST(DraftLengthControllerTest, adapts_num_candidates_per_request) {
+    ov::genai::DraftLengthController controller;
+    // the configured value is used until the statistics are collected
+    EXPECT_EQ(controller.get_num_candidates(0, 5), 5);
+    controller.update_acceptance(0, 5, 5);
+    EXPECT_EQ(controller.get_num_candidates(0, 5), 5);
+
+    controller.update_cost_ratio(1.f, 10.f);
+    for (size_t iteration = 0; iteration < 10; ++iteration) {
+        controller.update_acceptance(0, 5, 5);
+        controller.update_acceptance(1, 5, 0);
+    }
+    EXPECT_FLOAT_EQ(controller.get_acceptance_probability(0), 1.f);
+    EXPECT_FLOAT_EQ(controller.get_acceptance_probability(1), 0.f);
+    EXPECT_EQ(controller.get_num_candidates(0, 5), 5 * ov::genai::DraftLengthController::MAX_NUM_CANDIDATES_FACTOR);
+    EXPECT_EQ(controller.get_num_candidates(1, 5), 1);
+
+    controller.remove_request(0);
+    EXPECT_LT(controller.get_acceptance_probability(0), 0.f);
+    EXPECT_EQ(controller.get_num_candidates(0, 5), 5);
+}
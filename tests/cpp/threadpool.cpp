@@ -0,0 +1,62 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "sampling/threadpool.hpp"
+
+class ThreadPoolTest : public ::testing::TestWithParam<size_t> {};
+
+TEST_P(ThreadPoolTest, every_index_is_processed_once) {
+    ThreadPool thread_pool(GetParam());
+    for (size_t num_tasks : {0, 1, 2, 7, 64, 1000}) {
+        std::vector<std::atomic<size_t>> visits(num_tasks);
+        thread_pool.parallel_for(num_tasks, [&](size_t index) {
+            visits[index].fetch_add(1);
+        });
+        for (size_t index = 0; index < num_tasks; ++index) {
+            EXPECT_EQ(visits[index].load(), 1);
+        }
+    }
+}
+
+TEST_P(ThreadPoolTest, unbalanced_work_is_stolen) {
+    ThreadPool thread_pool(GetParam());
+    const size_t num_tasks = 64;
+    std::vector<std::atomic<size_t>> visits(num_tasks);
+    // all the expensive tasks land in the calling thread's initial range
+    thread_pool.parallel_for(num_tasks, [&](size_t index) {
+        if (index < num_tasks / GetParam())
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        visits[index].fetch_add(1);
+    });
+    for (size_t index = 0; index < num_tasks; ++index) {
+        EXPECT_EQ(visits[index].load(), 1);
+    }
+}
+
+TEST_P(ThreadPoolTest, exception_is_rethrown) {
+    ThreadPool thread_pool(GetParam());
+    std::atomic<size_t> num_processed{0};
+    EXPECT_THROW(thread_pool.parallel_for(16, [&](size_t index) {
+        num_processed.fetch_add(1);
+        if (index == 5)
+            throw std::runtime_error("task failed");
+    }), std::runtime_error);
+    EXPECT_EQ(num_processed.load(), 16);
+
+    // the pool stays usable after a failed job
+    num_processed = 0;
+    thread_pool.parallel_for(16, [&](size_t) {
+        num_processed.fetch_add(1);
+    });
+    EXPECT_EQ(num_processed.load(), 16);
+}
+
+INSTANTIATE_TEST_SUITE_P(VariousNumThreads, ThreadPoolTest,
+                         ::testing::Values(1, 2, 4, 16));
@@ -0,0 +1,176 @@
+// Copyright (C) 2025-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifdef _WIN32
+#    define _USE_MATH_DEFINES
+#endif
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "openvino/core/except.hpp"
+#include "whisper/feature_extractor.hpp"
+#include "whisper/fft.hpp"
+
+using namespace ov::genai;
+
+namespace {
+// the recursive FFT the iterative one replaces, kept as the reference behaviour
+struct RecursiveFFT {
+    std::vector<float> sin_vals, cos_vals;
+    size_t n_fft;
+
+    explicit RecursiveFFT(size_t n_fft) : sin_vals(n_fft), cos_vals(n_fft), n_fft(n_fft) {
+        for (size_t i = 0; i < n_fft; i++) {
+            double theta = (2 * M_PI * i) / n_fft;
+            sin_vals[i] = sinf(theta);
+            cos_vals[i] = cosf(theta);
+        }
+    }
+
+    void dft(const std::vector<float>& in, std::vector<float>& out) const {
+        const size_t N = in.size();
+        out.resize(N * 2);
+        const size_t sin_cos_step = n_fft / N;
+        for (size_t k = 0; k < N; k++) {
+            float re = 0, im = 0;
+            for (size_t n = 0; n < N; n++) {
+                const size_t idx = (k * n * sin_cos_step) % n_fft;
+                re += in[n] * cos_vals[idx];
+                im -= in[n] * sin_vals[idx];
+            }
+            out[k * 2 + 0] = re;
+            out[k * 2 + 1] = im;
+        }
+    }
+
+    void fft(const std::vector<float>& in, std::vector<float>& out) const {
+        const size_t N = in.size();
+        out.resize(N * 2);
+        if (N == 1) {
+            out[0] = in[0];
+            out[1] = 0;
+            return;
+        }
+        if (N % 2 == 1) {
+            dft(in, out);
+            return;
+        }
+        std::vector<float> even, odd, even_fft, odd_fft;
+        even.reserve(N / 2);
+        odd.reserve(N / 2);
+        for (size_t i = 0; i < N; i++) {
+            (i % 2 == 0 ? even : odd).push_back(in[i]);
+        }
+        fft(even, even_fft);
+        fft(odd, odd_fft);
+        const size_t sin_cos_step = n_fft / N;
+        for (size_t k = 0; k < N / 2; k++) {
+            const float re = cos_vals[k * sin_cos_step], im = -sin_vals[k * sin_cos_step];
+            const float re_odd = odd_fft[2 * k + 0], im_odd = odd_fft[2 * k + 1];
+            out[2 * k + 0] = even_fft[2 * k + 0] + re * re_odd - im * im_odd;
+            out[2 * k + 1] = even_fft[2 * k + 1] + re * im_odd + im * re_odd;
+            out[2 * (k + N / 2) + 0] = even_fft[2 * k + 0] - re * re_odd + im * im_odd;
+            out[2 * (k + N / 2) + 1] = even_fft[2 * k + 1] - re * im_odd - im * re_odd;
+        }
+    }
+};
+
+std::vector<float> generate_audio(size_t num_samples, std::mt19937& generator) {
+    std::normal_distribution<float> noise(0.f, 0.05f);
+    std::vector<float> audio(num_samples);
+    for (size_t i = 0; i < num_samples; ++i) {
+        audio[i] = 0.5f * std::sin(2 * M_PI * 440.f * i / 16000.f) + noise(generator);
+    }
+    return audio;
+}
+}  // namespace
+
+TEST(RealFFTTest, matches_dft) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    for (size_t size : {1, 2, 3, 5, 8, 12, 25, 30, 64, 97, 200, 400, 512}) {
+        RealFFT fft(size);
+        RealFFT::Workspace workspace = fft.create_workspace();
+        std::vector<float> frame(size);
+        for (auto& value : frame) {
+            value = distribution(generator);
+        }
+        std::vector<float> re(fft.get_num_bins()), im(fft.get_num_bins()), power(fft.get_num_bins());
+        fft.transform(frame.data(), re.data(), im.data(), workspace);
+        fft.power_spectrum(frame.data(), power.data(), workspace);
+
+        for (size_t k = 0; k < fft.get_num_bins(); ++k) {
+            double dft_re = 0.0, dft_im = 0.0;
+            for (size_t n = 0; n < size; ++n) {
+                const double angle = -2.0 * M_PI * ((k * n) % size) / size;
+                dft_re += frame[n] * std::cos(angle);
+                dft_im += frame[n] * std::sin(angle);
+            }
+            const double tolerance = 1e-5 * size;
+            ASSERT_NEAR(re[k], dft_re, tolerance) << "size " << size << ", bin " << k;
+            ASSERT_NEAR(im[k], dft_im, tolerance) << "size " << size << ", bin " << k;
+            ASSERT_NEAR(power[k], dft_re * dft_re + dft_im * dft_im, tolerance * size) << "size " << size << ", bin " << k;
+        }
+    }
+}
+
+TEST(RealFFTTest, matches_recursive_fft) {
+    std::mt19937 generator(42);
+    const std::vector<float> audio = generate_audio(400, generator);
+    RealFFT fft(audio.size());
+    RealFFT::Workspace workspace = fft.create_workspace();
+    std::vector<float> power(fft.get_num_bins());
+    fft.power_spectrum(audio.data(), power.data(), workspace);
+
+    std::vector<float> reference;
+    RecursiveFFT(audio.size()).fft(audio, reference);
+    for (size_t k = 0; k < fft.get_num_bins(); ++k) {
+        const float reference_power = reference[2 * k] * reference[2 * k] + reference[2 * k + 1] * reference[2 * k + 1];
+        EXPECT_NEAR(power[k], reference_power, 1e-3f * std::max(1.f, reference_power)) << "bin " << k;
+    }
+}
+
+TEST(WhisperFeatureExtractorTest, incremental_window_matches_extract) {
+    std::mt19937 generator(42);
+    WhisperFeatureExtractor feature_extractor("");
+    // 12.3 seconds pushed by pieces of random sizes, some of them shorter than a hop
+    const std::vector<float> audio = generate_audio(196800, generator);
+    std::uniform_int_distribution<size_t> piece_size(1, 4000);
+
+    WhisperIncrementalFeatures incremental_features;
+    for (size_t pushed = 0; pushed < audio.size();) {
+        const size_t size = std::min(piece_size(generator), audio.size() - pushed);
+        feature_extractor.extract_incremental({audio.begin() + pushed, audio.begin() + pushed + size}, incremental_features);
+        pushed += size;
+
+        if (pushed % 7 == 0 || pushed == audio.size()) {
+            const std::vector<float> prefix(audio.begin(), audio.begin() + pushed);
+            const std::vector<float> expected = feature_extractor.extract(prefix).data;
+            const std::vector<float> window = feature_extractor.get_window(incremental_features, 0);
+            ASSERT_EQ(window.size(), expected.size());
+            for (size_t i = 0; i < window.size(); ++i) {
+                ASSERT_NEAR(window[i], expected[i], 1e-5) << "samples=" << pushed << " index=" << i;
+            }
+        }
+    }
+    EXPECT_EQ(incremental_features.n_samples, audio.size());
+    // only the samples of the incomplete frames are kept
+    EXPECT_LE(incremental_features.samples.size(), feature_extractor.n_fft + feature_extractor.hop_length);
+
+    const size_t frame_offset = 500;
+    incremental_features.discard_frames(frame_offset);
+    const std::vector<float> expected =
+        feature_extractor.extract({audio.begin() + frame_offset * feature_extractor.hop_length, audio.end()}).data;
+    const std::vector<float> window = feature_extractor.get_window(incremental_features, frame_offset);
+    // frames near the new beginning are reflect padded by extract, so only the rest is compared
+    for (size_t j = 0; j < feature_extractor.feature_size; ++j) {
+        for (size_t frame = 2; frame < feature_extractor.nb_max_frames; ++frame) {
+            const size_t i = j * feature_extractor.nb_max_frames + frame;
+            ASSERT_NEAR(window[i], expected[i], 1e-5) << "index=" << i;
+        }
+    }
+    EXPECT_THROW(feature_extractor.get_window(incremental_features, 0), ov::Exception);
+}
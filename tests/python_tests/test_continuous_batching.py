@@ -29,6 +29,7 @@ from utils.ov_genai_pipelines import (
     GenerationChatInputsType,
 )
 from utils.comparation import compare_generation_results
+from utils.constants import get_default_llm_properties
 from data.models import CHAT_MODELS_LIST
 from data.test_dataset import get_test_dataset
 from utils.custom_op import assert_ir_contains_op_type, get_extension_model, get_extension_lib_path, CustomAdd
@@ -552,6 +553,40 @@ def test_dynamic_split_fuse_doesnt_affect_generated_text():
     assert generated == reference
 
 
+def test_prompt_lookup_candidate_branches_dont_affect_generated_text():
+    model_id : str = "TinyLlama/TinyLlama-1.1B-Chat-v1.0"
+    pipeline_type = PipelineType.PROMPT_LOOKUP_DECODING
+    models_path = download_and_convert_model(model_id).models_path
+
+    cb_pipe_ref = create_ov_pipeline(models_path, pipeline_type=pipeline_type)
+    ov_config = get_default_llm_properties() | {"prompt_lookup_num_branches": 3}
+    cb_pipe_target = create_ov_pipeline(models_path, pipeline_type=pipeline_type, ov_config=ov_config)
+
+    generation_config = GenerationConfig(do_sample=False, max_new_tokens=30, eos_token_id=cb_pipe_ref.get_tokenizer().get_eos_token_id())
+    generation_config = prepare_generation_config_by_pipe_type(generation_config=generation_config, pipeline_type=pipeline_type)
+
+    # repeated fragments make the n-gram lookup find several different continuations
+    question = "Repeat the list: red apple, red car, red apple, red house, red car, red apple, red"
+    reference = cb_pipe_ref.generate(question, generation_config=generation_config)
+    generated = cb_pipe_target.generate(question, generation_config=generation_config)
+    assert generated == reference
+
+
+@pytest.mark.parametrize("model_id", ["facebook/opt-125m"])
+def test_pipelined_step_doesnt_affect_generated_text(model_id):
+    models_path = download_and_convert_model(model_id).models_path
+
+    cb_pipe_ref = create_ov_cb_pipeline(models_path, pipeline_type=PipelineType.CONTINUOUS_BATCHING)
+    ov_config = get_default_llm_properties() | {"pipelined_step": True}
+    cb_pipe_target = create_ov_cb_pipeline(models_path, pipeline_type=PipelineType.CONTINUOUS_BATCHING, ov_config=ov_config)
+
+    generation_config = GenerationConfig(do_sample=False, max_new_tokens=20)
+    reference = cb_pipe_ref.generate(COMMON_QUESTIONS, [generation_config] * len(COMMON_QUESTIONS))
+    generated = cb_pipe_target.generate(COMMON_QUESTIONS, [generation_config] * len(COMMON_QUESTIONS))
+    for ref, gen in zip(reference, generated):
+        assert ref.m_generation_ids == gen.m_generation_ids
+
+
 eagle_models_and_input = [
     (
         "Qwen/Qwen3-1.7B",
@@ -739,6 +774,30 @@ def test_dynamic_split_fuse_for_eagle3():
     compare_results_for_dynamic_split_fuse_config("Qwen/Qwen3-1.7B", "AngelSlim/Qwen3-1.7B_eagle3")
 
 
+@pytest.mark.parametrize("sd_options", [
+    {"adaptive_num_assistant_tokens": True},
+    {"speculative_decoding_overlap": True},
+    {"adaptive_num_assistant_tokens": True, "speculative_decoding_overlap": True},
+])
+def test_speculative_decoding_options_dont_affect_generated_text(sd_options):
+    main_model_path = download_and_convert_model("HuggingFaceTB/SmolLM2-360M").models_path
+    draft_model_path = download_and_convert_model("HuggingFaceTB/SmolLM2-135M").models_path
+
+    ov_pipe_ref = create_ov_pipeline(main_model_path, pipeline_type=PipelineType.SPECULATIVE_DECODING, draft_model_path=draft_model_path)
+    ov_config = get_default_llm_properties() | sd_options
+    ov_pipe_target = create_ov_pipeline(
+        main_model_path,
+        pipeline_type=PipelineType.SPECULATIVE_DECODING,
+        draft_model_path=draft_model_path,
+        ov_config=ov_config,
+    )
+
+    generation_config = GenerationConfig(max_new_tokens=20, num_assistant_tokens=4)
+    result_ref = ov_pipe_ref.generate(COMMON_QUESTIONS, generation_config)
+    result_gen = ov_pipe_target.generate(COMMON_QUESTIONS, generation_config)
+    assert result_gen.texts == result_ref.texts
+
+
 @pytest.fixture(scope="module")
 def cb_model(request: pytest.FixtureRequest) -> OVConvertedModelSchema:
     return download_and_convert_model(request.param)
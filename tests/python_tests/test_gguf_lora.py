@@ -338,6 +338,41 @@ class TestGGUFLoRAIntegration:
         for i, output in enumerate(outputs):
             assert output is not None and len(output) > 0, f"Prompt {i} produced empty output"
 
+    @pytest.mark.nightly
+    @pytest.mark.skipif(sys.platform == "darwin", reason="Sporadic instability on Mac")
+    def test_per_request_adapters_in_one_batch(self):
+        """Test that requests with different adapters in one continuous batching step match requests generated one by one."""
+        from huggingface_hub import snapshot_download
+        from pathlib import Path
+
+        model_path = snapshot_download(repo_id=MODEL_ID, cache_dir=Path.home() / ".cache" / "huggingface" / "hub")
+        adapter_path = download_gguf_model(ADAPTER_REPO_ID, ADAPTER_FILENAME)
+
+        adapter = ov_genai.Adapter(adapter_path)
+        pipe = ov_genai.ContinuousBatchingPipeline(
+            model_path, ov_genai.SchedulerConfig(), "CPU", {"adapters": ov_genai.AdapterConfig(adapter), "per_request_adapters": True}
+        )
+
+        prompt = "<human>: What is the weather in London?\n<bot>:"
+        configs = []
+        for adapters in [ov_genai.AdapterConfig(adapter, alpha=1.0), ov_genai.AdapterConfig(), ov_genai.AdapterConfig(adapter, alpha=2.0)]:
+            config = ov_genai.GenerationConfig()
+            config.max_new_tokens = 20
+            config.do_sample = False
+            config.adapters = adapters
+            configs.append(config)
+
+        batched = pipe.generate([prompt] * len(configs), configs)
+        separate = [pipe.generate([prompt], [config])[0] for config in configs]
+
+        del pipe
+        gc.collect()
+
+        for i, (batched_result, separate_result) in enumerate(zip(batched, separate)):
+            assert batched_result.m_generation_ids == separate_result.m_generation_ids, (
+                f"Request {i} generated different output in a batch with other adapters"
+            )
+
     @pytest.mark.nightly
     @pytest.mark.skipif(sys.platform == "darwin", reason="Sporadic instability on Mac")
     def test_adapter_reloading(self):
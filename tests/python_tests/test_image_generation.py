@@ -199,6 +199,99 @@ class TestTaylorSeerImageGeneration:
         assert pipe.get_generation_config().taylorseer_config is not None
 
 
+class TestBatchedImageGeneration:
+    def test_text2image_batched_matches_sequential(self, image_generation_model):
+        pipe = ov_genai.Text2ImagePipeline(image_generation_model, "CPU")
+
+        prompts = ["cat", "dog", "bird", "horse"]
+        properties = [
+            {"width": 64, "height": 64, "num_inference_steps": 3, "rng_seed": 1},
+            {"width": 64, "height": 64, "num_inference_steps": 3, "rng_seed": 2, "guidance_scale": 4.0},
+            {"width": 64, "height": 64, "num_inference_steps": 2, "rng_seed": 3, "num_images_per_prompt": 2},
+            {"width": 32, "height": 32, "num_inference_steps": 3, "rng_seed": 4},
+        ]
+
+        results = pipe.generate(prompts, properties)
+
+        assert len(results) == len(prompts)
+        for prompt, request_properties, result in zip(prompts, properties, results):
+            image = pipe.generate(prompt, **request_properties)
+            assert result.image.data.shape == image.data.shape
+            # batched UNet inference may differ in rounding only
+            assert np.abs(result.image.data.astype(np.int32) - image.data.astype(np.int32)).max() <= 2
+            assert len(result.perf_metrics.raw_metrics.unet_inference_durations) == request_properties["num_inference_steps"]
+            assert result.perf_metrics.get_generate_duration() > 0
+
+    def test_text2image_batched_callback_early_stop(self, image_generation_model):
+        pipe = ov_genai.Text2ImagePipeline(image_generation_model, "CPU")
+
+        callback_calls = []
+
+        def callback(step, num_steps, latent):
+            callback_calls.append(step)
+            return True
+
+        results = pipe.generate(
+            ["test prompt", "test prompt"],
+            [
+                {"width": 64, "height": 64, "num_inference_steps": 5, "callback": callback},
+                {"width": 64, "height": 64, "num_inference_steps": 5},
+            ],
+        )
+
+        assert len(callback_calls) <= 2, "Callback should stop early"
+        assert results[0].image.data.size == 0
+        assert results[1].image.data.shape == (1, 64, 64, 3)
+
+
+class TestVAETiling:
+    @staticmethod
+    def _get_tiling_config(tile_size: int, tile_overlap: int) -> ov_genai.VAETilingConfig:
+        tiling_config = ov_genai.VAETilingConfig()
+        tiling_config.tile_size = tile_size
+        tiling_config.tile_overlap = tile_overlap
+        return tiling_config
+
+    def test_text2image_single_tile_matches_untiled(self, image_generation_model):
+        pipe = ov_genai.Text2ImagePipeline(image_generation_model, "CPU")
+
+        image = pipe.generate("cat", width=64, height=64, num_inference_steps=2)
+        tiled_image = pipe.generate(
+            "cat", width=64, height=64, num_inference_steps=2, vae_tiling_config=self._get_tiling_config(64, 16)
+        )
+
+        assert np.array_equal(image.data, tiled_image.data)
+
+    @pytest.mark.parametrize("image_generation_model", [SDXL_MODEL_ID, FLUX_MODEL_ID], indirect=True)
+    def test_text2image_tiled_decode(self, image_generation_model):
+        pipe = ov_genai.Text2ImagePipeline(image_generation_model, "CPU")
+
+        image = pipe.generate("cat", width=96, height=64, num_inference_steps=2)
+        tiled_image = pipe.generate(
+            "cat", width=96, height=64, num_inference_steps=2, vae_tiling_config=self._get_tiling_config(32, 16)
+        )
+
+        assert tiled_image.data.shape == image.data.shape
+        assert tiled_image.data.dtype == np.uint8
+
+    def test_image2image_tiled_encode(self, image_generation_model):
+        pipe = ov_genai.Image2ImagePipeline(image_generation_model, "CPU")
+
+        generation_config = pipe.get_generation_config()
+        generation_config.vae_tiling_config = self._get_tiling_config(32, 16)
+        pipe.set_generation_config(generation_config)
+
+        image = pipe.generate("cat", get_random_image(), strength=0.8, num_inference_steps=2)
+
+        assert image.data.shape == (1, 64, 64, 3)
+
+    def test_invalid_tiling_config(self, image_generation_model):
+        pipe = ov_genai.Text2ImagePipeline(image_generation_model, "CPU")
+
+        with pytest.raises(RuntimeError):
+            pipe.generate("cat", width=64, height=64, num_inference_steps=2, vae_tiling_config=self._get_tiling_config(32, 32))
+
+
 class TestImageGenerationOnNpuByNpuwCpu:
     def _construct_reshaped(self, model_dir):
         pipe = ov_genai.Text2ImagePipeline(model_dir)
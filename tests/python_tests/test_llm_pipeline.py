@@ -16,7 +16,7 @@ from unittest.mock import MagicMock
 import openvino as ov
 import openvino_genai as ov_genai
 
-from utils.constants import extra_generate_kwargs
+from utils.constants import extra_generate_kwargs, get_default_llm_properties
 from utils.hugging_face import generation_config_to_hf, download_and_convert_model, OVConvertedModelSchema
 
 # model_tmp_path fixture import is required so it could be triggered by pytest
@@ -32,6 +32,7 @@ from utils.ov_genai_pipelines import (
     MAIN_PIPELINE_TYPES,
     PipelineType,
     GenerationChatInputsType,
+    prepare_generation_config_by_pipe_type,
 )
 from data.models import get_models_list, CHAT_MODELS_LIST, LINEAR_ATTENTION_MODELS_LIST
 from utils.custom_op import assert_ir_contains_op_type, get_extension_model, get_extension_lib_path, CustomAdd
@@ -573,6 +574,129 @@ def test_chat_scenario_several_start(ov_pipe: ov_genai.LLMPipeline) -> None:
     ov_pipe.finish_chat()
 
 
+INCREMENTAL_CHAT_ENCODING_PIPELINE_TYPES = [
+    PipelineType.STATEFUL,
+    PipelineType.PAGED_ATTENTION,
+    PipelineType.SPECULATIVE_DECODING,
+    PipelineType.PROMPT_LOOKUP_DECODING,
+]
+
+
+def generate_chat_answers(models_path: Path, pipeline_type: PipelineType, incremental_chat_encoding: bool, chat_template: str | None = None) -> list[str]:
+    generation_config_kwargs, _ = CHAT_INPUTS[0]
+    ov_generation_config = prepare_generation_config_by_pipe_type(ov_genai.GenerationConfig(**generation_config_kwargs), pipeline_type)
+    ov_config = get_default_llm_properties() | {"incremental_chat_encoding": incremental_chat_encoding}
+    ov_pipe = create_ov_pipeline(models_path, pipeline_type=pipeline_type, ov_config=ov_config)
+    if chat_template is not None:
+        ov_pipe.get_tokenizer().set_chat_template(chat_template)
+    ov_pipe.start_chat()
+    answers = [str(ov_pipe.generate(question, generation_config=ov_generation_config)) for question in QUESTIONS]
+    ov_pipe.finish_chat()
+    return answers
+
+
+@pytest.mark.parametrize("llm_model", [CHAT_MODELS_LIST[0]], indirect=True)
+@pytest.mark.parametrize("pipeline_type", INCREMENTAL_CHAT_ENCODING_PIPELINE_TYPES)
+def test_incremental_chat_encoding_dont_affect_chat(llm_model: OVConvertedModelSchema, pipeline_type: PipelineType) -> None:
+    answers = [
+        generate_chat_answers(llm_model.models_path, pipeline_type, incremental_chat_encoding)
+        for incremental_chat_encoding in [False, True]
+    ]
+    assert answers[0] == answers[1]
+
+
+@pytest.mark.parametrize("llm_model", [CHAT_MODELS_LIST[0]], indirect=True)
+@pytest.mark.parametrize("pipeline_type", INCREMENTAL_CHAT_ENCODING_PIPELINE_TYPES)
+def test_incremental_chat_encoding_falls_back_to_full_encoding(llm_model: OVConvertedModelSchema, pipeline_type: PipelineType) -> None:
+    # the template renders the previous turns differently once a new message is added,
+    # so the tokens of the previous turns can't be reused and the whole history is tokenized again
+    chat_template = (
+        "{% for message in messages %}"
+        "{% if not loop.last %}[earlier] {% endif %}{{ message['role'] }}: {{ message['content'] }}\n"
+        "{% endfor %}"
+        "{% if add_generation_prompt %}assistant: {% endif %}"
+    )
+    answers = [
+        generate_chat_answers(llm_model.models_path, pipeline_type, incremental_chat_encoding, chat_template)
+        for incremental_chat_encoding in [False, True]
+    ]
+    assert answers[0] == answers[1]
+
+
+@pytest.mark.parametrize("llm_model", [CHAT_MODELS_LIST[0]], indirect=True)
+def test_chat_history_rollback_matches_fresh_pipeline(llm_model: OVConvertedModelSchema) -> None:
+    # replacing the last question trims its tokens and the answer from the KV cache, the rest of the context is reused
+    ov_pipe = create_ov_pipeline(llm_model.models_path, pipeline_type=PipelineType.STATEFUL)
+    config = ov_genai.GenerationConfig(max_new_tokens=16, do_sample=False)
+
+    chat_history = ov_genai.ChatHistory()
+    chat_history.append({"role": "user", "content": QUESTIONS[0]})
+    answer = ov_pipe.generate(chat_history, config).texts[0]
+    chat_history.append({"role": "assistant", "content": answer})
+    chat_history.append({"role": "user", "content": QUESTIONS[1]})
+    ov_pipe.generate(chat_history, config)
+
+    for question in QUESTIONS[2:]:
+        chat_history.pop()
+        chat_history.append({"role": "user", "content": question})
+        rollback_answer = ov_pipe.generate(chat_history, config).texts[0]
+
+        fresh_pipe = create_ov_pipeline(llm_model.models_path, pipeline_type=PipelineType.STATEFUL)
+        assert rollback_answer == fresh_pipe.generate(chat_history, config).texts[0]
+
+
+def run_chat_turn(ov_pipe: ov_genai.LLMPipeline, chat_history: ov_genai.ChatHistory, question: str) -> str:
+    config = ov_genai.GenerationConfig(max_new_tokens=20, do_sample=False)
+    chat_history.append({"role": "user", "content": question})
+    answer = ov_pipe.generate(chat_history, config).texts[0]
+    chat_history.append({"role": "assistant", "content": answer})
+    return answer
+
+
+@pytest.mark.parametrize("llm_model", [CHAT_MODELS_LIST[0]], indirect=True)
+@pytest.mark.parametrize("spill", [False, True])
+def test_session_switch_matches_separate_chats(llm_model: OVConvertedModelSchema, spill: bool, tmp_path: Path) -> None:
+    ov_pipe = create_ov_pipeline(llm_model.models_path, pipeline_type=PipelineType.STATEFUL)
+    chats = [QUESTIONS[:2], QUESTIONS[2:4]]
+
+    reference_answers = []
+    for questions in chats:
+        chat_history = ov_genai.ChatHistory()
+        reference_answers.append([run_chat_turn(ov_pipe, chat_history, question) for question in questions])
+
+    # turns of the chats are interleaved, every switch restores the session of the other chat
+    sessions = [ov_genai.SessionState() for _ in chats]
+    histories = [ov_genai.ChatHistory() for _ in chats]
+    answers = [[] for _ in chats]
+    for turn in range(2):
+        for chat_id, questions in enumerate(chats):
+            ov_pipe.restore_session(sessions[chat_id])
+            answers[chat_id].append(run_chat_turn(ov_pipe, histories[chat_id], questions[turn]))
+            sessions[chat_id] = ov_pipe.save_session()
+            assert sessions[chat_id].get_size_in_bytes() > 0
+            if spill:
+                sessions[chat_id].spill(tmp_path / f"session_{chat_id}_{turn}.bin")
+                assert sessions[chat_id].is_spilled()
+
+    assert answers == reference_answers
+
+
+@pytest.mark.parametrize("llm_model", [CHAT_MODELS_LIST[0]], indirect=True)
+def test_compressed_session_is_smaller(llm_model: OVConvertedModelSchema) -> None:
+    ov_pipe = create_ov_pipeline(llm_model.models_path, pipeline_type=PipelineType.STATEFUL)
+    chat_history = ov_genai.ChatHistory()
+    run_chat_turn(ov_pipe, chat_history, QUESTIONS[0])
+
+    session = ov_pipe.save_session()
+    size = session.get_size_in_bytes()
+    session.compress()
+    assert session.get_size_in_bytes() < size
+
+    ov_pipe.restore_session(session)
+    assert session.get_restore_duration() > 0
+    run_chat_turn(ov_pipe, chat_history, QUESTIONS[1])
+
+
 @pytest.mark.parametrize("llm_model", CHAT_MODELS_LIST, indirect=True)
 def test_generate_works_same_before_and_after_chat(ov_pipe: ov_genai.LLMPipeline) -> None:
     generation_config_kwargs, _ = CHAT_INPUTS[0]
@@ -72,6 +72,25 @@ def test_structured_json(ov_pipe, prompt_and_scheme, use_compound_grammar, capfd
         pytest.fail(f"Output {res_str} is not valid json schema {SchemeType.model_json_schema()}: {e}")
 
 
+@pytest.mark.parametrize("ov_pipe", structured_id_models, indirect=True)
+def test_structured_json_schema_formatting_shares_compiled_grammar(ov_pipe):
+    # differently formatted schemas are the same grammar, so the second request reuses the cached compiled grammar
+    schemas = [json.dumps(Person.model_json_schema()), json.dumps(Person.model_json_schema(), indent=4)]
+    prompts = ["Generate a json about a person.", "Generate a json about a person."]
+
+    gen_configs = []
+    for schema in schemas:
+        gen_config = ov_genai.GenerationConfig()
+        gen_config.max_new_tokens = 100
+        gen_config.structured_output_config = ov_genai.StructuredOutputConfig(json_schema=schema)
+        gen_configs.append(gen_config)
+
+    results = [ov_pipe.generate(prompt, generation_config=gen_config) for prompt, gen_config in zip(prompts, gen_configs)]
+
+    assert results[0] == results[1]
+    Person.model_validate_json(results[0])
+
+
 @pytest.mark.parametrize("ov_pipe", structured_id_models, indirect=True)
 @pytest.mark.parametrize(
     "prompt_and_regex",
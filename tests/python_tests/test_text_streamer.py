@@ -33,6 +33,9 @@ Sub PrintFiles()
 'Get all files in the folder
     folder.Files.Clear
 """
+# Long outputs without new lines are decoded incrementally by the streamer window, not by the whole cache.
+long_single_line_prompt = "{" + ", ".join(f'"key_{i}": [{i * 7}, "value {i}", null]' for i in range(150)) + "}"
+
 eng_prompts = [
     'What is the previous answer?',
     'Why is the Sun yellow?',
@@ -40,6 +43,7 @@ eng_prompts = [
     "Multiline\nstring!\nWow!",
     "\n\n\n\t\t   A    lot\t\tof\twhitespaces\n!\n\n\n\t\n\n",
     str_with_apostrophe,
+    long_single_line_prompt,
 ]
 
 # tmp_path fixture is created with the use of prompt name.
@@ -52,6 +56,7 @@ unicode_prompts = [*map(lambda x: str.encode(x, 'unicode_escape'), [
     "Tester, la chaîne...",
     "سلسلة الاختبار",
     "Сынақ жолы á",
+    "如果您有任何疑问，请联系我们，我们将予以解答。" * 20,
 ])]
 
 @pytest.mark.parametrize("model_id", tokenizer_model_ids)
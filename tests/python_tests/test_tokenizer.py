@@ -88,6 +88,39 @@ def test_encode(ov_hf_tokenizers, prompt):
         assert np.all(encoded_hf == encoded_ov[0])
 
 
+@pytest.mark.parametrize("ov_hf_tokenizers", get_models_list(), indirect=True)
+def test_encode_parallel(ov_hf_tokenizers):
+    ov_tokenizer, hf_tokenizer = ov_hf_tokenizers
+    single_prompts = [prompt for prompt in prompts if isinstance(prompt, str)]
+
+    for add_special_tokens in [True, False]:
+        encoded = ov_tokenizer.encode_parallel(single_prompts, add_special_tokens=add_special_tokens)
+        assert len(encoded) == len(single_prompts)
+        for prompt, inputs in zip(single_prompts, encoded):
+            reference = ov_tokenizer.encode(prompt, add_special_tokens=add_special_tokens)
+            assert np.array_equal(inputs.input_ids.data, reference.input_ids.data)
+            assert np.array_equal(inputs.attention_mask.data, reference.attention_mask.data)
+
+
+@pytest.mark.parametrize("model_id", get_models_list())
+def test_encode_cache(model_id):
+    models_path = download_and_convert_model(model_id).models_path
+    ov_tokenizer = Tokenizer(models_path)
+    cached_tokenizer = Tokenizer(models_path, encode_cache_size=1 << 20)
+    single_prompts = [prompt for prompt in prompts if isinstance(prompt, str)]
+
+    # the second pass is served from the cache, different parameters must not share the entries
+    for _ in range(2):
+        for prompt in single_prompts:
+            for add_special_tokens in [True, False]:
+                reference = ov_tokenizer.encode(prompt, add_special_tokens=add_special_tokens).input_ids.data
+                cached = cached_tokenizer.encode(prompt, add_special_tokens=add_special_tokens).input_ids.data
+                assert np.array_equal(cached, reference)
+        encoded = cached_tokenizer.encode_parallel(single_prompts)
+        for prompt, inputs in zip(single_prompts, encoded):
+            assert np.array_equal(inputs.input_ids.data, ov_tokenizer.encode(prompt).input_ids.data)
+
+
 @pytest.mark.parametrize("ov_hf_tokenizers", get_models_list(), indirect=True)
 @pytest.mark.parametrize(
     "encoded_prompt", 
@@ -104,6 +104,25 @@ class TestText2VideoPipelineGenerate:
         assert result is not None
         assert result.video is not None
 
+    def test_generate_with_vae_tiling(self, video_generation_model):
+        pipe = ov_genai.Text2VideoPipeline(video_generation_model, "CPU")
+        tiling_config = ov_genai.VAETilingConfig()
+        tiling_config.tile_size = 16
+        tiling_config.tile_overlap = 8
+        tiling_config.temporal_tile_size = 4
+        tiling_config.temporal_tile_overlap = 2
+
+        result = pipe.generate("test prompt", height=32, width=32, num_frames=9, num_inference_steps=2)
+        tiled_result = pipe.generate(
+            "test prompt",
+            height=32,
+            width=32,
+            num_frames=9,
+            num_inference_steps=2,
+            vae_tiling_config=tiling_config,
+        )
+        assert tiled_result.video.data.shape == result.video.data.shape
+
     def test_generate_with_negative_prompt(self, video_generation_model):
         pipe = ov_genai.Text2VideoPipeline(video_generation_model, "CPU")
         result = pipe.generate(
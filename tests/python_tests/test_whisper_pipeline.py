@@ -860,3 +860,92 @@ def test_streamers(model_descr, sample_from_dataset, streamer_for_test):
 
     assert expected == result_handler.decode(genai_pipe.get_tokenizer())
     result_handler.reset()
+
+
+@pytest.mark.parametrize("model_descr", get_whisper_models_list(tiny_only=True))
+@pytest.mark.parametrize("return_timestamps", [True, False])
+@pytest.mark.xfail(condition=(sys.platform == "darwin"), reason="Ticket - 173169")
+def test_batched_generate(model_descr, return_timestamps):
+    _, _, _, genai_pipe = read_whisper_model(model_descr)
+
+    long_form_samples = get_whisper_dataset(language="en", long_form=True)[:3]
+    short_form_samples = [sample[: 16000 * 10] for sample in long_form_samples[:2]]
+    samples = [*long_form_samples, *short_form_samples]
+
+    config = ov_genai.WhisperGenerationConfig(return_timestamps=return_timestamps)
+    streamer_results = [[] for _ in samples]
+    streamers = [lambda x, result=result: result.append(x) for result in streamer_results]
+
+    batched_results = genai_pipe.generate(samples, [config] * len(samples), streamers)
+
+    assert len(batched_results) == len(samples)
+    for sample, batched_result, streamer_result in zip(samples, batched_results, streamer_results):
+        sequential_result = genai_pipe.generate(sample, config)
+
+        assert batched_result.texts == sequential_result.texts
+        assert "".join(streamer_result) == batched_result.texts[0]
+
+        if return_timestamps:
+            assert len(batched_result.chunks) == len(sequential_result.chunks)
+            for batched_chunk, sequential_chunk in zip(batched_result.chunks, sequential_result.chunks):
+                assert batched_chunk.text == sequential_chunk.text
+                assert batched_chunk.start_ts == pytest.approx(sequential_chunk.start_ts, abs=1e-2)
+                assert batched_chunk.end_ts == pytest.approx(sequential_chunk.end_ts, abs=1e-2)
+        else:
+            assert batched_result.chunks is None
+
+
+@pytest.mark.parametrize("model_descr", get_whisper_models_list(tiny_only=True))
+@pytest.mark.parametrize("sample_from_dataset", [{"language": "en", "sample_id": 0, "long_form": True}], indirect=True)
+@pytest.mark.xfail(condition=(sys.platform == "darwin"), reason="Ticket - 173169")
+def test_streaming(model_descr, sample_from_dataset):
+    _, _, _, genai_pipe = read_whisper_model(model_descr)
+
+    config = ov_genai.WhisperGenerationConfig(return_timestamps=True)
+    reference = genai_pipe.generate(sample_from_dataset, config)
+
+    genai_pipe.start_streaming(config, min_update_interval=1.0)
+    final_chunks = []
+    has_partial_chunk = False
+    frame_size = 1600
+    for offset in range(0, len(sample_from_dataset), frame_size):
+        update = genai_pipe.push_audio(sample_from_dataset[offset : offset + frame_size])
+        final_chunks.extend(update.final_chunks)
+        has_partial_chunk = has_partial_chunk or update.partial_chunk is not None
+    update = genai_pipe.finish_streaming()
+    final_chunks.extend(update.final_chunks)
+    assert update.partial_chunk is None
+
+    assert has_partial_chunk
+    assert final_chunks
+    for previous_chunk, chunk in zip(final_chunks, final_chunks[1:]):
+        assert previous_chunk.start_ts <= chunk.start_ts
+        assert previous_chunk.end_ts <= chunk.start_ts + 1e-2
+    assert final_chunks[-1].end_ts <= len(sample_from_dataset) / 16000 + 1e-2
+
+    streamed_text = "".join(chunk.text for chunk in final_chunks)
+    assert SequenceMatcher(None, streamed_text, reference.texts[0]).ratio() > 0.8
+
+    with pytest.raises(RuntimeError):
+        genai_pipe.push_audio(sample_from_dataset[:frame_size])
+
+
+@pytest.mark.parametrize("model_descr", get_whisper_models_list(tiny_only=True))
+@pytest.mark.parametrize("sample_from_dataset", [*get_fixture_params_for_n_whisper_dataset_samples(n=2, long_form=True)], indirect=True)
+@pytest.mark.xfail(condition=(sys.platform == "darwin"), reason="Ticket - 173169")
+def test_encoder_lookahead(model_descr, sample_from_dataset):
+    _, path, _, genai_pipe = read_whisper_model(model_descr)
+    lookahead_pipe = ov_genai.WhisperPipeline(path, "CPU", ENABLE_MMAP=False, WHISPER_ENCODER_LOOKAHEAD=True)
+
+    config = ov_genai.WhisperGenerationConfig(return_timestamps=True)
+    expected = genai_pipe.generate(sample_from_dataset, config)
+    # the second call reuses requests which may have been left after a mismatched lookahead
+    for _ in range(2):
+        result = lookahead_pipe.generate(sample_from_dataset, config)
+
+        assert result.texts == expected.texts
+        assert len(result.chunks) == len(expected.chunks)
+        for chunk, expected_chunk in zip(result.chunks, expected.chunks):
+            assert chunk.text == expected_chunk.text
+            assert chunk.start_ts == pytest.approx(expected_chunk.start_ts, abs=1e-2)
+            assert chunk.end_ts == pytest.approx(expected_chunk.end_ts, abs=1e-2)
@@ -251,9 +251,12 @@ public:
         this->start_time = start_time;
     }
 
-    void add_generation(ov::genai::ContinuousBatchingPipeline* pipe, Dataset* dataset, size_t request_id, bool is_speculative_decoding_enabled) {
+    void add_generation(ov::genai::ContinuousBatchingPipeline* pipe, Dataset* dataset, size_t request_id, bool is_speculative_decoding_enabled, bool is_prompt_lookup_enabled) {
         auto sampling_params = dataset->m_sampling_params[request_id];
-        if (is_speculative_decoding_enabled) {
+        if (is_prompt_lookup_enabled) {
+            sampling_params.num_assistant_tokens = 5;
+            sampling_params.max_ngram_size = 3;
+        } else if (is_speculative_decoding_enabled) {
             // to enable static speculative decoding
             sampling_params.num_assistant_tokens = 5;
             // to enable dynamic speculative decoding
@@ -308,7 +311,7 @@ public:
     }
 };
 
-void trafficSimulator(ov::genai::ContinuousBatchingPipeline* pipe, Dataset* dataset, std::string request_rate, GenerationInfoCollector* generation_info_collector, bool is_speculative_decoding_enabled) {
+void trafficSimulator(ov::genai::ContinuousBatchingPipeline* pipe, Dataset* dataset, std::string request_rate, GenerationInfoCollector* generation_info_collector, bool is_speculative_decoding_enabled, bool is_prompt_lookup_enabled) {
     double numeric_request_rate;
     std::random_device rd;
     std::mt19937 gen(rd());
@@ -335,7 +338,7 @@ void trafficSimulator(ov::genai::ContinuousBatchingPipeline* pipe, Dataset* data
     generation_info_collector->set_start_time(std::chrono::steady_clock::now());
     for (size_t request_id = 0; request_id < dataset->size(); ++request_id) {
         std::cout << "Traffic thread adding request to the queue..." << std::endl;
-        generation_info_collector->add_generation(pipe, dataset, request_id, is_speculative_decoding_enabled);
+        generation_info_collector->add_generation(pipe, dataset, request_id, is_speculative_decoding_enabled, is_prompt_lookup_enabled);
         if (numeric_request_rate > 0)
             std::this_thread::sleep_for(std::chrono::milliseconds(int(distribution(gen) * 1000)));
     }
@@ -437,6 +440,7 @@ int main(int argc, char* argv[]) try {
     ("dynamic_split_fuse", "Whether to use dynamic split-fuse or vLLM scheduling", cxxopts::value<bool>()->default_value("true"))
     ("m,model", "Path to model and tokenizers base directory", cxxopts::value<std::string>()->default_value("."))
     ("draft_model", "Path to assistant model directory", cxxopts::value<std::string>()->default_value(""))
+    ("prompt_lookup", "Whether to use prompt lookup decoding", cxxopts::value<bool>()->default_value("false"))
     ("dataset", "Path to dataset .json file", cxxopts::value<std::string>()->default_value("./ShareGPT_V3_unfiltered_cleaned_split.json"))
     ("max_input_len", "Max input length take from dataset", cxxopts::value<size_t>()->default_value("1024"))
     ("max_output_len", "Max output length", cxxopts::value<size_t>()->default_value("2048"))
@@ -475,7 +479,13 @@ int main(int argc, char* argv[]) try {
     const size_t cache_size = result["cache_size"].as<size_t>();
     const bool use_cache_eviction = result["use_cache_eviction"].as<bool>();
 
+    const bool is_prompt_lookup_enabled = result["prompt_lookup"].as<bool>();
+
     bool is_speculative_decoding_enabled = !draft_model_path.empty();
+    if (is_speculative_decoding_enabled && is_prompt_lookup_enabled) {
+        std::cout << "ERROR: draft_model and prompt_lookup cannot be used together." << std::endl;
+        return EXIT_FAILURE;
+    }
 
     // Create requests for generation
     Dataset dataset = filtered_dataset(models_path, dataset_path, num_prompts, max_input_len, max_output_len);
@@ -503,11 +513,17 @@ int main(int argc, char* argv[]) try {
     std::cout << "\tMax output length: " << max_output_len << std::endl;
     std::cout << "\tTarget device: " << device << std::endl;
     std::cout << "\tPlugin configuration JSON: " << device_config << std::endl;
+    if (is_prompt_lookup_enabled) {
+        std::cout << "\tPrompt lookup decoding: enabled" << std::endl;
+    }
 
     ov::AnyMap device_config_map = {};
     if (is_speculative_decoding_enabled) {
         device_config_map.insert({ ov::genai::draft_model(draft_model_path) });
     }
+    if (is_prompt_lookup_enabled) {
+        device_config_map.insert({ ov::genai::prompt_lookup(true) });
+    }
     if (!parse_plugin_config_string(device_config, device_config_map)) {
         std::cout << "ERROR: Wrong json parameter in device_config." << std::endl;
         return EXIT_FAILURE;
@@ -523,14 +539,14 @@ int main(int argc, char* argv[]) try {
 
     std::atomic<bool> finishGenerationThread{false};
     if (request_rate == "inf") {
-        std::thread trafficSimulatorThread(trafficSimulator, &pipe, &dataset, request_rate, &generation_info_collector, is_speculative_decoding_enabled);
+        std::thread trafficSimulatorThread(trafficSimulator, &pipe, &dataset, request_rate, &generation_info_collector, is_speculative_decoding_enabled, is_prompt_lookup_enabled);
         trafficSimulatorThread.join();
     }
     
     std::thread lmmEngineThread(llmEngineLoop, &pipe, &dataset, &finishGenerationThread);
     std::thread statisticsReporterThread(statisticsReporter, &generation_info_collector, num_prompts);
     if (request_rate != "inf") {
-        std::thread trafficSimulatorThread(trafficSimulator, &pipe, &dataset, request_rate, &generation_info_collector, is_speculative_decoding_enabled);
+        std::thread trafficSimulatorThread(trafficSimulator, &pipe, &dataset, request_rate, &generation_info_collector, is_speculative_decoding_enabled, is_prompt_lookup_enabled);
         trafficSimulatorThread.join();
     }
     statisticsReporterThread.join();